@@ -50,8 +50,13 @@
 #cmakedefine HAVE_MPI_IN_PLACE
 #cmakedefine HAVE_MPI3_NONBLOCKING_COLLECTIVES
 #cmakedefine HAVE_MPIX_NONBLOCKING_COLLECTIVES
+#cmakedefine HAVE_MPI_COMM_SPLIT_TYPE
+#cmakedefine HAVE_MPI_WIN_ALLOCATE_SHARED
 #cmakedefine REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
 #cmakedefine USE_BYTE_ALLGATHERS
+#cmakedefine HAVE_POSIX_MEMALIGN
+#cmakedefine HAVE_MADV_HUGEPAGE
+#cmakedefine HAVE_MAP_HUGETLB
 
 /* Advanced configuration options */
 #cmakedefine CACHE_WARNINGS
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'R' and 'C' for convenience
+typedef double R;
+typedef Complex<R> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    try
+    {
+        const int m = Input("--m","height of C",500);
+        const int n = Input("--n","width of C",500);
+        const int k = Input("--k","inner dimension",500);
+        const bool adjoint = Input("--adjoint","use the adjoint of A?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientation = ( adjoint ? ADJOINT : NORMAL );
+
+        Grid g( comm );
+        DistMatrix<C> A( g ), B( g ), C0( g );
+        if( orientation == NORMAL )
+            Uniform( A, m, k );
+        else
+            Uniform( A, k, m );
+        Uniform( B, k, n );
+        Uniform( C0, m, n );
+        const C alpha( 2, -1 ), beta( R(1)/2, 3 );
+
+        // Form the product with interleaved storage
+        DistMatrix<C> C1( C0 );
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        Gemm( orientation, NORMAL, alpha, A, B, beta, C1 );
+        mpi::Barrier( comm );
+        const double interleavedTime = mpi::Time() - startTime;
+
+        // Convert to split storage (which requires no communication)
+        SplitDistMatrix<R> ASplit( A ), BSplit( B ), CSplit( g );
+        DistMatrix<C> C2( g );
+        const R C1Norm = FrobeniusNorm( C1 );
+        if( commRank == 0 )
+            cout << "Interleaved: " << interleavedTime << " seconds" << endl;
+        for( int alg=GEMM_3M; alg<=GEMM_4M; ++alg )
+        {
+            CSplit.Split( C0 );
+            mpi::Barrier( comm );
+            startTime = mpi::Time();
+            Gemm
+            ( orientation, NORMAL, alpha, ASplit, BSplit, beta, CSplit,
+              ComplexGemmAlgorithm(alg) );
+            mpi::Barrier( comm );
+            const double splitTime = mpi::Time() - startTime;
+
+            CSplit.Merge( C2 );
+            Axpy( C(-1), C1, C2 );
+            const R relError = FrobeniusNorm( C2 ) / C1Norm;
+            if( commRank == 0 )
+                cout << ( alg==GEMM_3M ? "Split 3M: " : "Split 4M: " )
+                     << splitTime << " seconds, ||C_split - C||_F / ||C||_F = "
+                     << relError << endl;
+        }
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
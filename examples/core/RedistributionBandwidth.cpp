@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'R' and 'C' for convenience
+typedef double R;
+typedef Complex<R> C;
+
+// The achieved bandwidth (in GB/s) of reading and writing 'numEntries'
+// entries of type T in 'seconds' seconds
+template<typename T>
+double
+Bandwidth( int numEntries, double seconds )
+{ return (2.*numEntries*sizeof(T)) / (seconds*1.e9); }
+
+// Compare the strided gather and transposition kernels used to pack and
+// unpack redistributions against the straightforward loops
+template<typename T>
+void
+LocalKernels( int m, int n, int stride, int numReps, bool print )
+{
+    vector<T> A( m*n ), B( m*n );
+    for( int k=0; k<m*n; ++k )
+        A[k] = SampleUnitBall<T>();
+    const int mStrided = m / stride;
+
+    // Gather every stride'th entry of each column into a contiguous buffer
+    double startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        for( int j=0; j<n; ++j )
+        {
+            T* BCol = &B[j*mStrided];
+            const T* ACol = &A[j*m];
+            for( int i=0; i<mStrided; ++i )
+                BCol[i] = ACol[i*stride];
+        }
+    const double naiveGather = (mpi::Time()-startTime)/numReps;
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        InterleaveMatrix( mStrided, n, &A[0], stride, m, &B[0], 1, mStrided );
+    const double gather = (mpi::Time()-startTime)/numReps;
+
+    // Form the transpose of the m x n matrix A
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        for( int j=0; j<n; ++j )
+            for( int i=0; i<m; ++i )
+                B[j+i*n] = A[i+j*m];
+    const double naiveTranspose = (mpi::Time()-startTime)/numReps;
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        InterleaveMatrix( m, n, &A[0], 1, m, &B[0], n, 1 );
+    const double transpose = (mpi::Time()-startTime)/numReps;
+
+    if( print )
+        cout << "  stride-" << stride << " gather: "
+             << Bandwidth<T>( mStrided*n, naiveGather ) << " GB/s (loop), "
+             << Bandwidth<T>( mStrided*n, gather ) << " GB/s (kernel)\n"
+             << "  transpose:        "
+             << Bandwidth<T>( m*n, naiveTranspose ) << " GB/s (loop), "
+             << Bandwidth<T>( m*n, transpose ) << " GB/s (kernel)" << endl;
+}
+
+// Time a few of the redistributions whose local packing is dominated by
+// strided copies and transpositions
+template<typename T>
+void
+Redistributions( int m, int n, int numReps, const Grid& g, bool print )
+{
+    DistMatrix<T,VR,STAR> A_VR_STAR( g );
+    Uniform( A_VR_STAR, m, n );
+    DistMatrix<T,STAR,VR> A_STAR_VR( g );
+    DistMatrix<T,STAR,MR> ATrans_STAR_MR( g );
+    ATrans_STAR_MR.AlignWith( A_VR_STAR );
+    const int localEntries = A_VR_STAR.LocalHeight()*A_VR_STAR.LocalWidth();
+
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+    {
+        A_STAR_VR = A_VR_STAR;
+        A_VR_STAR = A_STAR_VR;
+    }
+    mpi::Barrier( g.Comm() );
+    const double roundTrip = (mpi::Time()-startTime)/(2*numReps);
+
+    startTime = mpi::Time();
+    for( int rep=0; rep<numReps; ++rep )
+        ATrans_STAR_MR.TransposeFrom( A_VR_STAR );
+    mpi::Barrier( g.Comm() );
+    const double transposeFrom = (mpi::Time()-startTime)/numReps;
+
+    if( print )
+        cout << "  [* ,VR] <-> [VR,* ]:       " << roundTrip << " seconds, "
+             << Bandwidth<T>( localEntries, roundTrip )
+             << " GB/s per process\n"
+             << "  [* ,MR].TransposeFrom([VR,* ]): " << transposeFrom
+             << " seconds" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of local/global matrix",4000);
+        const int n = Input("--width","width of local/global matrix",500);
+        const int stride = Input("--stride","stride of local gather",4);
+        const int numReps = Input("--reps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        const bool print = ( commRank == 0 );
+        if( print )
+            cout << "Local kernels (real):" << endl;
+        LocalKernels<R>( m, n, stride, numReps, print );
+        if( print )
+            cout << "Local kernels (complex):" << endl;
+        LocalKernels<C>( m, n, stride, numReps, print );
+        if( print )
+            cout << "Redistributions (real) over a " << g.Height() << " x "
+                 << g.Width() << " grid:" << endl;
+        Redistributions<R>( m, n, numReps, g, print );
+        if( print )
+            cout << "Redistributions (complex):" << endl;
+        Redistributions<C>( m, n, numReps, g, print );
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/ConditionEstimate.hpp"
+#include "elemental/lapack-like/ConditionNumber.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/lapack-like/Norm/Two.hpp"
+#include "elemental/lapack-like/Norm/TwoEstimate.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",400);
+        const int n = Input("--width","width of matrix",300);
+        const R tol = Input("--tol","relative tolerance for two-norm",1e-6);
+        const R minEig = Input("--minEig","minimum eigenvalue of HPD matrix",
+                               1e-4);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+
+        // Two-norm estimate versus the largest singular value
+        DistMatrix<C> A( g );
+        Uniform( A, m, n );
+        double startTime = mpi::Time();
+        const R twoNormEst = TwoNormEstimate( A, tol );
+        double runTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        const R twoNorm = TwoNorm( A );
+        const double svdTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+            cout << "TwoNormEstimate: " << twoNormEst << " (" << runTime
+                 << " seconds)\n"
+                 << "TwoNorm:         " << twoNorm << " (" << svdTime
+                 << " seconds)\n"
+                 << "  relative error = " << (twoNorm-twoNormEst)/twoNorm
+                 << endl;
+
+        // One-norm condition estimate from an LU factorization
+        DistMatrix<C> B( g );
+        Uniform( B, n, n );
+        DistMatrix<C> BFact( B );
+        DistMatrix<int,VC,STAR> p( g );
+        LU( BFact, p );
+        startTime = mpi::Time();
+        const R luEst = LUConditionEstimate( B, BFact, p );
+        runTime = mpi::Time() - startTime;
+        DistMatrix<C> BInv( B );
+        Inverse( BInv );
+        const R luCond = OneNorm( B )*OneNorm( BInv );
+        const R twoCond = ConditionNumber( B );
+        if( commRank == 0 )
+            cout << "LUConditionEstimate: " << luEst << " (" << runTime
+                 << " seconds)\n"
+                 << "  kappa_1 from explicit inverse = " << luCond << "\n"
+                 << "  kappa_2 from SVD              = " << twoCond << endl;
+
+        // One-norm condition estimate from a Cholesky factorization
+        DistMatrix<C> H( g );
+        HermitianUniformSpectrum( H, n, minEig, 1 );
+        MakeHermitian( LOWER, H );
+        DistMatrix<C> HFact( H );
+        Cholesky( LOWER, HFact );
+        startTime = mpi::Time();
+        const R hpdEst = HPDConditionEstimate( LOWER, H, HFact );
+        runTime = mpi::Time() - startTime;
+        DistMatrix<C> HInv( H );
+        Inverse( HInv );
+        const R hpdCond = OneNorm( H )*OneNorm( HInv );
+        if( commRank == 0 )
+            cout << "HPDConditionEstimate: " << hpdEst << " (" << runTime
+                 << " seconds)\n"
+                 << "  kappa_1 from explicit inverse = " << hpdCond << "\n"
+                 << "  kappa_2                       = " << 1/minEig << endl;
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
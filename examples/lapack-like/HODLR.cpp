@@ -0,0 +1,145 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HODLR.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of kernel matrix",2000);
+        const R kappa = Input("--kappa","wavenumber of kernel",10.);
+        const R shift = Input("--shift","diagonal shift",2.);
+        const R tol = Input("--tol","relative compression tolerance",1e-8);
+        const int maxRank = Input("--maxRank","maximum off-diagonal rank",100);
+        const int leafSize = Input("--leafSize","maximum leaf size",64);
+        const int numRhs = Input("--numRhs","number of right-hand sides",10);
+        const bool dense = Input("--dense","compare against dense LU?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        // A(i,j) = exp(i kappa |x_i-x_j|) / (1 + n |x_i-x_j|) + shift delta_ij
+        // for the equispaced points x_i = i/n
+        Grid g( comm );
+        DistMatrix<C> A( g );
+        A.ResizeTo( n, n );
+        const int colShift = A.ColShift();
+        const int rowShift = A.RowShift();
+        const int colStride = A.ColStride();
+        const int rowStride = A.RowStride();
+        const int localHeight = A.LocalHeight();
+        const int localWidth = A.LocalWidth();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const int i = colShift + iLocal*colStride;
+                const R dist = R(Abs(i-j))/n;
+                C alpha = C(Cos(kappa*dist),Sin(kappa*dist))/(1+n*dist);
+                if( i == j )
+                    alpha += shift;
+                A.SetLocal( iLocal, jLocal, alpha );
+            }
+        }
+
+        double startTime = mpi::Time();
+        HODLR<C> H( A, tol, maxRank, leafSize );
+        double runTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+            cout << "Compression: " << runTime << " seconds\n"
+                 << "  levels = " << H.NumLevels() 
+                 << ", leaves = " << H.NumLeaves() 
+                 << ", maximum rank = " << H.MaxRank() << "\n"
+                 << "  entries relative to dense = " 
+                 << H.NumEntries()/(double(n)*n) << endl;
+
+        // Compare compressed and dense multiplication
+        DistMatrix<C> X( g ), Y( g ), YDense( g );
+        Uniform( X, n, numRhs );
+        const R frobX = FrobeniusNorm( X );
+        for( int orient=0; orient<3; ++orient )
+        {
+            const Orientation orientation = CharToOrientation
+                ( orient == 0 ? 'N' : ( orient == 1 ? 'T' : 'C' ) );
+            Zeros( Y, n, numRhs );
+            startTime = mpi::Time();
+            H.Multiply( orientation, C(1), X, C(0), Y );
+            runTime = mpi::Time() - startTime;
+            startTime = mpi::Time();
+            Gemm( orientation, NORMAL, C(1), A, X, YDense );
+            const double gemmTime = mpi::Time() - startTime;
+            const R frobY = FrobeniusNorm( YDense );
+            Axpy( C(-1), YDense, Y );
+            const R frobError = FrobeniusNorm( Y );
+            if( commRank == 0 )
+                cout << "Multiply(" << OrientationToChar(orientation) << "): "
+                     << runTime << " seconds (dense: " << gemmTime 
+                     << " seconds)\n"
+                     << "  || op(H) X - op(A) X ||_F / || op(A) X ||_F = "
+                     << frobError/frobY << endl;
+        }
+
+        // Solve against the compressed factorization
+        startTime = mpi::Time();
+        H.Factor();
+        runTime = mpi::Time() - startTime;
+        Y = X;
+        startTime = mpi::Time();
+        H.Solve( Y );
+        const double solveTime = mpi::Time() - startTime;
+        Gemm( NORMAL, NORMAL, C(-1), A, Y, C(1), X );
+        const R frobResid = FrobeniusNorm( X );
+        if( commRank == 0 )
+            cout << "Factor: " << runTime << " seconds\n"
+                 << "Solve:  " << solveTime << " seconds\n"
+                 << "  || B - A inv(H) B ||_F / || B ||_F = " 
+                 << frobResid/frobX << endl;
+
+        if( dense )
+        {
+            DistMatrix<int,VC,STAR> p( g );
+            startTime = mpi::Time();
+            LU( A, p );
+            runTime = mpi::Time() - startTime;
+            if( commRank == 0 )
+                cout << "Dense LU: " << runTime << " seconds" << endl;
+        }
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -34,9 +34,14 @@ main( int argc, char* argv[] )
         const int n = Input("--width","width of matrix",100);
         const int maxSteps = Input("--maxSteps","max # of steps of QR",10);
         const double tol = Input("--tol","tolerance for ID",-1.);
+        const int methodInt = 
+            Input("--method","0: Businger-Golub, 1: tournament, 2: strong",0);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
+        if( methodInt < 0 || methodInt > 2 )
+            throw std::logic_error("Invalid RRQR method");
+        const RRQRMethod method = static_cast<RRQRMethod>(methodInt);
 
         DistMatrix<C> A;
         Uniform( A, m, n );
@@ -47,7 +52,7 @@ main( int argc, char* argv[] )
         const Grid& g = A.Grid();
         DistMatrix<int,VR,STAR> p(g);
         DistMatrix<C,STAR,VR> Z(g);
-        ID( A, p, Z, maxSteps, tol );
+        ID( A, p, Z, maxSteps, tol, method );
         const int numSteps = p.Height();
         if( print )
         {
@@ -74,6 +79,8 @@ main( int argc, char* argv[] )
             DistMatrix<C,STAR,MR> Z_STAR_MR(g);
             hatA_MC_STAR.AlignWith( AR );
             Z_STAR_MR.AlignWith( AR );
+            hatA_MC_STAR = hatA;
+            Z_STAR_MR = Z;
             LocalGemm
             ( NORMAL, NORMAL, C(-1), hatA_MC_STAR, Z_STAR_MR, C(1), AR );
         }
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/lapack-like/HermitianSign.hpp"
+#include "elemental/lapack-like/HPSDSquareRoot.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Identity.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+class ExpFunctor {
+public:
+    R operator()( R alpha ) const { return Exp(alpha); }
+};
+
+// Return || X Y - Z ||_F / || Z ||_F
+R
+ProductError
+( const DistMatrix<C>& X, const DistMatrix<C>& Y, const DistMatrix<C>& Z )
+{
+    DistMatrix<C> E( Z );
+    Gemm( NORMAL, NORMAL, C(1), X, Y, C(-1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( Z );
+}
+
+// Return || A - B ||_F / || B ||_F
+R
+Difference( const DistMatrix<C>& A, const DistMatrix<C>& B )
+{
+    DistMatrix<C> E( A );
+    Axpy( C(-1), B, E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( B );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of Hermitian matrix",100);
+        const R minEig = Input("--minEig","minimum eigenvalue of H",0.01);
+        const int maxIts = Input("--maxIts","maximum number of iterations",100);
+        const bool progress = Input("--progress","print convergence?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+        DistMatrix<C> I( g );
+        Identity( I, n, n );
+
+        // An indefinite matrix for the sign function and a positive-definite
+        // matrix for the square root and exponential
+        DistMatrix<C> A( g ), H( g );
+        HermitianUniformSpectrum( A, n, -1, 1 );
+        HermitianUniformSpectrum( H, n, minEig, 1 );
+        MakeHermitian( LOWER, A );
+        MakeHermitian( LOWER, H );
+
+        const HermitianSignMethod signMethods[2] =
+            { SIGN_NEWTON, SIGN_NEWTON_SCHULZ };
+        const SquareRootMethod sqrtMethods[2] =
+            { SQRT_NEWTON, SQRT_NEWTON_SCHULZ };
+        const char* methodNames[2] = { "Newton", "Newton-Schulz" };
+        DistMatrix<C> S( g ), Y( g );
+        for( int method=0; method<2; ++method )
+        {
+            // || S^2 - I ||_F and || A S - S A ||_F measure the quality of S
+            S = A;
+            double startTime = mpi::Time();
+            int numIts =
+                HermitianSign
+                ( LOWER, S, signMethods[method], maxIts, progress );
+            double runTime = mpi::Time() - startTime;
+            const R signError = ProductError( S, S, I );
+            DistMatrix<C> SA( g );
+            Gemm( NORMAL, NORMAL, C(1), S, A, SA );
+            const R commuteError = ProductError( A, S, SA );
+            if( commRank == 0 )
+                cout << methodNames[method] << " sign: " << numIts
+                     << " iterations, " << runTime << " seconds\n"
+                     << "  || S^2 - I ||_F / || I ||_F       = " << signError
+                     << "\n"
+                     << "  || A S - S A ||_F / || S A ||_F = " << commuteError
+                     << endl;
+
+            Y = H;
+            startTime = mpi::Time();
+            numIts =
+                HPSDSquareRoot
+                ( LOWER, Y, sqrtMethods[method], maxIts, progress );
+            runTime = mpi::Time() - startTime;
+            const R sqrtError = ProductError( Y, Y, H );
+            if( commRank == 0 )
+                cout << methodNames[method] << " square root: " << numIts
+                     << " iterations, " << runTime << " seconds\n"
+                     << "  || Y^2 - H ||_F / || H ||_F = " << sqrtError << endl;
+        }
+
+        // exp(H) exp(-H) = I
+        DistMatrix<C> E( H ), EInv( H );
+        Scale( C(-1), EInv );
+        double startTime = mpi::Time();
+        const int degree =
+            RealHermitianFunction
+            ( LOWER, E, ExpFunctor(), FUNCTION_CHEBYSHEV, maxIts, progress );
+        const double runTime = mpi::Time() - startTime;
+        RealHermitianFunction
+        ( LOWER, EInv, ExpFunctor(), FUNCTION_CHEBYSHEV, maxIts, progress );
+        const R expError = ProductError( E, EInv, I );
+        if( commRank == 0 )
+            cout << "Chebyshev exponential: degree " << degree << ", "
+                 << runTime << " seconds\n"
+                 << "  || exp(H) exp(-H) - I ||_F / || I ||_F = " << expError
+                 << endl;
+
+#ifdef HAVE_PMRRR
+        // Compare against the eigensolver-based approaches
+        DistMatrix<C> SEig( A ), YEig( H ), EEig( H );
+        startTime = mpi::Time();
+        HermitianSign( LOWER, SEig, SIGN_EIG );
+        MakeHermitian( LOWER, SEig );
+        const double signTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        HPSDSquareRoot( LOWER, YEig, SQRT_EIG );
+        MakeHermitian( LOWER, YEig );
+        const double sqrtTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        RealHermitianFunction( LOWER, EEig, ExpFunctor(), FUNCTION_EIG );
+        MakeHermitian( LOWER, EEig );
+        const double expTime = mpi::Time() - startTime;
+        const R signDiff = Difference( S, SEig );
+        const R sqrtDiff = Difference( Y, YEig );
+        const R expDiff = Difference( E, EEig );
+        if( commRank == 0 )
+            cout << "Eigensolver-based approaches:\n"
+                 << "  sign: " << signTime << " seconds, relative difference "
+                 << signDiff << "\n"
+                 << "  square root: " << sqrtTime
+                 << " seconds, relative difference " << sqrtDiff << "\n"
+                 << "  exponential: " << expTime
+                 << " seconds, relative difference " << expDiff << endl;
+#endif
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
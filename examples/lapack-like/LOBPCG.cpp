@@ -0,0 +1,174 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+// Applies B^H B without forming it
+class GramOperator {
+public:
+    GramOperator( const DistMatrix<C>& B ) : B_(B) { }
+
+    void operator()( const DistMatrix<C>& X, DistMatrix<C>& Y ) const
+    {
+        DistMatrix<C> BX( B_.Grid() );
+        Gemm( NORMAL, NORMAL, C(1), B_, X, BX );
+        Gemm( ADJOINT, NORMAL, C(1), B_, BX, Y );
+    }
+
+private:
+    const DistMatrix<C>& B_;
+};
+
+// Return || A X - X diag(w) ||_F / || A X ||_F
+template<typename Operator>
+R
+ResidualError
+( const Operator& A, const DistMatrix<R,VR,STAR>& w, const DistMatrix<C>& X )
+{
+    DistMatrix<C> AX( X.Grid() ), XW( X );
+    A( X, AX );
+    DiagonalScale( RIGHT, NORMAL, w, XW );
+    const R normAX = FrobeniusNorm( AX );
+    Axpy( C(-1), XW, AX );
+    return FrobeniusNorm( AX ) / normAX;
+}
+
+// Return || I - X^H X ||_F
+R
+OrthogonalityError( const DistMatrix<C>& X )
+{
+    DistMatrix<C> E( X.Grid() );
+    Identity( E, X.Width(), X.Width() );
+    Herk( LOWER, ADJOINT, C(-1), X, C(1), E );
+    return HermitianFrobeniusNorm( LOWER, E );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of Hermitian matrix",500);
+        const int m = Input("--height","height of matrix for Gram operator",
+                            800);
+        const int k = Input("--numEigs","number of eigenpairs",8);
+        const R tol = Input("--tol","relative residual tolerance",0.);
+        const int maxIts = Input("--maxIts","maximum iterations",1000);
+        const bool progress = Input("--progress","print convergence?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+
+        // The smallest eigenpairs of an explicitly stored matrix
+        DistMatrix<C> H( g );
+        HermitianUniformSpectrum( H, n, 1, 10 );
+        MakeHermitian( LOWER, H );
+        DistMatrix<C> X( g );
+        DistMatrix<R,VR,STAR> w( g );
+        double startTime = mpi::Time();
+        int numIts =
+            hermitian_eig::LOBPCG
+            ( LOWER, H, w, X, k, false, tol, maxIts, progress );
+        double runTime = mpi::Time() - startTime;
+        hermitian_eig::HermitianOperator<C,DistMatrix<C> > HOp( LOWER, H );
+        R residError = ResidualError( HOp, w, X );
+        R orthogError = OrthogonalityError( X );
+        if( commRank == 0 )
+            cout << "LOBPCG for " << k << " smallest eigenpairs: " << numIts
+                 << " iterations, " << runTime << " seconds\n"
+                 << "  || H X - X W ||_F / || H X ||_F = " << residError
+                 << "\n"
+                 << "  || I - X^H X ||_F               = " << orthogError
+                 << endl;
+#ifdef HAVE_PMRRR
+        DistMatrix<C> HCopy( H ), Z( g );
+        DistMatrix<R,VR,STAR> wSubset( g );
+        startTime = mpi::Time();
+        HermitianEig( LOWER, HCopy, wSubset, Z, 0, k-1 );
+        runTime = mpi::Time() - startTime;
+        hermitian_eig::Sort( wSubset );
+        Axpy( R(-1), w, wSubset );
+        const R eigDiff = FrobeniusNorm( wSubset ) / FrobeniusNorm( w );
+        if( commRank == 0 )
+            cout << "Tridiagonal approach: " << runTime << " seconds\n"
+                 << "  relative difference in eigenvalues = " << eigDiff
+                 << endl;
+#endif
+
+        // The largest eigenpairs of the matrix-free operator B^H B
+        DistMatrix<C> B( g );
+        Uniform( B, m, n );
+        GramOperator BHB( B );
+        startTime = mpi::Time();
+        numIts =
+            hermitian_eig::LOBPCG
+            ( BHB, n, w, X, k, true, tol, maxIts, progress );
+        runTime = mpi::Time() - startTime;
+        residError = ResidualError( BHB, w, X );
+        orthogError = OrthogonalityError( X );
+        if( commRank == 0 )
+            cout << "Matrix-free LOBPCG for " << k << " largest eigenpairs: "
+                 << numIts << " iterations, " << runTime << " seconds\n"
+                 << "  || B^H B X - X W ||_F / || B^H B X ||_F = "
+                 << residError << "\n"
+                 << "  || I - X^H X ||_F                       = "
+                 << orthogError << endl;
+
+        // The eigenvalues of B^H B are the squares of the singular values of B
+        DistMatrix<R,VR,STAR> s( g );
+        SVD( B, s );
+        DistMatrix<R,VR,STAR> sTop( g );
+        View( sTop, s, 0, 0, k, 1 );
+        const int localHeight = sTop.LocalHeight();
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const R sigma = sTop.GetLocal(iLocal,0);
+            sTop.SetLocal( iLocal, 0, sigma*sigma );
+        }
+        Axpy( R(-1), w, sTop );
+        const R svdDiff = FrobeniusNorm( sTop ) / FrobeniusNorm( w );
+        if( commRank == 0 )
+            cout << "  relative difference from squared singular values = "
+                 << svdDiff << endl;
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
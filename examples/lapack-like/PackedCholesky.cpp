@@ -0,0 +1,138 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Her2k.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'R' and 'C' for convenience
+typedef double R;
+typedef Complex<R> C;
+
+// Return || tri(A) - tri(B) ||_F / || tri(B) ||_F, where A is packed
+R
+RelativeError
+( const PackedDistMatrix<C>& APacked, const DistMatrix<C>& B )
+{
+    DistMatrix<C> A( B.Grid() ), BTri( B );
+    APacked.Unpack( A );
+    MakeTriangular( APacked.Uplo(), BTri );
+    const R frobNormB = FrobeniusNorm( BTri );
+    Axpy( C(-1), BTri, A );
+    return FrobeniusNorm( A ) / frobNormB;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of HPD matrix",1000);
+        const int k = Input("--rank","rank of Herk update",200);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        const bool upper = Input("--upper","upper storage?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        Grid g( comm );
+        const UpperOrLower uplo = ( upper ? UPPER : LOWER );
+
+        DistMatrix<C> A( g );
+        HermitianUniformSpectrum( A, n, R(1), R(20) );
+        PackedDistMatrix<C> APacked( uplo, A );
+        const R localRatio =
+            R(APacked.LocalEntries()) / (A.LocalHeight()*A.LocalWidth());
+        if( commRank == 0 )
+            cout << "Packed local storage is " << localRatio
+                 << " of the full local storage" << endl;
+
+        // Redistribute the triangle to and from [VC,* ] and [* ,* ]
+        PackedDistMatrix<C,VC,STAR> A_VC_STAR( g );
+        PackedDistMatrix<C,STAR,STAR> A_STAR_STAR( g );
+        A_VC_STAR = APacked;
+        A_STAR_STAR = A_VC_STAR;
+        PackedDistMatrix<C> ACopy( g );
+        ACopy = A_STAR_STAR;
+        const R redistError = RelativeError( ACopy, A );
+        if( commRank == 0 )
+            cout << "Packed redistribution error: " << redistError << endl;
+
+        // Cholesky factorizations with full and packed storage
+        DistMatrix<C> L( A );
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        Cholesky( uplo, L );
+        mpi::Barrier( comm );
+        const double fullTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        Cholesky( APacked );
+        mpi::Barrier( comm );
+        const double packedTime = mpi::Time() - startTime;
+        const R cholError = RelativeError( APacked, L );
+        if( commRank == 0 )
+            cout << "Cholesky: full storage took " << fullTime
+                 << " seconds, packed storage took " << packedTime
+                 << " seconds\n"
+                 << "  || L_packed - L ||_F / || L ||_F = " << cholError
+                 << endl;
+
+        // Hermitian rank-k updates in both orientations
+        DistMatrix<C> B( g ), BAdj( g );
+        Uniform( B, n, k );
+        Uniform( BAdj, k, n );
+        for( int j=0; j<2; ++j )
+        {
+            const Orientation orientation = ( j==0 ? NORMAL : ADJOINT );
+            const DistMatrix<C>& X = ( j==0 ? B : BAdj );
+            DistMatrix<C> CFull( A );
+            PackedDistMatrix<C> CPacked( uplo, A );
+            Herk( uplo, orientation, C(-1), X, C(2), CFull );
+            Herk( orientation, C(-1), X, C(2), CPacked );
+            const R herkError = RelativeError( CPacked, CFull );
+
+            Her2k( uplo, orientation, C(3), X, X, C(1), CFull );
+            Her2k( orientation, C(3), X, X, C(1), CPacked );
+            const R her2kError = RelativeError( CPacked, CFull );
+            if( commRank == 0 )
+                cout << "Herk (" << OrientationToChar(orientation) << "): "
+                     << herkError << ", Her2k: " << her2kError << endl;
+        }
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,119 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'R' and 'C' for convenience
+typedef double R;
+typedef Complex<R> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",300);
+        const int n = Input("--width","width of matrix",200);
+        const int rank = Input("--rank","rank of approximation",10);
+        const int oversample = Input("--oversample","oversampling",10);
+        const int numPowerIts = Input("--powerIts","number of power its",1);
+        const R decay = Input("--decay","singular value decay rate",0.5);
+        const bool srht = Input("--srht","use an SRHT test matrix?",false);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+
+        // Build A := X diag(d) Y^H, where X and Y have orthonormal columns
+        // and the entries of d decay geometrically
+        const int minDim = min(m,n);
+        DistMatrix<C> X( g ), Y( g );
+        Uniform( X, m, minDim );
+        Uniform( Y, n, minDim );
+        qr::Explicit( X );
+        qr::Explicit( Y );
+        DistMatrix<R,VR,STAR> d( g );
+        d.ResizeTo( minDim, 1 );
+        for( int iLocal=0; iLocal<d.LocalHeight(); ++iLocal )
+        {
+            const int i = d.ColShift() + iLocal*d.ColStride();
+            d.SetLocal( iLocal, 0, Pow(decay,R(i)) );
+        }
+        DiagonalScale( RIGHT, NORMAL, d, X );
+        DistMatrix<C> A( g );
+        Gemm( NORMAL, ADJOINT, C(1), X, Y, A );
+        if( print )
+            A.Print("A");
+
+        // Compute the approximate truncated SVD
+        DistMatrix<C> U( g ), V( g );
+        DistMatrix<R,VR,STAR> s( g );
+        RandomizedSVD( A, U, s, V, rank, oversample, numPowerIts, srht );
+        if( print )
+        {
+            U.Print("U");
+            s.Print("s");
+            V.Print("V");
+        }
+
+        // Compare the singular values against the exact ones
+        R maxRelError = 0;
+        for( int i=0; i<rank; ++i )
+        {
+            const R exact = Pow(decay,R(i));
+            maxRelError = max( maxRelError, Abs(s.Get(i,0)-exact)/exact );
+        }
+
+        // The optimal rank-k approximation error is sqrt(sum_{i>=k} d_i^2)
+        R optimalError = 0;
+        for( int i=rank; i<minDim; ++i )
+            optimalError += Pow(decay,R(2*i));
+        optimalError = Sqrt( optimalError );
+        DiagonalScale( RIGHT, NORMAL, s, U );
+        Gemm( NORMAL, ADJOINT, C(-1), U, V, C(1), A );
+        const R frobError = FrobeniusNorm( A );
+
+        if( commRank == 0 )
+        {
+            cout << "max_i |s_i - sigma_i| / sigma_i = " << maxRelError << "\n"
+                 << "||A - U Sigma V^H||_F           = " << frobError << "\n"
+                 << "optimal rank-" << rank << " error           = "
+                 << optimalError << endl;
+        }
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
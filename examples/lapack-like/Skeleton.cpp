@@ -35,9 +35,14 @@ main( int argc, char* argv[] )
         const int n = Input("--width","width of matrix",100);
         const int maxSteps = Input("--maxSteps","max # of steps of QR",10);
         const double tol = Input("--tol","tolerance for ID",-1.);
+        const int methodInt = 
+            Input("--method","0: Businger-Golub, 1: tournament, 2: strong",0);
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
+        if( methodInt < 0 || methodInt > 2 )
+            throw std::logic_error("Invalid RRQR method");
+        const RRQRMethod method = static_cast<RRQRMethod>(methodInt);
 
         DistMatrix<C> A;
         Uniform( A, m, n );
@@ -48,7 +53,7 @@ main( int argc, char* argv[] )
         const Grid& g = A.Grid();
         DistMatrix<int,VR,STAR> pR(g), pC(g);
         DistMatrix<C> Z(g);
-        Skeleton( A, pR, pC, Z, maxSteps, tol );
+        Skeleton( A, pR, pC, Z, maxSteps, tol, method );
         const int numSteps = pR.Height();
         if( print )
         {
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/lapack-like/LeastSquares.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/SketchedLeastSquares.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+void
+Solve
+( SketchType type, const string& name,
+  const DistMatrix<C>& A, const DistMatrix<C>& B, const DistMatrix<C>& XQR,
+  double sketchFactor )
+{
+    const Grid& g = A.Grid();
+    mpi::Comm comm = g.Comm();
+    const int commRank = mpi::CommRank( comm );
+
+    DistMatrix<C> X( g );
+    mpi::Barrier( comm );
+    const double startTime = mpi::Time();
+    const int numIts = SketchedLeastSquares( A, B, X, type, sketchFactor );
+    mpi::Barrier( comm );
+    const double runTime = mpi::Time() - startTime;
+
+    Axpy( C(-1), XQR, X );
+    const R relError = FrobeniusNorm( X ) / FrobeniusNorm( XQR );
+    if( commRank == 0 )
+        cout << name << ": " << runTime << " seconds, " << numIts
+             << " iterations, ||X - X_QR||_F / ||X_QR||_F = " << relError
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",2000);
+        const int n = Input("--width","width of matrix",100);
+        const int numRhs = Input("--numRhs","# of right-hand sides",1);
+        const R decay = Input("--decay","column scaling decay rate",0.9);
+        const double sketchFactor = Input("--sketchFactor","rows per column",4.);
+        const double countFactor =
+            Input("--countFactor","rows per column for CountSketch",20.);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+
+        // Build an ill-conditioned A by geometrically scaling the columns of a
+        // random matrix, and a right-hand side outside of its range
+        DistMatrix<C> A( g ), B( g );
+        Uniform( A, m, n );
+        DistMatrix<R,VR,STAR> d( g );
+        d.ResizeTo( n, 1 );
+        for( int iLocal=0; iLocal<d.LocalHeight(); ++iLocal )
+        {
+            const int i = d.ColShift() + iLocal*d.ColStride();
+            d.SetLocal( iLocal, 0, Pow(decay,R(i)) );
+        }
+        DiagonalScale( RIGHT, NORMAL, d, A );
+        Uniform( B, m, numRhs );
+
+        // Solve with Householder QR for reference
+        DistMatrix<C> ACopy( A ), XQR( g );
+        mpi::Barrier( comm );
+        const double startTime = mpi::Time();
+        LeastSquares( NORMAL, ACopy, B, XQR );
+        mpi::Barrier( comm );
+        const double runTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+            cout << "Householder QR: " << runTime << " seconds" << endl;
+
+        Solve( GAUSSIAN_SKETCH, "Gaussian sketch", A, B, XQR, sketchFactor );
+        Solve( SRHT_SKETCH, "SRHT sketch", A, B, XQR, sketchFactor );
+        Solve( COUNT_SKETCH, "CountSketch", A, B, XQR, countFactor );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
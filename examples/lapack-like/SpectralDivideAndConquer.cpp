@@ -0,0 +1,158 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/SVD.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Typedef our real and complex types to 'R' and 'C' for convenience
+typedef double R;
+typedef Complex<R> C;
+
+// Return || I - Q^H Q ||_F
+R
+OrthogonalityError( const DistMatrix<C>& Q )
+{
+    DistMatrix<C> E( Q.Grid() );
+    Identity( E, Q.Width(), Q.Width() );
+    Herk( LOWER, ADJOINT, C(-1), Q, C(1), E );
+    return HermitianFrobeniusNorm( LOWER, E );
+}
+
+// Return || A - U diag(s) V^H ||_F / || A ||_F
+R
+DecompositionError
+( const DistMatrix<C>& A, const DistMatrix<C>& U,
+  const DistMatrix<R,VR,STAR>& s, const DistMatrix<C>& V )
+{
+    DistMatrix<C> US( U ), E( A );
+    DiagonalScale( RIGHT, NORMAL, s, US );
+    Gemm( NORMAL, ADJOINT, C(-1), US, V, C(1), E );
+    return FrobeniusNorm( E ) / FrobeniusNorm( A );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of Hermitian matrix",300);
+        const int m = Input("--height","height of general matrix",400);
+        const int cutoff = Input("--cutoff","size of base-case problems",64);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+
+        // Compute the eigenvalue decomposition of a random Hermitian matrix
+        DistMatrix<C> H( g ), A( g );
+        Uniform( H, n, n );
+        MakeHermitian( LOWER, H );
+        A = H;
+        DistMatrix<C> Z( g );
+        DistMatrix<R,VR,STAR> w( g );
+        double startTime = mpi::Time();
+        HermitianEig( LOWER, A, w, Z, EIG_QDWH, cutoff );
+        double runTime = mpi::Time() - startTime;
+        if( print )
+        {
+            w.Print("w");
+            Z.Print("Z");
+        }
+        const R eigError = DecompositionError( H, Z, w, Z );
+        const R eigOrthogError = OrthogonalityError( Z );
+        if( commRank == 0 )
+            cout << "QDWH-eig: " << runTime << " seconds\n"
+                 << "  || H - Z W Z^H ||_F / || H ||_F = " << eigError << "\n"
+                 << "  || I - Z^H Z ||_F               = " << eigOrthogError
+                 << endl;
+#ifdef HAVE_PMRRR
+        A = H;
+        DistMatrix<R,VR,STAR> wTridiag( g );
+        startTime = mpi::Time();
+        HermitianEig( LOWER, A, wTridiag, Z, EIG_TRIDIAG );
+        runTime = mpi::Time() - startTime;
+        hermitian_eig::Sort( wTridiag );
+        Axpy( R(-1), w, wTridiag );
+        const R eigDiff = FrobeniusNorm( wTridiag ) / FrobeniusNorm( w );
+        if( commRank == 0 )
+            cout << "Tridiagonal approach: " << runTime << " seconds\n"
+                 << "  relative difference in eigenvalues = " << eigDiff
+                 << endl;
+#endif
+
+        // Compute the SVD of a random general matrix
+        DistMatrix<C> B( g ), U( g ), V( g );
+        Uniform( B, m, n );
+        U = B;
+        DistMatrix<R,VR,STAR> s( g );
+        startTime = mpi::Time();
+        SVD( U, s, V, SVD_QDWH, cutoff );
+        runTime = mpi::Time() - startTime;
+        if( print )
+        {
+            s.Print("s");
+            U.Print("U");
+            V.Print("V");
+        }
+        const R svdError = DecompositionError( B, U, s, V );
+        const R UOrthogError = OrthogonalityError( U );
+        const R VOrthogError = OrthogonalityError( V );
+        if( commRank == 0 )
+            cout << "QDWH-SVD: " << runTime << " seconds\n"
+                 << "  || B - U S V^H ||_F / || B ||_F = " << svdError << "\n"
+                 << "  || I - U^H U ||_F               = " << UOrthogError
+                 << "\n"
+                 << "  || I - V^H V ||_F               = " << VOrthogError
+                 << endl;
+
+        U = B;
+        DistMatrix<R,VR,STAR> sBidiag( g );
+        startTime = mpi::Time();
+        SVD( U, sBidiag, V, SVD_BIDIAG );
+        runTime = mpi::Time() - startTime;
+        Axpy( R(-1), s, sBidiag );
+        const R svdDiff = FrobeniusNorm( sBidiag ) / FrobeniusNorm( s );
+        if( commRank == 0 )
+            cout << "Bidiagonal approach: " << runTime << " seconds\n"
+                 << "  relative difference in singular values = " << svdDiff
+                 << endl;
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
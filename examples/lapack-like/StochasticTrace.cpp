@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/StochasticTrace.hpp"
+#include "elemental/lapack-like/Trace.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of HPD matrix",1000);
+        const R minEig = Input("--minEig","minimum eigenvalue",0.01);
+        const int numSteps = Input("--numSteps","number of Lanczos steps",30);
+        const R relTol = Input("--relTol","relative standard error",0.001);
+        const int blockSize = Input("--blockSize","probes per block",16);
+        const int maxProbes = Input("--maxProbes","maximum number of probes",
+                                    1024);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+        DistMatrix<C> A( g );
+        HermitianUniformSpectrum( A, n, minEig, 1 );
+        MakeHermitian( LOWER, A );
+
+        // Hutchinson's estimator for the trace
+        hermitian_eig::HermitianOperator<C,DistMatrix<C> > op( LOWER, A );
+        double startTime = mpi::Time();
+        TraceEstimate<R> traceEst =
+            stochastic_trace::Hutchinson<C>
+            ( op, n, g, relTol, blockSize, maxProbes, progress );
+        double runTime = mpi::Time() - startTime;
+        const R trace = RealPart(Trace( A ));
+        if( commRank == 0 )
+            cout << "Hutchinson trace estimate: " << traceEst.value
+                 << " +- " << traceEst.stdError << " with "
+                 << traceEst.numProbes << " probes, " << runTime
+                 << " seconds\n"
+                 << "  exact trace = " << trace << ", relative error = "
+                 << Abs(traceEst.value-trace)/Abs(trace) << endl;
+
+        // Stochastic Lanczos quadrature for the log-determinant
+        startTime = mpi::Time();
+        TraceEstimate<R> logDetEst =
+            HPDLogDetEstimate
+            ( LOWER, A, numSteps, relTol, blockSize, maxProbes, progress );
+        runTime = mpi::Time() - startTime;
+        startTime = mpi::Time();
+        SafeProduct<C> safeDet = SafeHPDDeterminant( LOWER, A );
+        const double cholTime = mpi::Time() - startTime;
+        const R logDet = safeDet.kappa*safeDet.n;
+        if( commRank == 0 )
+            cout << "Lanczos quadrature log-det estimate: " << logDetEst.value
+                 << " +- " << logDetEst.stdError << " with "
+                 << logDetEst.numProbes << " probes, " << runTime
+                 << " seconds\n"
+                 << "  Cholesky log-det = " << logDet << " (" << cholTime
+                 << " seconds), relative error = "
+                 << Abs(logDetEst.value-logDet)/Abs(logDet) << endl;
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
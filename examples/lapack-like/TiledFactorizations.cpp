@@ -0,0 +1,160 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level1/SetDiagonal.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/ApplyRowPivots.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/TriangularInverse.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+typedef double Real;
+
+// Time the sequential factorizations of an n x n matrix, which are run as task
+// graphs over tiles whenever there are enough tiles for the available OpenMP
+// threads, and return their rates in GFlops along with the relative residuals
+//
+//   Cholesky:           ||A - L L^H||_F / ||A||_F,
+//   LU:                 ||P A - L U||_F / ||A||_F,
+//   QR:                 ||A^H A - R^H R||_F / ||A||_F^2, and
+//   TriangularInverse:  ||I - L inv(L)||_F / (||L||_F ||inv(L)||_F)
+//
+void
+TimeFactorizations
+( int n, double* rates, Real* residuals )
+{
+    Matrix<Real> A, B, L, U, E;
+    Matrix<int> p;
+    const double nCubed = double(n)*double(n)*double(n);
+
+    HermitianUniformSpectrum( A, n, 1, 10 );
+    B = A;
+    double startTime = mpi::Time();
+    Cholesky( LOWER, B );
+    rates[0] = nCubed/(3.*(mpi::Time()-startTime)*1.e9);
+    MakeTriangular( LOWER, B );
+    E = A;
+    Gemm( NORMAL, ADJOINT, Real(-1), B, B, Real(1), E );
+    residuals[0] = FrobeniusNorm( E ) / FrobeniusNorm( A );
+
+    Uniform( A, n, n );
+    B = A;
+    startTime = mpi::Time();
+    LU( B, p );
+    rates[1] = 2.*nCubed/(3.*(mpi::Time()-startTime)*1.e9);
+    L = B;
+    MakeTriangular( LOWER, L );
+    SetDiagonal( L, Real(1) );
+    U = B;
+    MakeTriangular( UPPER, U );
+    E = A;
+    ApplyRowPivots( E, p );
+    Gemm( NORMAL, NORMAL, Real(-1), L, U, Real(1), E );
+    residuals[1] = FrobeniusNorm( E ) / FrobeniusNorm( A );
+
+    B = A;
+    startTime = mpi::Time();
+    QR( B );
+    rates[2] = 4.*nCubed/(3.*(mpi::Time()-startTime)*1.e9);
+    MakeTriangular( UPPER, B );
+    Zeros( E, n, n );
+    Gemm( ADJOINT, NORMAL, Real(1), A, A, Real(0), E );
+    Gemm( ADJOINT, NORMAL, Real(-1), B, B, Real(1), E );
+    const Real frobA = FrobeniusNorm( A );
+    residuals[2] = FrobeniusNorm( E ) / (frobA*frobA);
+
+    MakeTriangular( LOWER, A );
+    for( int j=0; j<n; ++j )
+        A.Update( j, j, Real(n) );
+    B = A;
+    startTime = mpi::Time();
+    TriangularInverse( LOWER, NON_UNIT, B );
+    rates[3] = nCubed/(3.*(mpi::Time()-startTime)*1.e9);
+    Identity( E, n, n );
+    Gemm( NORMAL, NORMAL, Real(-1), A, B, Real(1), E );
+    residuals[3] = 
+        FrobeniusNorm( E ) / (FrobeniusNorm( A )*FrobeniusNorm( B ));
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of matrices",2000);
+        const int tileSize = Input("--tile","size of tiles",TileSize());
+        const int maxThreads = Input
+            ("--maxThreads","max number of threads",TaskGraph::NumThreads());
+        ProcessInput();
+        PrintInputReport();
+
+        SetTileSize( tileSize );
+        if( commRank == 0 )
+            cout << "threads  Cholesky  LU  QR  TriangularInverse (GFlops)"
+                 << endl;
+        for( int numThreads=1; numThreads<=maxThreads; numThreads*=2 )
+        {
+#ifdef HAVE_OPENMP
+            omp_set_num_threads( numThreads );
+#else
+            if( numThreads > 1 )
+                break;
+#endif
+            double rates[4];
+            Real residuals[4];
+            TimeFactorizations( n, rates, residuals );
+            if( commRank == 0 )
+            {
+                cout << numThreads << "  " << rates[0] << "  " << rates[1] 
+                     << "  " << rates[2] << "  " << rates[3] << "\n"
+                     << "   relative residuals: " << residuals[0] << "  " 
+                     << residuals[1] << "  " << residuals[2] << "  " 
+                     << residuals[3] << endl;
+                const char* names[4] = 
+                    { "Cholesky", "LU", "QR", "TriangularInverse" };
+                const Real tol = n*lapack::MachineEpsilon<Real>();
+                for( int k=0; k<4; ++k )
+                    if( residuals[k] > tol )
+                        cout << "   WARNING: the " << names[k] << " residual "
+                             << "is larger than n eps = " << tol << endl;
+            }
+        }
+    }
+    catch( ArgException& e )
+    {
+        // There is nothing to do
+    }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught exception with message: "
+           << e.what() << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/TwoEstimate.hpp"
+#include "elemental/lapack-like/StochasticTrace.hpp"
+#include "elemental/matrices/Cauchy.hpp"
+#include "elemental/matrices/CauchyLike.hpp"
+#include "elemental/matrices/Hilbert.hpp"
+#include "elemental/matrices/Kahan.hpp"
+#include "elemental/matrices/KMS.hpp"
+#include "elemental/matrices/Lehmer.hpp"
+#include "elemental/matrices/MinIJ.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+// Compare the matrix-free application of each form of the operator, to
+// both [MC,MR] and [VC,* ] blocks, against products with its explicit form
+template<typename T,class Operator>
+void
+TestOperator
+( const Operator& A, const std::string& name, int numRhs, const Grid& g )
+{
+    const int commRank = mpi::CommRank( g.Comm() );
+    DistMatrix<T> AExplicit( g );
+    A.Materialize( AExplicit );
+    const char orientations[3] = { 'N', 'T', 'C' };
+    for( int k=0; k<3; ++k )
+    {
+        const Orientation orientation = CharToOrientation( orientations[k] );
+        const int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+        const int width = ( orientation == NORMAL ? A.Width() : A.Height() );
+        DistMatrix<T> X( g ), Y( g ), YExplicit( g );
+        Uniform( X, width, numRhs );
+        Zeros( Y, height, numRhs );
+        mpi::Barrier( g.Comm() );
+        double startTime = mpi::Time();
+        A.Multiply( orientation, T(1), X, T(0), Y );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        Gemm( orientation, NORMAL, T(1), AExplicit, X, YExplicit );
+        const R frobY = FrobeniusNorm( YExplicit );
+
+        DistMatrix<T,VC,STAR> X_VC_STAR( X ), Y_VC_STAR( g );
+        Zeros( Y_VC_STAR, height, numRhs );
+        A.Multiply( orientation, T(1), X_VC_STAR, T(0), Y_VC_STAR );
+        DistMatrix<T> YFromVC( g );
+        YFromVC = Y_VC_STAR;
+
+        Axpy( T(-1), YExplicit, Y );
+        Axpy( T(-1), YExplicit, YFromVC );
+        const R frobError = FrobeniusNorm( Y );
+        const R frobErrorVC = FrobeniusNorm( YFromVC );
+        if( commRank == 0 )
+            std::cout << name << " (" << orientations[k] << "): "
+                      << runTime << " seconds\n"
+                      << "  [MC,MR]: || E ||_F / || op(A) X ||_F = "
+                      << frobError/frobY << "\n"
+                      << "  [VC,* ]: || E ||_F / || op(A) X ||_F = "
+                      << frobErrorVC/frobY << std::endl;
+    }
+
+    const R estimate = TwoNormEstimate<T>( A, g );
+    const R explicitEstimate = TwoNormEstimate( AExplicit );
+    if( commRank == 0 )
+        std::cout << "  TwoNormEstimate: " << estimate
+                  << " (explicit: " << explicitEstimate << ")\n" << std::endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int n = Input("--size","size of explicitly tested matrices",500);
+        const int numRhs = Input("--numRhs","number of vectors",20);
+        const int largeN =
+            Input("--largeSize","size of the matrix-free only tests",10000);
+        const int nb = Input("--nb","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        SetBlocksize( nb );
+        Grid g( comm );
+
+        std::vector<R> x( n ), y( n ), r( n ), s( n );
+        for( int j=0; j<n; ++j )
+        {
+            x[j] = j+R(1)/2;
+            y[j] = -j;
+            r[j] = Cos(R(j));
+            s[j] = Sin(R(j));
+        }
+        HilbertOperator<R> hilbert( n );
+        TestOperator<R>( hilbert, "Hilbert", numRhs, g );
+        CauchyOperator<R> cauchy( x, y );
+        TestOperator<R>( cauchy, "Cauchy", numRhs, g );
+        CauchyLikeOperator<R> cauchyLike( r, s, x, y );
+        TestOperator<R>( cauchyLike, "CauchyLike", numRhs, g );
+        KahanOperator<R> kahan( n, R(0.3) );
+        TestOperator<R>( kahan, "Kahan", numRhs, g );
+        LehmerOperator<R> lehmer( n );
+        TestOperator<R>( lehmer, "Lehmer", numRhs, g );
+        MinIJOperator<R> minIJ( n );
+        TestOperator<R>( minIJ, "MinIJ", numRhs, g );
+        KMSOperator<C> kms( n, C(R(0.5),R(0.3)) );
+        TestOperator<C>( kms, "KMS", numRhs, g );
+
+        // Matrices which are never formed
+        if( largeN > 0 )
+        {
+            double startTime = mpi::Time();
+            HilbertOperator<R> largeHilbert( largeN );
+            const R hilbertNorm = TwoNormEstimate<R>( largeHilbert, g );
+            double runTime = mpi::Time() - startTime;
+            if( commRank == 0 )
+                std::cout << largeN << " x " << largeN << " Hilbert: "
+                          << "|| A ||_2 ~= " << hilbertNorm << " ("
+                          << runTime << " seconds)" << std::endl;
+
+            startTime = mpi::Time();
+            MinIJOperator<R> largeMinIJ( largeN );
+            TraceEstimate<R> trace =
+                stochastic_trace::Hutchinson<R>( largeMinIJ, largeN, g, 0.05 );
+            runTime = mpi::Time() - startTime;
+            if( commRank == 0 )
+                std::cout << largeN << " x " << largeN << " MinIJ: "
+                          << "tr(A) ~= " << trace.value << " +- "
+                          << trace.stdError << " with " << trace.numProbes
+                          << " probes (exact: "
+                          << R(largeN)*R(largeN+1)/2 << ", "
+                          << runTime << " seconds)" << std::endl;
+        }
+    }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Circulant.hpp"
+#include "elemental/matrices/DiscreteFourier.hpp"
+#include "elemental/matrices/Hankel.hpp"
+#include "elemental/matrices/Toeplitz.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace elem;
+
+typedef double R;
+typedef Complex<R> C;
+
+// Compare the implicit application of each form of the operator against
+// a product with its explicit form
+template<typename T,class Operator>
+void
+TestOperator
+( const Operator& A, const std::string& name, int numRhs, bool materialize, 
+  const Grid& g )
+{
+    const int commRank = mpi::CommRank( g.Comm() );
+    DistMatrix<T> AExplicit( g );
+    if( materialize )
+        A.Materialize( AExplicit );
+    const char orientations[3] = { 'N', 'T', 'C' };
+    for( int k=0; k<3; ++k )
+    {
+        const Orientation orientation = CharToOrientation( orientations[k] );
+        const int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+        const int width = ( orientation == NORMAL ? A.Width() : A.Height() );
+        DistMatrix<T> X( g ), Y( g );
+        Uniform( X, width, numRhs );
+        Zeros( Y, height, numRhs );
+        mpi::Barrier( g.Comm() );
+        double startTime = mpi::Time();
+        A.Multiply( orientation, T(1), X, T(0), Y );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        if( commRank == 0 )
+            std::cout << name << " (" << orientations[k] << "): " 
+                      << runTime << " seconds" << std::endl;
+        if( materialize )
+        {
+            DistMatrix<T> YExplicit( g );
+            startTime = mpi::Time();
+            Gemm( orientation, NORMAL, T(1), AExplicit, X, YExplicit );
+            const double gemmTime = mpi::Time() - startTime;
+            const R frobY = FrobeniusNorm( YExplicit );
+            Axpy( T(-1), YExplicit, Y );
+            const R frobError = FrobeniusNorm( Y );
+            if( commRank == 0 )
+                std::cout << "  dense: " << gemmTime << " seconds, "
+                          << "|| E ||_F / || op(A) X ||_F = " 
+                          << frobError/frobY << std::endl;
+        }
+    }
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrices",1000);
+        const int n = Input("--width","width of matrices",700);
+        const int numRhs = Input("--numRhs","number of vectors",100);
+        const bool materialize = 
+            Input("--materialize","compare against explicit matrices?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        Grid g( comm );
+        const int length = m+n-1;
+        std::vector<R> aReal( length );
+        std::vector<C> a( length );
+        for( int j=0; j<length; ++j )
+        {
+            aReal[j] = Sin(R(j));
+            a[j] = C(Cos(R(3*j)/10),Sin(R(7*j)/10));
+        }
+
+        ToeplitzOperator<R> toeplitzReal( m, n, aReal );
+        TestOperator<R>( toeplitzReal, "Real Toeplitz", numRhs, materialize, g );
+        ToeplitzOperator<C> toeplitz( m, n, a );
+        TestOperator<C>( toeplitz, "Toeplitz", numRhs, materialize, g );
+        HankelOperator<C> hankel( m, n, a );
+        TestOperator<C>( hankel, "Hankel", numRhs, materialize, g );
+        std::vector<C> c( a.begin(), a.begin()+n );
+        CirculantOperator<C> circulant( c );
+        TestOperator<C>( circulant, "Circulant", numRhs, materialize, g );
+        DiscreteFourierOperator<R> fourier( n );
+        TestOperator<C>
+        ( fourier, "DiscreteFourier", numRhs, materialize, g );
+    }
+    catch( std::exception& e )
+    {
+        std::ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << std::endl;
+        std::cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}
@@ -169,8 +169,8 @@ int PMRRR(char *jobz, char *range, int *n, double  *D,
  */
 
 
-/* Set the number of threads in case PMR_NUM_THREADS is not 
- * specified */
+/* Set the number of threads in case neither PMR_set_num_threads 
+ * nor PMR_NUM_THREADS specify it */
 #define DEFAULT_NUM_THREADS 1
 
 /* Call LAPACK's dstemr in every process to compute all desiered 
@@ -241,6 +241,20 @@ int PMR_comm_eigvals(MPI_Comm comm, int *nz, int *ifirst, double *W);
  *
  */
 
+
+/* Set the number of threads used by subsequent calls to 'PMRRR';
+ * a non-positive value restores the default behavior of reading 
+ * PMR_NUM_THREADS (or using DEFAULT_NUM_THREADS if it is not set).
+ * Threads are only used if MPI provides MPI_THREAD_FUNNELED or 
+ * MPI_THREAD_MULTIPLE support. */
+void PMR_set_num_threads(int nthreads);
+int  PMR_get_num_threads(void);
+
+/* The worker threads are kept alive between calls to 'PMRRR' so that 
+ * they need not be recreated for every call; this routine joins and 
+ * frees them, and must not be called while 'PMRRR' is running. */
+void PMR_free_thread_pool(void);
+
 /* 
  * BLAS/LAPACK function prototypes
  * 
@@ -0,0 +1,37 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#ifndef TTHREAD_POOL_H
+#define TTHREAD_POOL_H
+
+#include <pthread.h>
+#include "global.h"
+
+/* 
+ * A persistent pool of worker threads which replaces the pthread_create/
+ * pthread_join pairs in plarre and plarrv, so that the threads are only
+ * created during the first call to PMRRR (and whenever more threads are
+ * requested than were previously needed) rather than during every call.
+ *
+ * Each spawned task is handed to its own worker, which is created if no
+ * idle worker exists, so that all of the tasks of a call run concurrently,
+ * exactly as they would have with pthread_create. This is necessary since
+ * the tasks in plarrv cooperate through a shared work queue.
+ */
+
+typedef struct PMR_worker_s PMR_worker_t;
+
+/* Run func(arg) on an idle worker and return a handle for joining it */
+int PMR_pool_spawn(PMR_worker_t **handle, void *(*func)(void *), void *arg);
+
+/* Wait for the task to finish, return its result in status, and
+ * release the worker back to the pool */
+int PMR_pool_join(PMR_worker_t *handle, void **status);
+
+#endif /* TTHREAD_POOL_H */
@@ -54,6 +54,7 @@
 #include "plarre.h"
 #include "global.h"
 #include "structs.h" 
+#include "thread_pool.h"
 
 
 #define ONE                1.0
@@ -398,8 +399,7 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
   /* Multithreading */
   int            nthreads;
   int            iifirst, iilast, chunk;
-  pthread_t      *threads;
-  pthread_attr_t attr;
+  PMR_worker_t   **threads;
   auxarg1_t      *auxarg1;
   auxarg2_t      *auxarg2;
   void           *status;
@@ -437,14 +437,8 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
   randvec = (double *) malloc( 2*n * sizeof(double) );
   assert(randvec != NULL);
 
-  threads = (pthread_t *) malloc( max_nthreads * sizeof(pthread_t) );
+  threads = (PMR_worker_t **) malloc( max_nthreads * sizeof(PMR_worker_t *) );
   assert(threads != NULL);
-  
-  if (max_nthreads > 1) {
-    pthread_attr_init(&attr);
-    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-    pthread_attr_setscope(&attr, PTHREAD_SCOPE_SYSTEM);
-  }
 
   /* Set tolerance parameters */
   bsrtol = sqrt(DBL_EPSILON);
@@ -483,8 +477,7 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
 			       nsplit, isplit, bsrtol, pivmin, gersch,
 			       &work[0], &work[n], &iwork[n], &iwork[0]);
 
-      info = pthread_create(&threads[i], &attr,
-			    eigval_subset_thread_a,
+      info = PMR_pool_spawn(&threads[i], eigval_subset_thread_a,
 			    (void *) auxarg1);
       assert(info == 0);
 
@@ -501,7 +494,7 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
 
     /* join threads */
     for (i=1; i<nthreads; i++) {
-      info = pthread_join(threads[i], &status);
+      info = PMR_pool_join(threads[i], &status);
       assert(info == 0 && status == NULL);
     }
 
@@ -771,8 +764,7 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
 				 tolstruct->rtol1, tolstruct->rtol2,
 				 pivmin, spdiam);
 	
-	info = pthread_create(&threads[i], &attr,
-			      eigval_subset_thread_r,
+	info = PMR_pool_spawn(&threads[i], eigval_subset_thread_r,
 			      (void *) auxarg2);
 	assert(info == 0);
 	
@@ -791,7 +783,7 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
     
       /* join threads */
       for (i=1; i<nthreads; i++) {
-	info = pthread_join(threads[i], &status);
+	info = PMR_pool_join(threads[i], &status);
 	assert(info == 0 && status == NULL);
       }
       /* should update gaps at splitting points here, but the gaps
@@ -829,10 +821,6 @@ int eigval_subset_proc(proc_t *procinfo, char *range, in_t *Dstruct,
   free(randvec);
   free(threads);
 
-  if (max_nthreads > 1) {
-    pthread_attr_destroy(&attr);
-  }
-
   return(0);
 }
 
@@ -56,6 +56,7 @@
 #include "queue.h"
 #include "structs.h"
 #include "counter.h"
+#include "thread_pool.h"
 
 
 static int assign_to_proc(proc_t *procinfo, in_t *Dstruct,
@@ -92,8 +93,7 @@ int plarrv(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
   double         *Wshifted;
  
   /* Multi-threading */
-  pthread_t      *threads;   
-  pthread_attr_t attr;
+  PMR_worker_t   **threads;   
   void           *status;
   auxarg3_t      *auxarg;
   counter_t      *num_left;
@@ -109,7 +109,7 @@ int plarrv(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
   memcpy(Wshifted, W, n*sizeof(double));
   Wstruct->Wshifted = Wshifted;
 
-  threads = (pthread_t *) malloc(nthreads * sizeof(pthread_t));
+  threads = (PMR_worker_t **) malloc(nthreads * sizeof(PMR_worker_t *));
   assert(threads != NULL);
 
   /* Assign eigenvectors to processes */
@@ -120,16 +120,13 @@ int plarrv(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
   workQ    = create_workQ( );
   num_left = PMR_create_counter(*nzp);
 
-  threads[0] = pthread_self();
-  pthread_attr_init(&attr);
-  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
-  pthread_attr_setscope(&attr, PTHREAD_SCOPE_SYSTEM); 
-
+  /* The calling thread empties the queue as thread 0, the others are
+   * taken from the persistent pool */
+  threads[0] = NULL;
   for (i=1; i<nthreads; i++) {
     auxarg = create_auxarg3(i, procinfo, Wstruct, Zstruct, tolstruct,
 			    workQ, num_left);
-    info = pthread_create(&threads[i], &attr, empty_workQ, 
-			  (void *) auxarg);
+    info = PMR_pool_spawn(&threads[i], empty_workQ, (void *) auxarg);
     assert(info == 0);
   }
 
@@ -145,14 +142,13 @@ int plarrv(proc_t *procinfo, in_t *Dstruct, val_t *Wstruct,
 
   /* Join all the worker thread */
   for (i=1; i<nthreads; i++) {
-    info = pthread_join(threads[i], &status);
+    info = PMR_pool_join(threads[i], &status);
     assert(info == 0 && status == NULL);
   }
   
   /* Clean up */
   free(Wshifted);
   free(threads);
-  pthread_attr_destroy(&attr);
   destroy_workQ(workQ);
   PMR_destroy_counter(num_left);
 
@@ -59,6 +59,9 @@
 #include "structs.h"
 
 
+/* Number of threads requested through PMR_set_num_threads */
+static int requested_nthreads = 0;
+
 static int handle_small_cases(char*, char*, int*, double*, double*,
 			      double*, double*, int*, int*, int*,
 			      MPI_Comm, int*, int*, double*, double*,
@@ -112,7 +115,6 @@ int PMRRR(char *jobz, char *range, int *np, double  *D,
 
   /* Multiprocessing and multithreading */
   int         nproc, pid, nthreads;             
-  char        *ompvar;
   MPI_Comm    comm_dup;
   int         thread_support;
 
@@ -143,12 +145,7 @@ int PMRRR(char *jobz, char *range, int *np, double  *D,
      * is not supported at the moment */
     nthreads = 1;
   } else {
-    ompvar = getenv("PMR_NUM_THREADS");
-    if (ompvar == NULL) {
-      nthreads = DEFAULT_NUM_THREADS;
-    } else {
-      nthreads = atoi(ompvar);
-    }
+    nthreads = PMR_get_num_threads();
   }
 
   /* If only maximal number of local eigenvectors are queried
@@ -970,6 +967,37 @@ int PMR_comm_eigvals(MPI_Comm comm, int *nz, int *myfirstp, double *W)
 
 
 
+/*
+ * Routines to set and query the number of threads used by 'PMRRR';
+ * the value set programmatically takes precedence over the 
+ * environment variable PMR_NUM_THREADS.
+ */
+void PMR_set_num_threads(int nthreads)
+{
+  requested_nthreads = nthreads;
+}
+
+int PMR_get_num_threads(void)
+{
+  char *ompvar;
+  int  nthreads;
+
+  if (requested_nthreads > 0)
+    return(requested_nthreads);
+
+  ompvar = getenv("PMR_NUM_THREADS");
+  if (ompvar == NULL) {
+    nthreads = DEFAULT_NUM_THREADS;
+  } else {
+    nthreads = atoi(ompvar);
+  }
+
+  return(imax(nthreads, 1));
+}
+
+
+
+
 /* Fortran function prototype */
 void pmrrr_(char *jobz, char *range, int *n, double  *D,
 	    double *E, double *vl, double *vu, int *il, int *iu,
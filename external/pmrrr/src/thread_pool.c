@@ -0,0 +1,156 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <assert.h>
+#include "global.h"
+#include "pmrrr.h"
+#include "thread_pool.h"
+
+#define WORKER_IDLE 0
+#define WORKER_BUSY 1
+#define WORKER_DONE 2
+
+struct PMR_worker_s {
+  pthread_t            thread;
+  pthread_cond_t       cond;
+  void               *(*func)(void *);
+  void                *arg;
+  void                *result;
+  int                  state;
+  int                  shutdown;
+  struct PMR_worker_s *next;
+};
+
+/* A single lock protects the list of workers as well as their states,
+ * since it is only acquired twice per task */
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static PMR_worker_t    *pool_head = NULL;
+
+
+
+static void *worker_loop(void *argin)
+{
+  PMR_worker_t *worker = (PMR_worker_t *) argin;
+  void         *(*func)(void *);
+  void         *arg, *result;
+
+  pthread_mutex_lock(&pool_lock);
+  for (;;) {
+    while (worker->state != WORKER_BUSY && !worker->shutdown)
+      pthread_cond_wait(&worker->cond, &pool_lock);
+    if (worker->shutdown)
+      break;
+
+    func = worker->func;
+    arg  = worker->arg;
+    pthread_mutex_unlock(&pool_lock);
+
+    result = func(arg);
+
+    pthread_mutex_lock(&pool_lock);
+    worker->result = result;
+    worker->state  = WORKER_DONE;
+    pthread_cond_broadcast(&worker->cond);
+  }
+  pthread_mutex_unlock(&pool_lock);
+
+  return(NULL);
+}
+
+
+
+int PMR_pool_spawn(PMR_worker_t **handle, void *(*func)(void *), void *arg)
+{
+  PMR_worker_t   *worker;
+  pthread_attr_t attr;
+  int            info;
+
+  pthread_mutex_lock(&pool_lock);
+
+  for (worker=pool_head; worker!=NULL; worker=worker->next)
+    if (worker->state == WORKER_IDLE)
+      break;
+
+  if (worker == NULL) {
+    worker = (PMR_worker_t *) malloc( sizeof(PMR_worker_t) );
+    assert(worker != NULL);
+    worker->state    = WORKER_IDLE;
+    worker->shutdown = 0;
+    pthread_cond_init(&worker->cond, NULL);
+
+    pthread_attr_init(&attr);
+    pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+    pthread_attr_setscope(&attr, PTHREAD_SCOPE_SYSTEM);
+    info = pthread_create(&worker->thread, &attr, worker_loop, 
+			  (void *) worker);
+    pthread_attr_destroy(&attr);
+    if (info != 0) {
+      pthread_cond_destroy(&worker->cond);
+      free(worker);
+      pthread_mutex_unlock(&pool_lock);
+      return(info);
+    }
+
+    worker->next = pool_head;
+    pool_head    = worker;
+  }
+
+  worker->func  = func;
+  worker->arg   = arg;
+  worker->state = WORKER_BUSY;
+  pthread_cond_broadcast(&worker->cond);
+
+  pthread_mutex_unlock(&pool_lock);
+
+  *handle = worker;
+  return(0);
+}
+
+
+
+int PMR_pool_join(PMR_worker_t *worker, void **status)
+{
+  pthread_mutex_lock(&pool_lock);
+  while (worker->state != WORKER_DONE)
+    pthread_cond_wait(&worker->cond, &pool_lock);
+  if (status != NULL)
+    *status = worker->result;
+  worker->state = WORKER_IDLE;
+  pthread_mutex_unlock(&pool_lock);
+
+  return(0);
+}
+
+
+
+void PMR_free_thread_pool(void)
+{
+  PMR_worker_t *worker, *next;
+
+  pthread_mutex_lock(&pool_lock);
+  for (worker=pool_head; worker!=NULL; worker=worker->next) {
+    assert(worker->state == WORKER_IDLE);
+    worker->shutdown = 1;
+    pthread_cond_broadcast(&worker->cond);
+  }
+  worker    = pool_head;
+  pool_head = NULL;
+  pthread_mutex_unlock(&pool_lock);
+
+  while (worker != NULL) {
+    next = worker->next;
+    pthread_join(worker->thread, NULL);
+    pthread_cond_destroy(&worker->cond);
+    free(worker);
+    worker = next;
+  }
+}
+
@@ -10,8 +10,25 @@
 #ifndef BLAS_AXPY_HPP
 #define BLAS_AXPY_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
+namespace entrywise {
+
+// alpha x + y, where y is the entry being updated
+template<typename T>
+class AxpyZip
+{
+public:
+    AxpyZip( T alpha ) : alpha_(alpha) { }
+    T operator()( const T& x, const T& y ) const { return alpha_*x + y; }
+private:
+    T alpha_;
+};
+
+} // namespace entrywise
+
 template<typename T>
 inline void
 Axpy( T alpha, const Matrix<T>& X, Matrix<T>& Y )
@@ -57,23 +74,7 @@ Axpy( T alpha, const Matrix<T>& X, Matrix<T>& Y )
         if( X.Height() != Y.Height() || X.Width() != Y.Width() )
             throw std::logic_error("Nonconformal Axpy");
 #endif
-        if( X.Width() <= X.Height() )
-        {
-            for( int j=0; j<X.Width(); ++j )
-            {
-                blas::Axpy
-                ( X.Height(), alpha, X.LockedBuffer(0,j), 1, Y.Buffer(0,j), 1 );
-            }
-        }
-        else
-        {
-            for( int i=0; i<X.Height(); ++i )
-            {
-                blas::Axpy
-                ( X.Width(), alpha, X.LockedBuffer(i,0), X.LDim(),
-                                    Y.Buffer(i,0),       Y.LDim() );
-            }
-        }
+        EntrywiseZip( X, Y, entrywise::AxpyZip<T>( alpha ) );
     }
 }
 
@@ -113,6 +114,88 @@ Axpy
   const DistMatrix<T,U,V>& X, DistMatrix<T,U,V>& Y )
 { Axpy( T(alpha), X, Y ); }
 
+template<typename R>
+inline void
+Axpy( R alpha, const SplitMatrix<R>& X, SplitMatrix<R>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Axpy");
+#endif
+    Axpy( alpha, X.LockedReal(), Y.Real() );
+    Axpy( alpha, X.LockedImag(), Y.Imag() );
+}
+
+template<typename R>
+inline void
+Axpy( Complex<R> alpha, const SplitMatrix<R>& X, SplitMatrix<R>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Axpy");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("Nonconformal Axpy");
+#endif
+    if( alpha.imag == R(0) )
+    {
+        Axpy( alpha.real, X, Y );
+        return;
+    }
+    // Fuse the four real updates into a single pass over the data
+    const R alphaRe = alpha.real;
+    const R alphaIm = alpha.imag;
+    const int height = X.Height();
+    const int width = X.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT xRe = X.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT xIm = X.LockedImag().LockedBuffer(0,j);
+        R* RESTRICT yRe = Y.Real().Buffer(0,j);
+        R* RESTRICT yIm = Y.Imag().Buffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            yRe[i] += alphaRe*xRe[i] - alphaIm*xIm[i];
+            yIm[i] += alphaRe*xIm[i] + alphaIm*xRe[i];
+        }
+    }
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Axpy
+( Complex<R> alpha,
+  const SplitDistMatrix<R,U,V>& X, SplitDistMatrix<R,U,V>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Axpy");
+    if( X.Grid() != Y.Grid() )
+        throw std::logic_error
+        ("X and Y must be distributed over the same grid");
+#endif
+    SplitMatrix<R> YLocal;
+    LocalView( YLocal, Y );
+    if( X.ColAlignment() == Y.ColAlignment() &&
+        X.RowAlignment() == Y.RowAlignment() )
+    {
+        SplitMatrix<R> XLocal;
+        LockedLocalView( XLocal, X );
+        Axpy( alpha, XLocal, YLocal );
+    }
+    else
+    {
+        SplitDistMatrix<R,U,V> XCopy( X.Grid() );
+        XCopy.AlignWith( Y.DistData() );
+        XCopy.Real() = X.LockedReal();
+        XCopy.Imag() = X.LockedImag();
+        SplitMatrix<R> XLocal;
+        LocalView( XLocal, XCopy );
+        Axpy( alpha, XLocal, YLocal );
+    }
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Axpy( R alpha, const SplitDistMatrix<R,U,V>& X, SplitDistMatrix<R,U,V>& Y )
+{ Axpy( Complex<R>(alpha), X, Y ); }
+
 } // namespace elem
 
 #endif // ifndef BLAS_AXPY_HPP
@@ -10,6 +10,8 @@
 #ifndef BLAS_CONJUGATE_HPP
 #define BLAS_CONJUGATE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 // Default case is for real datatypes
@@ -26,11 +28,7 @@ Conjugate( Matrix<Complex<Z> >& A )
 #ifndef RELEASE
     CallStackEntry entry("Conjugate (in-place)");
 #endif
-    const int m = A.Height();
-    const int n = A.Width();
-    for( int j=0; j<n; ++j )
-        for( int i=0; i<m; ++i )
-            A.Set(i,j,Conj(A.Get(i,j)));
+    EntrywiseMap( A, entrywise::ConjugateMap() );
 }
 
 template<typename T>
@@ -40,12 +38,7 @@ Conjugate( const Matrix<T>& A, Matrix<T>& B )
 #ifndef RELEASE
     CallStackEntry entry("Conjugate");
 #endif
-    const int m = A.Height();
-    const int n = A.Width();
-    B.ResizeTo( m, n );
-    for( int j=0; j<n; ++j )
-        for( int i=0; i<m; ++i )
-            B.Set(i,j,Conj(A.Get(i,j)));
+    EntrywiseMap( A, B, entrywise::ConjugateMap() );
 }
 
 template<typename T,Distribution U,Distribution V>
@@ -70,6 +63,28 @@ Conjugate( const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
     Conjugate( B );
 }
 
+template<typename R>
+inline void
+Conjugate( SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Conjugate (in-place)");
+#endif
+    EntrywiseMap( A.Imag(), entrywise::NegateMap() );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Conjugate( SplitDistMatrix<R,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Conjugate (in-place)");
+#endif
+    SplitMatrix<R> ALocal;
+    LocalView( ALocal, A );
+    Conjugate( ALocal );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_CONJUGATE_HPP
@@ -10,6 +10,8 @@
 #ifndef BLAS_DIAGONALSCALE_HPP
 #define BLAS_DIAGONALSCALE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename T>
@@ -21,37 +23,10 @@ DiagonalScale
 #ifndef RELEASE
     CallStackEntry entry("DiagonalScale");
 #endif
-    const int m = X.Height();
-    const int n = X.Width();
-    const int ldim = X.LDim();
-    if( side == LEFT )
-    {
-        for( int i=0; i<m; ++i )
-        {
-            const T delta = d.Get(i,0);
-            T* XBuffer = X.Buffer(i,0);
-            if( orientation == ADJOINT )
-                for( int j=0; j<n; ++j )
-                    XBuffer[j*ldim] *= Conj(delta);
-            else
-                for( int j=0; j<n; ++j )
-                    XBuffer[j*ldim] *= delta;
-        }
-    }
+    if( orientation == ADJOINT )
+        DiagonalZip( side, d, X, entrywise::ConjugateMultiplyZip() );
     else
-    {
-        for( int j=0; j<n; ++j )
-        {
-            const T delta = d.Get(j,0);
-            T* XBuffer = X.Buffer(0,j);
-            if( orientation == ADJOINT )
-                for( int i=0; i<m; ++i )
-                    XBuffer[i] *= Conj(delta);
-            else
-                for( int i=0; i<m; ++i )
-                    XBuffer[i] *= delta;
-        }
-    }
+        DiagonalZip( side, d, X, entrywise::MultiplyZip() );
 }
 
 template<typename T>
@@ -63,113 +38,189 @@ DiagonalScale
 #ifndef RELEASE
     CallStackEntry entry("DiagonalScale");
 #endif
-    typedef BASE(T) R;
+    DiagonalZip( side, d, X, entrywise::MultiplyZip() );
+}
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const DistMatrix<T,U,V>& d, DistMatrix<T,W,Z>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalScale");
+#endif
+    if( orientation == ADJOINT )
+        DiagonalZip( side, d, X, entrywise::ConjugateMultiplyZip() );
+    else
+        DiagonalZip( side, d, X, entrywise::MultiplyZip() );
+}
 
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const DistMatrix<BASE(T),U,V>& d, DistMatrix<T,W,Z>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalScale");
+#endif
+    DiagonalZip( side, d, X, entrywise::MultiplyZip() );
+}
+
+template<typename R>
+inline void
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const Matrix<R>& d, SplitMatrix<R>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalScale");
+#endif
+    DiagonalScale( side, orientation, d, X.Real() );
+    DiagonalScale( side, orientation, d, X.Imag() );
+}
+
+template<typename R>
+inline void
+DiagonalScale
+( LeftOrRight side, Orientation orientation,
+  const SplitMatrix<R>& d, SplitMatrix<R>& X )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalScale");
+#endif
     const int m = X.Height();
     const int n = X.Width();
-    const int ldim = X.LDim();
+    const R conjSign = ( orientation==ADJOINT ? R(-1) : R(1) );
     if( side == LEFT )
     {
-        for( int i=0; i<m; ++i )
+        const R* RESTRICT dRe = d.LockedReal().LockedBuffer();
+        const R* RESTRICT dIm = d.LockedImag().LockedBuffer();
+        for( int j=0; j<n; ++j )
         {
-            const R delta = d.Get(i,0);
-            T* XBuffer = X.Buffer(i,0);
-            for( int j=0; j<n; ++j )
-                XBuffer[j*ldim] *= delta;
+            R* RESTRICT xRe = X.Real().Buffer(0,j);
+            R* RESTRICT xIm = X.Imag().Buffer(0,j);
+            for( int i=0; i<m; ++i )
+            {
+                const R deltaRe = dRe[i];
+                const R deltaIm = conjSign*dIm[i];
+                const R re = xRe[i];
+                const R im = xIm[i];
+                xRe[i] = deltaRe*re - deltaIm*im;
+                xIm[i] = deltaRe*im + deltaIm*re;
+            }
         }
     }
     else
     {
         for( int j=0; j<n; ++j )
         {
-            const R delta = d.Get(j,0);
-            T* XBuffer = X.Buffer(0,j);
+            const R deltaRe = d.LockedReal().Get(j,0);
+            const R deltaIm = conjSign*d.LockedImag().Get(j,0);
+            R* RESTRICT xRe = X.Real().Buffer(0,j);
+            R* RESTRICT xIm = X.Imag().Buffer(0,j);
             for( int i=0; i<m; ++i )
-                XBuffer[i] *= delta;
+            {
+                const R re = xRe[i];
+                const R im = xIm[i];
+                xRe[i] = deltaRe*re - deltaIm*im;
+                xIm[i] = deltaRe*im + deltaIm*re;
+            }
         }
     }
 }
 
-template<typename T,Distribution U,Distribution V,
+template<typename R,Distribution U,Distribution V,
                     Distribution W,Distribution Z>
 inline void
 DiagonalScale
 ( LeftOrRight side, Orientation orientation,
-  const DistMatrix<T,U,V>& d, DistMatrix<T,W,Z>& X )
+  const DistMatrix<R,U,V>& d, SplitDistMatrix<R,W,Z>& X )
 {
 #ifndef RELEASE
     CallStackEntry entry("DiagonalScale");
 #endif
+    SplitMatrix<R> XLocal;
+    LocalView( XLocal, X );
     if( side == LEFT )
     {
         if( U == W && V == STAR && d.ColAlignment() == X.ColAlignment() )
         {
-            DiagonalScale( LEFT, orientation, d.LockedMatrix(), X.Matrix() );
+            DiagonalScale( LEFT, orientation, d.LockedMatrix(), XLocal );
         }
         else
         {
-            DistMatrix<T,W,STAR> d_W_STAR( X.Grid() );
+            DistMatrix<R,W,STAR> d_W_STAR( X.Grid() );
+            d_W_STAR.AlignWith( X.DistData() );
             d_W_STAR = d;
             DiagonalScale
-            ( LEFT, orientation,
-              d_W_STAR.LockedMatrix(), X.Matrix() );
+            ( LEFT, orientation, d_W_STAR.LockedMatrix(), XLocal );
         }
     }
     else
     {
         if( U == Z && V == STAR && d.ColAlignment() == X.RowAlignment() )
         {
-            DiagonalScale
-            ( RIGHT, orientation, d.LockedMatrix(), X.Matrix() );
+            DiagonalScale( RIGHT, orientation, d.LockedMatrix(), XLocal );
         }
         else
         {
-            DistMatrix<T,Z,STAR> d_Z_STAR( X.Grid() );
+            DistMatrix<R,Z,STAR> d_Z_STAR( X.Grid() );
+            d_Z_STAR.AlignWith( X.DistData() );
             d_Z_STAR = d;
             DiagonalScale
-            ( RIGHT, orientation, d_Z_STAR.LockedMatrix(), X.Matrix() );
+            ( RIGHT, orientation, d_Z_STAR.LockedMatrix(), XLocal );
         }
     }
 }
 
-template<typename T,Distribution U,Distribution V,
+template<typename R,Distribution U,Distribution V,
                     Distribution W,Distribution Z>
 inline void
 DiagonalScale
 ( LeftOrRight side, Orientation orientation,
-  const DistMatrix<BASE(T),U,V>& d, DistMatrix<T,W,Z>& X )
+  const SplitDistMatrix<R,U,V>& d, SplitDistMatrix<R,W,Z>& X )
 {
 #ifndef RELEASE
     CallStackEntry entry("DiagonalScale");
 #endif
-    typedef BASE(T) R;
-
+    SplitMatrix<R> dLocal, XLocal;
+    LocalView( XLocal, X );
     if( side == LEFT )
     {
         if( U == W && V == STAR && d.ColAlignment() == X.ColAlignment() )
         {
-            DiagonalScale( LEFT, orientation, d.LockedMatrix(), X.Matrix() );
+            LockedLocalView( dLocal, d );
+            DiagonalScale( LEFT, orientation, dLocal, XLocal );
         }
         else
         {
-            DistMatrix<R,W,STAR> d_W_STAR( X.Grid() );
-            d_W_STAR = d;
-            DiagonalScale
-            ( LEFT, orientation, d_W_STAR.LockedMatrix(), X.Matrix() );
+            SplitDistMatrix<R,W,STAR> d_W_STAR( X.Grid() );
+            d_W_STAR.AlignWith( X.DistData() );
+            d_W_STAR.Real() = d.LockedReal();
+            d_W_STAR.Imag() = d.LockedImag();
+            LockedLocalView( dLocal, d_W_STAR );
+            DiagonalScale( LEFT, orientation, dLocal, XLocal );
         }
     }
     else
     {
         if( U == Z && V == STAR && d.ColAlignment() == X.RowAlignment() )
         {
-            DiagonalScale( RIGHT, orientation, d.LockedMatrix(), X.Matrix() );
+            LockedLocalView( dLocal, d );
+            DiagonalScale( RIGHT, orientation, dLocal, XLocal );
         }
         else
         {
-            DistMatrix<R,Z,STAR> d_Z_STAR( X.Grid() );
-            d_Z_STAR = d;
-            DiagonalScale
-            ( RIGHT, orientation, d_Z_STAR.LockedMatrix(), X.Matrix() );
+            SplitDistMatrix<R,Z,STAR> d_Z_STAR( X.Grid() );
+            d_Z_STAR.AlignWith( X.DistData() );
+            d_Z_STAR.Real() = d.LockedReal();
+            d_Z_STAR.Imag() = d.LockedImag();
+            LockedLocalView( dLocal, d_Z_STAR );
+            DiagonalScale( RIGHT, orientation, dLocal, XLocal );
         }
     }
 }
@@ -10,8 +10,43 @@
 #ifndef BLAS_DIAGONALSOLVE_HPP
 #define BLAS_DIAGONALSOLVE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
+namespace diagonal_solve {
+
+template<typename F>
+inline bool
+HasZero( const Matrix<F>& d )
+{
+    const int height = d.Height();
+    const F* dBuffer = d.LockedBuffer();
+    for( int i=0; i<height; ++i )
+        if( dBuffer[i] == F(0) )
+            return true;
+    return false;
+}
+
+// Since the owners of a zero are not the only processes which would
+// otherwise continue on to the redistribution of d, every process throws
+template<typename F,Distribution U,Distribution V>
+inline void
+CheckIfSingular( const DistMatrix<F,U,V>& d )
+{
+    const int localSingular = HasZero( d.LockedMatrix() );
+    int singular;
+    mpi::AllReduce
+    ( &localSingular, &singular, 1, mpi::MAX, d.Grid().Comm() );
+    if( singular )
+        throw SingularMatrixException();
+}
+
+} // namespace diagonal_solve
+
+// The solves divide each entry of X by the corresponding entry of d in a
+// single pass over X, without forming the inverse of d
+
 template<typename F>
 inline void
 DiagonalSolve
@@ -21,43 +56,12 @@ DiagonalSolve
 #ifndef RELEASE
     CallStackEntry entry("DiagonalSolve");
 #endif
-    const int m = X.Height();
-    const int n = X.Width();
-    const int ldim = X.LDim();
-    if( side == LEFT )
-    {
-        for( int i=0; i<m; ++i )
-        {
-            const F delta = d.Get(i,0);
-            if( checkIfSingular && delta == F(0) )
-                throw SingularMatrixException();
-            const F deltaInv = F(1)/delta;
-            F* XBuffer = X.Buffer(i,0);
-            if( orientation == ADJOINT )
-                for( int j=0; j<n; ++j )
-                    XBuffer[j*ldim] *= Conj(deltaInv);
-            else
-                for( int j=0; j<n; ++j )
-                    XBuffer[j*ldim] *= deltaInv;
-        }
-    }
+    if( checkIfSingular && diagonal_solve::HasZero( d ) )
+        throw SingularMatrixException();
+    if( orientation == ADJOINT )
+        DiagonalZip( side, d, X, entrywise::ConjugateDivideZip() );
     else
-    {
-        for( int j=0; j<n; ++j )
-        {
-            const F delta = d.Get(j,0);
-            if( checkIfSingular && delta == F(0) )
-                throw SingularMatrixException();
-            const F deltaInv = F(1)/delta;
-            F* XBuffer = X.Buffer(0,j);
-            if( orientation == ADJOINT )
-                for( int i=0; i<m; ++i )
-                    XBuffer[i] *= Conj(deltaInv);
-            else
-                for( int i=0; i<m; ++i )
-                    XBuffer[i] *= deltaInv;
-        }
-    }
+        DiagonalZip( side, d, X, entrywise::DivideZip() );
 }
 
 template<typename F>
@@ -70,37 +74,9 @@ DiagonalSolve
 #ifndef RELEASE
     CallStackEntry entry("DiagonalSolve");
 #endif
-    typedef BASE(F) R;
-
-    const int m = X.Height();
-    const int n = X.Width();
-    const int ldim = X.LDim();
-    if( side == LEFT )
-    {
-        for( int i=0; i<m; ++i )
-        {
-            const R delta = d.Get(i,0);
-            if( checkIfSingular && delta == R(0) )
-                throw SingularMatrixException();
-            const R deltaInv = R(1)/delta;
-            F* XBuffer = X.Buffer(i,0);
-            for( int j=0; j<n; ++j )
-                XBuffer[j*ldim] *= deltaInv;
-        }
-    }
-    else
-    {
-        for( int j=0; j<n; ++j )
-        {
-            const R delta = d.Get(j,0);
-            if( checkIfSingular && delta == R(0) )
-                throw SingularMatrixException();
-            const R deltaInv = R(1)/delta;
-            F* XBuffer = X.Buffer(0,j);
-            for( int i=0; i<m; ++i )
-                XBuffer[i] *= deltaInv;
-        }
-    }
+    if( checkIfSingular && diagonal_solve::HasZero( d ) )
+        throw SingularMatrixException();
+    DiagonalZip( side, d, X, entrywise::DivideZip() );
 }
 
 template<typename F,Distribution U,Distribution V,
@@ -114,40 +90,12 @@ DiagonalSolve
 #ifndef RELEASE
     CallStackEntry entry("DiagonalSolve");
 #endif
-    if( side == LEFT )
-    {
-        if( U == W && V == STAR && d.ColAlignment() == X.ColAlignment() )
-        {
-            DiagonalSolve
-            ( LEFT, orientation, d.LockedMatrix(), X.Matrix(),
-              checkIfSingular );
-        }
-        else
-        {
-            DistMatrix<F,W,STAR> d_W_STAR( X.Grid() );
-            d_W_STAR = d;
-            DiagonalSolve
-            ( LEFT, orientation,
-              d_W_STAR.LockedMatrix(), X.Matrix(), checkIfSingular );
-        }
-    }
+    if( checkIfSingular )
+        diagonal_solve::CheckIfSingular( d );
+    if( orientation == ADJOINT )
+        DiagonalZip( side, d, X, entrywise::ConjugateDivideZip() );
     else
-    {
-        if( U == Z && V == STAR && d.ColAlignment() == X.RowAlignment() )
-        {
-            DiagonalSolve
-            ( RIGHT, orientation, d.LockedMatrix(), X.Matrix(),
-              checkIfSingular );
-        }
-        else
-        {
-            DistMatrix<F,Z,STAR> d_Z_STAR( X.Grid() );
-            d_Z_STAR = d;
-            DiagonalSolve
-            ( RIGHT, orientation,
-              d_Z_STAR.LockedMatrix(), X.Matrix(), checkIfSingular );
-        }
-    }
+        DiagonalZip( side, d, X, entrywise::DivideZip() );
 }
 
 template<typename F,Distribution U,Distribution V,
@@ -161,42 +109,9 @@ DiagonalSolve
 #ifndef RELEASE
     CallStackEntry entry("DiagonalSolve");
 #endif
-    typedef BASE(F) R;
-
-    if( side == LEFT )
-    {
-        if( U == W && V == STAR && d.ColAlignment() == X.ColAlignment() )
-        {
-            DiagonalSolve
-            ( LEFT, orientation, d.LockedMatrix(), X.Matrix(),
-              checkIfSingular );
-        }
-        else
-        {
-            DistMatrix<R,W,STAR> d_W_STAR( X.Grid() );
-            d_W_STAR = d;
-            DiagonalSolve
-            ( LEFT, orientation,
-              d_W_STAR.LockedMatrix(), X.Matrix(), checkIfSingular );
-        }
-    }
-    else
-    {
-        if( U == Z && V == STAR && d.ColAlignment() == X.RowAlignment() )
-        {
-            DiagonalSolve
-            ( RIGHT, orientation, d.LockedMatrix(), X.Matrix(),
-              checkIfSingular );
-        }
-        else
-        {
-            DistMatrix<R,Z,STAR> d_Z_STAR( X.Grid() );
-            d_Z_STAR = d;
-            DiagonalSolve
-            ( RIGHT, orientation,
-              d_Z_STAR.LockedMatrix(), X.Matrix(), checkIfSingular );
-        }
-    }
+    if( checkIfSingular )
+        diagonal_solve::CheckIfSingular( d );
+    DiagonalZip( side, d, X, entrywise::DivideZip() );
 }
 
 } // namespace elem
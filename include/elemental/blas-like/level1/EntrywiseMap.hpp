@@ -0,0 +1,770 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_ENTRYWISEMAP_HPP
+#define BLAS_ENTRYWISEMAP_HPP
+
+//
+// Single-pass entrywise kernels over the local data of Matrix and DistMatrix.
+//
+// The functions are function objects with a const operator(), so that several
+// entrywise operations can be composed (see entrywise::Compose) and applied,
+// along with an optional reduction of the results (see EntrywiseMapReduce),
+// in a single pass over memory. Each local column is traversed by a
+// unit-stride loop which the compiler is free to vectorize and, with OpenMP,
+// the columns are split between the threads with the same static schedule
+// used for the parallel first touch of large buffers.
+//
+// A reduction is a class with the members
+//
+//   void Clear();                        // reset to the identity
+//   void Accumulate( const T& alpha );   // include a single entry
+//   void Combine( const Reduction& r );  // merge the result of another
+//   void AllReduce( mpi::Comm comm );    // merge over a communicator
+//
+// along with a Result() member, e.g., entrywise::FrobeniusReduction. Since
+// the contributions of the threads are combined in an unspecified order,
+// threaded sums may differ from run to run in the last few bits.
+//
+
+namespace elem {
+namespace entrywise {
+
+// Matrices with fewer local entries than this are handled by a single thread
+const int MIN_PARALLEL_SIZE = 16384;
+
+inline bool
+Parallelize( int height, int width )
+{ return double(height)*double(width) >= MIN_PARALLEL_SIZE; }
+
+//----------------------------------------------------------------------------//
+// Basic function objects                                                     //
+//----------------------------------------------------------------------------//
+
+// f(g(alpha)) for functions which map entries to entries of the same type
+template<class Outer,class Inner>
+class Composition
+{
+public:
+    Composition( const Outer& outer, const Inner& inner )
+    : outer_(outer), inner_(inner)
+    { }
+
+    template<typename T>
+    T operator()( const T& alpha ) const
+    { return outer_(inner_(alpha)); }
+
+private:
+    Outer outer_;
+    Inner inner_;
+};
+
+template<class Outer,class Inner>
+inline Composition<Outer,Inner>
+Compose( const Outer& outer, const Inner& inner )
+{ return Composition<Outer,Inner>( outer, inner ); }
+
+struct ZeroMap
+{
+    template<typename T>
+    T operator()( const T& alpha ) const
+    { return T(0); }
+};
+
+struct NegateMap
+{
+    template<typename T>
+    T operator()( const T& alpha ) const
+    { return -alpha; }
+};
+
+struct ConjugateMap
+{
+    template<typename T>
+    T operator()( const T& alpha ) const
+    { return Conj(alpha); }
+};
+
+struct RealPartMap
+{
+    template<typename T>
+    BASE(T) operator()( const T& alpha ) const
+    { return RealPart(alpha); }
+};
+
+struct ReciprocalMap
+{
+    template<typename T>
+    T operator()( const T& alpha ) const
+    { return T(1)/alpha; }
+};
+
+// alpha beta, where beta is the entry being updated
+struct MultiplyZip
+{
+    template<typename S,typename T>
+    T operator()( const S& alpha, const T& beta ) const
+    { return alpha*beta; }
+};
+
+// conj(alpha) beta, where beta is the entry being updated
+struct ConjugateMultiplyZip
+{
+    template<typename S,typename T>
+    T operator()( const S& alpha, const T& beta ) const
+    { return Conj(alpha)*beta; }
+};
+
+// beta / alpha, where beta is the entry being updated
+struct DivideZip
+{
+    template<typename S,typename T>
+    T operator()( const S& alpha, const T& beta ) const
+    { return beta/alpha; }
+};
+
+// beta / conj(alpha), where beta is the entry being updated
+struct ConjugateDivideZip
+{
+    template<typename S,typename T>
+    T operator()( const S& alpha, const T& beta ) const
+    { return beta/Conj(alpha); }
+};
+
+//----------------------------------------------------------------------------//
+// Reductions                                                                 //
+//----------------------------------------------------------------------------//
+
+template<typename T>
+class SumReduction
+{
+public:
+    SumReduction() : sum_(0) { }
+    void Clear() { sum_ = 0; }
+    void Accumulate( const T& alpha ) { sum_ += alpha; }
+    void Combine( const SumReduction<T>& other ) { sum_ += other.sum_; }
+    void AllReduce( mpi::Comm comm )
+    {
+        const T localSum = sum_;
+        mpi::AllReduce( &localSum, &sum_, 1, mpi::SUM, comm );
+    }
+    T Result() const { return sum_; }
+private:
+    T sum_;
+};
+
+// max_{i,j} |A(i,j)|
+template<typename F>
+class MaxAbsReduction
+{
+public:
+    typedef BASE(F) R;
+    MaxAbsReduction() : maxAbs_(0) { }
+    void Clear() { maxAbs_ = 0; }
+    void Accumulate( const F& alpha )
+    { maxAbs_ = std::max( maxAbs_, Abs(alpha) ); }
+    void Combine( const MaxAbsReduction<F>& other )
+    { maxAbs_ = std::max( maxAbs_, other.maxAbs_ ); }
+    void AllReduce( mpi::Comm comm )
+    {
+        const R localMaxAbs = maxAbs_;
+        mpi::AllReduce( &localMaxAbs, &maxAbs_, 1, mpi::MAX, comm );
+    }
+    R Result() const { return maxAbs_; }
+private:
+    R maxAbs_;
+};
+
+// sum_{i,j} |A(i,j)|
+template<typename F>
+class SumAbsReduction
+{
+public:
+    typedef BASE(F) R;
+    SumAbsReduction() : sum_(0) { }
+    void Clear() { sum_ = 0; }
+    void Accumulate( const F& alpha ) { sum_ += Abs(alpha); }
+    void Combine( const SumAbsReduction<F>& other ) { sum_ += other.sum_; }
+    void AllReduce( mpi::Comm comm )
+    {
+        const R localSum = sum_;
+        mpi::AllReduce( &localSum, &sum_, 1, mpi::SUM, comm );
+    }
+    R Result() const { return sum_; }
+private:
+    R sum_;
+};
+
+// sum_{i,j} |A(i,j)|^p
+template<typename F>
+class SumAbsPowReduction
+{
+public:
+    typedef BASE(F) R;
+    explicit SumAbsPowReduction( R p ) : p_(p), sum_(0) { }
+    void Clear() { sum_ = 0; }
+    void Accumulate( const F& alpha ) { sum_ += Pow( Abs(alpha), p_ ); }
+    void Combine( const SumAbsPowReduction<F>& other ) { sum_ += other.sum_; }
+    void AllReduce( mpi::Comm comm )
+    {
+        const R localSum = sum_;
+        mpi::AllReduce( &localSum, &sum_, 1, mpi::SUM, comm );
+    }
+    R Result() const { return sum_; }
+private:
+    R p_, sum_;
+};
+
+// sqrt(sum_{i,j} |A(i,j)|^2), accumulated as scale^2 scaledSquare in order to
+// avoid unnecessary overflow and underflow
+template<typename F>
+class FrobeniusReduction
+{
+public:
+    typedef BASE(F) R;
+    FrobeniusReduction() : scale_(0), scaledSquare_(1) { }
+    void Clear() { scale_ = 0; scaledSquare_ = 1; }
+    void Accumulate( const F& alpha )
+    {
+        const R alphaAbs = Abs(alpha);
+        if( alphaAbs != 0 )
+        {
+            if( alphaAbs <= scale_ )
+            {
+                const R relScale = alphaAbs/scale_;
+                scaledSquare_ += relScale*relScale;
+            }
+            else
+            {
+                const R relScale = scale_/alphaAbs;
+                scaledSquare_ = scaledSquare_*relScale*relScale + 1;
+                scale_ = alphaAbs;
+            }
+        }
+    }
+    void Combine( const FrobeniusReduction<F>& other )
+    {
+        if( other.scale_ == 0 )
+            return;
+        if( other.scale_ <= scale_ )
+        {
+            const R relScale = other.scale_/scale_;
+            scaledSquare_ += other.scaledSquare_*relScale*relScale;
+        }
+        else
+        {
+            const R relScale = scale_/other.scale_;
+            scaledSquare_ = scaledSquare_*relScale*relScale +
+                            other.scaledSquare_;
+            scale_ = other.scale_;
+        }
+    }
+    void AllReduce( mpi::Comm comm )
+    {
+        // Find the maximum scale and equilibrate the local scaled squares
+        const R localScale = scale_;
+        mpi::AllReduce( &localScale, &scale_, 1, mpi::MAX, comm );
+        if( scale_ == 0 )
+        {
+            scaledSquare_ = 1;
+            return;
+        }
+        const R relScale = localScale/scale_;
+        const R localScaledSquare = scaledSquare_*relScale*relScale;
+        mpi::AllReduce
+        ( &localScaledSquare, &scaledSquare_, 1, mpi::SUM, comm );
+    }
+    R Result() const { return scale_*Sqrt(scaledSquare_); }
+private:
+    R scale_, scaledSquare_;
+};
+
+} // namespace entrywise
+
+//----------------------------------------------------------------------------//
+// Maps                                                                       //
+//----------------------------------------------------------------------------//
+
+// A(i,j) := f(A(i,j))
+template<typename T,class Function>
+inline void
+EntrywiseMap( Matrix<T>& A, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseMap");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        T* RESTRICT col = &buffer[j*ldim];
+        for( int i=0; i<height; ++i )
+            col[i] = f(col[i]);
+    }
+}
+
+template<typename T,Distribution U,Distribution V,class Function>
+inline void
+EntrywiseMap( DistMatrix<T,U,V>& A, const Function& f )
+{ EntrywiseMap( A.Matrix(), f ); }
+
+// B(i,j) := f(A(i,j))
+template<typename S,typename T,class Function>
+inline void
+EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseMap");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    B.ResizeTo( height, width );
+    const int ALDim = A.LDim();
+    const int BLDim = B.LDim();
+    const S* ABuffer = A.LockedBuffer();
+    T* BBuffer = B.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        const S* ACol = &ABuffer[j*ALDim];
+        T* BCol = &BBuffer[j*BLDim];
+        for( int i=0; i<height; ++i )
+            BCol[i] = f(ACol[i]);
+    }
+}
+
+namespace entrywise {
+
+// Make B (which must be aligned with A if it is a view) conform with A
+template<typename S,typename T,Distribution U,Distribution V>
+inline void
+Conform( const DistMatrix<S,U,V>& A, DistMatrix<T,U,V>& B )
+{
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("Matrices must be distributed over same grid");
+    if( A.ColAlignment() != B.ColAlignment() ||
+        A.RowAlignment() != B.RowAlignment() )
+    {
+        if( B.Viewing() )
+            throw std::logic_error("Cannot realign a view");
+        B.Empty();
+        B.AlignWith( A.DistData() );
+    }
+    B.ResizeTo( A.Height(), A.Width() );
+}
+
+} // namespace entrywise
+
+template<typename S,typename T,Distribution U,Distribution V,class Function>
+inline void
+EntrywiseMap
+( const DistMatrix<S,U,V>& A, DistMatrix<T,U,V>& B, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseMap");
+#endif
+    entrywise::Conform( A, B );
+    EntrywiseMap( A.LockedMatrix(), B.Matrix(), f );
+}
+
+//----------------------------------------------------------------------------//
+// Zips                                                                       //
+//----------------------------------------------------------------------------//
+
+// Y(i,j) := f(X(i,j),Y(i,j))
+template<typename S,typename T,class Function>
+inline void
+EntrywiseZip( const Matrix<S>& X, Matrix<T>& Y, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseZip");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("Nonconformal EntrywiseZip");
+#endif
+    const int height = Y.Height();
+    const int width = Y.Width();
+    const int XLDim = X.LDim();
+    const int YLDim = Y.LDim();
+    const S* XBuffer = X.LockedBuffer();
+    T* YBuffer = Y.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        const S* XCol = &XBuffer[j*XLDim];
+        T* YCol = &YBuffer[j*YLDim];
+        for( int i=0; i<height; ++i )
+            YCol[i] = f(XCol[i],YCol[i]);
+    }
+}
+
+template<typename S,typename T,Distribution U,Distribution V,class Function>
+inline void
+EntrywiseZip
+( const DistMatrix<S,U,V>& X, DistMatrix<T,U,V>& Y, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseZip");
+    if( X.Grid() != Y.Grid() )
+        throw std::logic_error
+        ("X and Y must be distributed over the same grid");
+#endif
+    if( X.ColAlignment() == Y.ColAlignment() &&
+        X.RowAlignment() == Y.RowAlignment() )
+    {
+        EntrywiseZip( X.LockedMatrix(), Y.Matrix(), f );
+    }
+    else
+    {
+        DistMatrix<S,U,V> XCopy( X.Grid() );
+        XCopy.AlignWith( Y.DistData() );
+        XCopy = X;
+        EntrywiseZip( XCopy.LockedMatrix(), Y.Matrix(), f );
+    }
+}
+
+// Z(i,j) := f(X(i,j),Y(i,j)), where Z may be the same matrix as X and/or Y
+template<typename S,typename T,typename W,class Function>
+inline void
+EntrywiseZip
+( const Matrix<S>& X, const Matrix<T>& Y, Matrix<W>& Z, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseZip");
+    if( X.Height() != Y.Height() || X.Width() != Y.Width() )
+        throw std::logic_error("Nonconformal EntrywiseZip");
+#endif
+    const int height = X.Height();
+    const int width = X.Width();
+    Z.ResizeTo( height, width );
+    const int XLDim = X.LDim();
+    const int YLDim = Y.LDim();
+    const int ZLDim = Z.LDim();
+    const S* XBuffer = X.LockedBuffer();
+    const T* YBuffer = Y.LockedBuffer();
+    W* ZBuffer = Z.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        const S* XCol = &XBuffer[j*XLDim];
+        const T* YCol = &YBuffer[j*YLDim];
+        W* ZCol = &ZBuffer[j*ZLDim];
+        for( int i=0; i<height; ++i )
+            ZCol[i] = f(XCol[i],YCol[i]);
+    }
+}
+
+template<typename S,typename T,typename W,Distribution U,Distribution V,
+         class Function>
+inline void
+EntrywiseZip
+( const DistMatrix<S,U,V>& X, const DistMatrix<T,U,V>& Y,
+        DistMatrix<W,U,V>& Z, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseZip");
+    if( X.Grid() != Y.Grid() )
+        throw std::logic_error("Matrices must be distributed over same grid");
+    if( X.ColAlignment() != Y.ColAlignment() ||
+        X.RowAlignment() != Y.RowAlignment() )
+        throw std::logic_error("X and Y must be aligned");
+#endif
+    entrywise::Conform( X, Z );
+    EntrywiseZip( X.LockedMatrix(), Y.LockedMatrix(), Z.Matrix(), f );
+}
+
+//----------------------------------------------------------------------------//
+// Reductions                                                                 //
+//----------------------------------------------------------------------------//
+
+// Accumulate each A(i,j) into the reduction
+template<typename T,class Reduction>
+inline void
+EntrywiseReduce( const Matrix<T>& A, Reduction& reduction )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseReduce");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    const T* buffer = A.LockedBuffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel if( entrywise::Parallelize(height,width) )
+    {
+        Reduction threadReduction( reduction );
+        threadReduction.Clear();
+        #pragma omp for schedule(static)
+        for( int j=0; j<width; ++j )
+        {
+            const T* RESTRICT col = &buffer[j*ldim];
+            for( int i=0; i<height; ++i )
+                threadReduction.Accumulate( col[i] );
+        }
+        #pragma omp critical
+        reduction.Combine( threadReduction );
+    }
+#else
+    for( int j=0; j<width; ++j )
+    {
+        const T* RESTRICT col = &buffer[j*ldim];
+        for( int i=0; i<height; ++i )
+            reduction.Accumulate( col[i] );
+    }
+#endif
+}
+
+// Accumulate each A(i,j) into the reduction over the entire process grid
+template<typename T,Distribution U,Distribution V,class Reduction>
+inline void
+EntrywiseReduce( const DistMatrix<T,U,V>& A, Reduction& reduction )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseReduce");
+#endif
+    EntrywiseReduce( A.LockedMatrix(), reduction );
+    reduction.AllReduce( ReduceComm<U,V>( A.Grid() ) );
+}
+
+// A(i,j) := f(A(i,j)) and accumulate the new A(i,j) into the reduction
+template<typename T,class Function,class Reduction>
+inline void
+EntrywiseMapReduce( Matrix<T>& A, const Function& f, Reduction& reduction )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseMapReduce");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel if( entrywise::Parallelize(height,width) )
+    {
+        Reduction threadReduction( reduction );
+        threadReduction.Clear();
+        #pragma omp for schedule(static)
+        for( int j=0; j<width; ++j )
+        {
+            T* RESTRICT col = &buffer[j*ldim];
+            for( int i=0; i<height; ++i )
+            {
+                const T alpha = f(col[i]);
+                col[i] = alpha;
+                threadReduction.Accumulate( alpha );
+            }
+        }
+        #pragma omp critical
+        reduction.Combine( threadReduction );
+    }
+#else
+    for( int j=0; j<width; ++j )
+    {
+        T* RESTRICT col = &buffer[j*ldim];
+        for( int i=0; i<height; ++i )
+        {
+            const T alpha = f(col[i]);
+            col[i] = alpha;
+            reduction.Accumulate( alpha );
+        }
+    }
+#endif
+}
+
+template<typename T,Distribution U,Distribution V,
+         class Function,class Reduction>
+inline void
+EntrywiseMapReduce
+( DistMatrix<T,U,V>& A, const Function& f, Reduction& reduction )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseMapReduce");
+#endif
+    EntrywiseMapReduce( A.Matrix(), f, reduction );
+    reduction.AllReduce( ReduceComm<U,V>( A.Grid() ) );
+}
+
+//----------------------------------------------------------------------------//
+// Diagonal and trapezoidal variants                                          //
+//----------------------------------------------------------------------------//
+
+// A(i,j) := f(d(i),A(i,j)) from the left or f(d(j),A(i,j)) from the right,
+// where d is a column vector
+template<typename S,typename T,class Function>
+inline void
+DiagonalZip
+( LeftOrRight side, const Matrix<S>& d, Matrix<T>& A, const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalZip");
+    if( d.Width() != 1 )
+        throw std::logic_error("d must be a column vector");
+    if( (side==LEFT && d.Height()!=A.Height()) ||
+        (side==RIGHT && d.Height()!=A.Width()) )
+        throw std::logic_error("Nonconformal DiagonalZip");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    const S* dBuffer = d.LockedBuffer();
+    T* buffer = A.Buffer();
+    // Both cases traverse A by columns, so the left case reads d with unit
+    // stride once per column rather than striding through the rows of A
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        T* RESTRICT col = &buffer[j*ldim];
+        if( side == LEFT )
+        {
+            for( int i=0; i<height; ++i )
+                col[i] = f(dBuffer[i],col[i]);
+        }
+        else
+        {
+            const S delta = dBuffer[j];
+            for( int i=0; i<height; ++i )
+                col[i] = f(delta,col[i]);
+        }
+    }
+}
+
+template<typename S,typename T,Distribution U,Distribution V,
+                               Distribution W,Distribution Z,class Function>
+inline void
+DiagonalZip
+( LeftOrRight side, const DistMatrix<S,U,V>& d, DistMatrix<T,W,Z>& A,
+  const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("DiagonalZip");
+#endif
+    if( side == LEFT )
+    {
+        if( U == W && V == STAR && d.ColAlignment() == A.ColAlignment() )
+        {
+            DiagonalZip( LEFT, d.LockedMatrix(), A.Matrix(), f );
+        }
+        else
+        {
+            DistMatrix<S,W,STAR> d_W_STAR( A.Grid() );
+            d_W_STAR.AlignWith( A.DistData() );
+            d_W_STAR = d;
+            DiagonalZip( LEFT, d_W_STAR.LockedMatrix(), A.Matrix(), f );
+        }
+    }
+    else
+    {
+        if( U == Z && V == STAR && d.ColAlignment() == A.RowAlignment() )
+        {
+            DiagonalZip( RIGHT, d.LockedMatrix(), A.Matrix(), f );
+        }
+        else
+        {
+            DistMatrix<S,Z,STAR> d_Z_STAR( A.Grid() );
+            d_Z_STAR.AlignWith( A.DistData() );
+            d_Z_STAR = d;
+            DiagonalZip( RIGHT, d_Z_STAR.LockedMatrix(), A.Matrix(), f );
+        }
+    }
+}
+
+// A(i,j) := f(A(i,j)) for the entries within the trapezoid described by
+// (side,uplo,offset), with the same conventions as ScaleTrapezoid
+template<typename T,class Function>
+inline void
+TrapezoidalMap
+( LeftOrRight side, UpperOrLower uplo, int offset, Matrix<T>& A,
+  const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TrapezoidalMap");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int ldim = A.LDim();
+    const int diagShift = ( side==LEFT ? -offset : height-width-offset );
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(height,width) )
+#endif
+    for( int j=0; j<width; ++j )
+    {
+        // The entry in row j+diagShift lies on the boundary of the trapezoid
+        const int iBeg =
+            ( uplo==UPPER ? 0 : std::min(std::max(j+diagShift,0),height) );
+        const int iEnd =
+            ( uplo==UPPER ? std::min(std::max(j+diagShift+1,0),height)
+                          : height );
+        T* RESTRICT col = &buffer[j*ldim];
+        for( int i=iBeg; i<iEnd; ++i )
+            col[i] = f(col[i]);
+    }
+}
+
+template<typename T,Distribution U,Distribution V,class Function>
+inline void
+TrapezoidalMap
+( LeftOrRight side, UpperOrLower uplo, int offset, DistMatrix<T,U,V>& A,
+  const Function& f )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TrapezoidalMap");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    const int diagShift = ( side==LEFT ? -offset : height-width-offset );
+    const int ldim = A.LDim();
+    T* buffer = A.Buffer();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for schedule(static) \
+            if( entrywise::Parallelize(localHeight,localWidth) )
+#endif
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        const int iBeg =
+            ( uplo==UPPER ? 0 : std::min(std::max(j+diagShift,0),height) );
+        const int iEnd =
+            ( uplo==UPPER ? std::min(std::max(j+diagShift+1,0),height)
+                          : height );
+        const int iLocalBeg = Length_( iBeg, colShift, colStride );
+        const int iLocalEnd = Length_( iEnd, colShift, colStride );
+        T* RESTRICT col = &buffer[jLocal*ldim];
+        for( int iLocal=iLocalBeg; iLocal<iLocalEnd; ++iLocal )
+            col[iLocal] = f(col[iLocal]);
+    }
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_ENTRYWISEMAP_HPP
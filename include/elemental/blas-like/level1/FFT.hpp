@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_FFT_HPP
+#define BLAS_FFT_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+
+//
+// Unnormalized discrete Fourier transforms of each column of a matrix,
+//
+//     y_k = sum_j exp(-+2 pi i j k/n) x_j,
+//
+// with the negative sign for the forward transform and the positive sign for
+// the inverse transform (so that the inverse transform of the forward
+// transform is n times the identity).
+//
+// Lengths which are powers of two use an iterative radix-2 Cooley-Tukey
+// transform, while all other lengths use Bluestein's chirp-z algorithm on top
+// of a power-of-two transform of length at least 2n-1.
+//
+// Distributed matrices are transformed by redistributing them so that each
+// process owns entire columns, i.e., [* ,VR], so that there is no
+// communication beyond the redistributions and each process performs
+// sequential transforms; as a result, at most 'width' processes are active.
+//
+
+namespace elem {
+namespace fft {
+
+template<typename R>
+class Plan
+{
+public:
+    Plan() : n_(0), m_(0), inverse_(false) { }
+    Plan( int n, bool inverse=false ) { Initialize( n, inverse ); }
+
+    void Initialize( int n, bool inverse=false );
+
+    int Size() const { return n_; }
+    bool Inverse() const { return inverse_; }
+
+    // Overwrite the contiguous vector x of length n with its transform
+    void Apply( Complex<R>* x ) const;
+
+private:
+    int n_, m_;
+    bool inverse_;
+    std::vector<int> bitReversal_;
+    std::vector<Complex<R> > twiddles_;
+    // Only used by Bluestein's algorithm (when n is not a power of two)
+    std::vector<Complex<R> > chirp_, chirpTransform_;
+    mutable std::vector<Complex<R> > work_;
+
+    void Radix2( Complex<R>* x, bool inverse ) const;
+};
+
+template<typename R>
+inline void
+Plan<R>::Initialize( int n, bool inverse )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::Plan::Initialize");
+    if( n < 0 )
+        throw std::logic_error("Transform length must be non-negative");
+#endif
+    typedef Complex<R> C;
+    const R pi = 4*Atan( R(1) );
+    n_ = n;
+    inverse_ = inverse;
+    const bool powerOfTwo = ( n > 0 && (n & (n-1)) == 0 );
+    m_ = 1;
+    if( powerOfTwo )
+        m_ = n;
+    else
+        while( m_ < 2*n-1 )
+            m_ *= 2;
+
+    // Precompute the bit reversal and exp(-2 pi i j/m) for the power-of-two
+    // transforms of length m
+    int logm = 0;
+    while( (1<<logm) < m_ )
+        ++logm;
+    bitReversal_.resize( m_ );
+    for( int i=0; i<m_; ++i )
+    {
+        int reversed = 0;
+        for( int bit=0; bit<logm; ++bit )
+            if( i & (1<<bit) )
+                reversed |= 1<<(logm-1-bit);
+        bitReversal_[i] = reversed;
+    }
+    twiddles_.resize( m_/2 );
+    for( int j=0; j<m_/2; ++j )
+    {
+        const R theta = -2*pi*j/m_;
+        twiddles_[j] = C( Cos(theta), Sin(theta) );
+    }
+
+    // Bluestein's algorithm rewrites jk = (j^2 + k^2 - (k-j)^2)/2 so that
+    // the transform becomes a convolution with the chirp exp(-+pi i t^2/n)
+    chirp_.clear();
+    chirpTransform_.clear();
+    if( !powerOfTwo && n > 0 )
+    {
+        const R sign = ( inverse ? R(1) : R(-1) );
+        chirp_.resize( n );
+        for( int t=0; t<n; ++t )
+        {
+            // Reduce t^2 modulo 2n to avoid losing accuracy for large t
+            const long long tSquared =
+                ((long long)t*(long long)t) % (2*(long long)n);
+            const R theta = sign*pi*R(tSquared)/n;
+            chirp_[t] = C( Cos(theta), Sin(theta) );
+        }
+        chirpTransform_.assign( m_, C(0) );
+        chirpTransform_[0] = Conj(chirp_[0]);
+        for( int t=1; t<n; ++t )
+            chirpTransform_[t] = chirpTransform_[m_-t] = Conj(chirp_[t]);
+        Radix2( &chirpTransform_[0], false );
+    }
+    work_.resize( powerOfTwo ? 0 : m_ );
+}
+
+template<typename R>
+inline void
+Plan<R>::Radix2( Complex<R>* x, bool inverse ) const
+{
+    typedef Complex<R> C;
+    const int m = m_;
+    for( int i=0; i<m; ++i )
+    {
+        const int j = bitReversal_[i];
+        if( i < j )
+        {
+            const C tmp = x[i];
+            x[i] = x[j];
+            x[j] = tmp;
+        }
+    }
+    for( int length=2; length<=m; length*=2 )
+    {
+        const int half = length/2;
+        const int stride = m/length;
+        for( int start=0; start<m; start+=length )
+        {
+            C* RESTRICT x0 = &x[start];
+            C* RESTRICT x1 = &x[start+half];
+            for( int k=0; k<half; ++k )
+            {
+                const C omega =
+                    ( inverse ? Conj(twiddles_[k*stride])
+                              : twiddles_[k*stride] );
+                const C u = x0[k];
+                const C v = omega*x1[k];
+                x0[k] = u + v;
+                x1[k] = u - v;
+            }
+        }
+    }
+}
+
+template<typename R>
+inline void
+Plan<R>::Apply( Complex<R>* x ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::Plan::Apply");
+#endif
+    typedef Complex<R> C;
+    const int n = n_;
+    if( n <= 1 )
+        return;
+    if( chirp_.empty() )
+    {
+        Radix2( x, inverse_ );
+        return;
+    }
+
+    // Convolve the chirp-modulated input with the conjugate chirp
+    C* w = &work_[0];
+    for( int t=0; t<n; ++t )
+        w[t] = x[t]*chirp_[t];
+    for( int t=n; t<m_; ++t )
+        w[t] = 0;
+    Radix2( w, false );
+    for( int t=0; t<m_; ++t )
+        w[t] *= chirpTransform_[t];
+    Radix2( w, true );
+    const R invm = R(1)/m_;
+    for( int k=0; k<n; ++k )
+        x[k] = invm*(chirp_[k]*w[k]);
+}
+
+// Convert between the (possibly real) datatype T and complex transforms
+template<typename R>
+inline void
+Store( R& alpha, const Complex<R>& beta )
+{ alpha = beta.real; }
+
+template<typename R>
+inline void
+Store( Complex<R>& alpha, const Complex<R>& beta )
+{ alpha = beta; }
+
+// Y := alpha op(A) X + beta Y, where op(A) is applied to full columns through
+// A.ApplyToColumns( orientation, X, Z ), which sets Z := op(A) X
+template<typename T,class Operator>
+inline void
+MultiplyColumns
+( const Operator& A, Orientation orientation,
+  T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::MultiplyColumns");
+#endif
+    const int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    const int width = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( X.Height() != width )
+        throw std::logic_error("X is the wrong height");
+    if( Y.Height() != height || Y.Width() != X.Width() )
+        throw std::logic_error("Y is the wrong size");
+    Matrix<T> Z;
+    A.ApplyToColumns( orientation, X, Z );
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+template<typename T,class Operator,Distribution U,Distribution V>
+inline void
+MultiplyColumns
+( const Operator& A, Orientation orientation,
+  T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y )
+{
+#ifndef RELEASE
+    CallStackEntry entry("fft::MultiplyColumns");
+#endif
+    const int height = ( orientation == NORMAL ? A.Height() : A.Width() );
+    const int width = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( X.Height() != width )
+        throw std::logic_error("X is the wrong height");
+    if( Y.Height() != height || Y.Width() != X.Width() )
+        throw std::logic_error("Y is the wrong size");
+    const Grid& g = X.Grid();
+    DistMatrix<T,STAR,VR> X_STAR_VR(g), Z_STAR_VR(g);
+    X_STAR_VR = X;
+    Z_STAR_VR.AlignWith( X_STAR_VR );
+    Z_STAR_VR.ResizeTo( height, X.Width() );
+    A.ApplyToColumns
+    ( orientation, X_STAR_VR.LockedMatrix(), Z_STAR_VR.Matrix() );
+    DistMatrix<T,U,V> Z(g);
+    Z.AlignWith( Y );
+    Z = Z_STAR_VR;
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+} // namespace fft
+
+// Overwrite each column of A with its (unnormalized) discrete Fourier
+// transform, or, if 'inverse' is true, its inverse transform
+template<typename R>
+inline void
+FFT( Matrix<Complex<R> >& A, bool inverse=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FFT");
+#endif
+    const int n = A.Height();
+    const int width = A.Width();
+    fft::Plan<R> plan( n, inverse );
+    for( int j=0; j<width; ++j )
+        plan.Apply( A.Buffer(0,j) );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+FFT( DistMatrix<Complex<R>,U,V>& A, bool inverse=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FFT");
+#endif
+    DistMatrix<Complex<R>,STAR,VR> A_STAR_VR( A.Grid() );
+    A_STAR_VR = A;
+    FFT( A_STAR_VR.Matrix(), inverse );
+    A = A_STAR_VR;
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_FFT_HPP
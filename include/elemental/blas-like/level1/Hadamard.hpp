@@ -0,0 +1,112 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_HADAMARD_HPP
+#define BLAS_HADAMARD_HPP
+
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
+namespace elem {
+
+// C(i,j) := A(i,j) B(i,j)
+// C may be the same matrix as A and/or B.
+
+template<typename T>
+inline void
+Hadamard( const Matrix<T>& A, const Matrix<T>& B, Matrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hadamard");
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        throw std::logic_error("Hadamard product requires equal dimensions");
+#endif
+    EntrywiseZip( A, B, C, entrywise::MultiplyZip() );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Hadamard
+( const DistMatrix<T,U,V>& A, const DistMatrix<T,U,V>& B,
+        DistMatrix<T,U,V>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hadamard");
+    if( A.Grid() != B.Grid() || A.Grid() != C.Grid() )
+        throw std::logic_error("Matrices must be distributed over same grid");
+    if( A.ColAlignment() != B.ColAlignment() ||
+        A.RowAlignment() != B.RowAlignment() )
+        throw std::logic_error("A and B must be aligned");
+#endif
+    EntrywiseZip( A, B, C, entrywise::MultiplyZip() );
+}
+
+template<typename R>
+inline void
+Hadamard
+( const SplitMatrix<R>& A, const SplitMatrix<R>& B, SplitMatrix<R>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hadamard");
+    if( A.Height() != B.Height() || A.Width() != B.Width() )
+        throw std::logic_error("Hadamard product requires equal dimensions");
+#endif
+    const int height = A.Height();
+    const int width = A.Width();
+    C.ResizeTo( height, width );
+    for( int j=0; j<width; ++j )
+    {
+        const R* ARe = A.LockedReal().LockedBuffer(0,j);
+        const R* AIm = A.LockedImag().LockedBuffer(0,j);
+        const R* BRe = B.LockedReal().LockedBuffer(0,j);
+        const R* BIm = B.LockedImag().LockedBuffer(0,j);
+        R* CRe = C.Real().Buffer(0,j);
+        R* CIm = C.Imag().Buffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            // Load both operands before storing, since C may alias them
+            const R alphaRe = ARe[i];
+            const R alphaIm = AIm[i];
+            const R betaRe = BRe[i];
+            const R betaIm = BIm[i];
+            CRe[i] = alphaRe*betaRe - alphaIm*betaIm;
+            CIm[i] = alphaRe*betaIm + alphaIm*betaRe;
+        }
+    }
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Hadamard
+( const SplitDistMatrix<R,U,V>& A, const SplitDistMatrix<R,U,V>& B,
+        SplitDistMatrix<R,U,V>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Hadamard");
+    if( A.Grid() != B.Grid() || A.Grid() != C.Grid() )
+        throw std::logic_error("Matrices must be distributed over same grid");
+    if( A.ColAlignment() != B.ColAlignment() ||
+        A.RowAlignment() != B.RowAlignment() )
+        throw std::logic_error("A and B must be aligned");
+#endif
+    if( &C != &A && &C != &B && !C.Viewing() )
+    {
+        C.Empty();
+        C.AlignWith( A.DistData() );
+        C.ResizeTo( A.Height(), A.Width() );
+    }
+    SplitMatrix<R> ALocal, BLocal, CLocal;
+    LockedLocalView( ALocal, A );
+    LockedLocalView( BLocal, B );
+    LocalView( CLocal, C );
+    Hadamard( ALocal, BLocal, CLocal );
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_HADAMARD_HPP
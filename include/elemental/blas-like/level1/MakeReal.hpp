@@ -10,6 +10,8 @@
 #ifndef BLAS_MAKEREAL_HPP
 #define BLAS_MAKEREAL_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename T>
@@ -19,13 +21,7 @@ MakeReal( Matrix<T>& A )
 #ifndef RELEASE
     CallStackEntry entry("MakeReal");
 #endif
-    T* ABuffer = A.Buffer();
-    const int height = A.Height();
-    const int width = A.Width();
-    const int ldim = A.LDim();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            ABuffer[i+j*ldim] = RealPart(ABuffer[i+j*ldim]);
+    EntrywiseMap( A, entrywise::RealPartMap() );
 }
 
 template<typename T,Distribution U,Distribution V>
@@ -38,6 +34,29 @@ MakeReal( DistMatrix<T,U,V>& A )
     MakeReal( A.Matrix() );
 }
 
+template<typename R>
+inline void
+MakeReal( SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeReal");
+#endif
+    // Only the (contiguous) imaginary parts need to be touched
+    EntrywiseMap( A.Imag(), entrywise::ZeroMap() );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+MakeReal( SplitDistMatrix<R,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeReal");
+#endif
+    SplitMatrix<R> ALocal;
+    LocalView( ALocal, A );
+    MakeReal( ALocal );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_MAKEREAL_HPP
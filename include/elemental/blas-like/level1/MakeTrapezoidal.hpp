@@ -10,8 +10,14 @@
 #ifndef BLAS_MAKETRAPEZOIDAL_HPP
 #define BLAS_MAKETRAPEZOIDAL_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
+// The entries outside of the (side,LOWER,offset) trapezoid are exactly those
+// of the (side,UPPER,offset+1) trapezoid, and those outside of the
+// (side,UPPER,offset) trapezoid form the (side,LOWER,offset-1) trapezoid
+
 template<typename T>
 inline void
 MakeTrapezoidal
@@ -20,67 +26,10 @@ MakeTrapezoidal
 #ifndef RELEASE
     CallStackEntry entry("MakeTrapezoidal");
 #endif
-    const int height = A.Height();
-    const int width = A.Width();
-    const int ldim = A.LDim();
-    T* buffer = A.Buffer();
-
     if( uplo == LOWER )
-    {
-        if( side == LEFT )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( int j=std::max(0,offset+1); j<width; ++j )
-            {
-                const int lastZeroRow = j-offset-1;
-                const int numZeroRows = std::min( lastZeroRow+1, height );
-                MemZero( &buffer[j*ldim], numZeroRows );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( int j=std::max(0,offset-height+width+1); j<width; ++j )
-            {
-                const int lastZeroRow = j-offset+height-width-1;
-                const int numZeroRows = std::min( lastZeroRow+1, height );
-                MemZero( &buffer[j*ldim], numZeroRows );
-            }
-        }
-    }
+        TrapezoidalMap( side, UPPER, offset+1, A, entrywise::ZeroMap() );
     else
-    {
-        if( side == LEFT )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( int j=0; j<width; ++j )
-            {
-                const int firstZeroRow = std::max(j-offset+1,0);
-                if( firstZeroRow < height )
-                    MemZero
-                    ( &buffer[firstZeroRow+j*ldim], height-firstZeroRow );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( int j=0; j<width; ++j )
-            {
-                const int firstZeroRow = std::max(j-offset+height-width+1,0);
-                if( firstZeroRow < height )
-                    MemZero
-                    ( &buffer[firstZeroRow+j*ldim], height-firstZeroRow );
-            }
-        }
-    }
+        TrapezoidalMap( side, LOWER, offset-1, A, entrywise::ZeroMap() );
 }
 
 template<typename T,Distribution U,Distribution V>
@@ -92,59 +41,10 @@ MakeTrapezoidal
 #ifndef RELEASE
     CallStackEntry entry("MakeTrapezoidal");
 #endif
-    const int height = A.Height();
-    const int width = A.Width();
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    const int colShift = A.ColShift();
-    const int rowShift = A.RowShift();
-    const int colStride = A.ColStride();
-    const int rowStride = A.RowStride();
-
-    T* buffer = A.Buffer();
-    const int ldim = A.LDim();
-
     if( uplo == LOWER )
-    {
-
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const int j = rowShift + jLocal*rowStride;
-            const int lastZeroRow =
-                ( side==LEFT ? j-offset-1
-                             : j-offset+height-width-1 );
-            if( lastZeroRow >= 0 )
-            {
-                const int boundary = std::min( lastZeroRow+1, height );
-                const int numZeroRows =
-                    Length_( boundary, colShift, colStride );
-                MemZero( &buffer[jLocal*ldim], numZeroRows );
-            }
-        }
-    }
+        TrapezoidalMap( side, UPPER, offset+1, A, entrywise::ZeroMap() );
     else
-    {
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const int j = rowShift + jLocal*rowStride;
-            const int firstZeroRow =
-                ( side==LEFT ? std::max(j-offset+1,0)
-                             : std::max(j-offset+height-width+1,0) );
-            const int numNonzeroRows =
-                Length_(firstZeroRow,colShift,colStride);
-            if( numNonzeroRows < localHeight )
-            {
-                T* col = &buffer[numNonzeroRows+jLocal*ldim];
-                MemZero( col, localHeight-numNonzeroRows );
-            }
-        }
-    }
+        TrapezoidalMap( side, LOWER, offset-1, A, entrywise::ZeroMap() );
 }
 
 } // namespace elem
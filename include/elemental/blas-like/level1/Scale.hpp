@@ -10,8 +10,24 @@
 #ifndef BLAS_SCALE_HPP
 #define BLAS_SCALE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
+namespace entrywise {
+
+template<typename T>
+class ScaleMap
+{
+public:
+    ScaleMap( T alpha ) : alpha_(alpha) { }
+    T operator()( const T& beta ) const { return alpha_*beta; }
+private:
+    T alpha_;
+};
+
+} // namespace entrywise
+
 template<typename T>
 inline void
 Scale( T alpha, Matrix<T>& X )
@@ -21,13 +37,11 @@ Scale( T alpha, Matrix<T>& X )
 #endif
     if( alpha != T(1) )
     {
+        // Explicitly zero X so that any NaN's are not propagated
         if( alpha == T(0) )
-            for( int j=0; j<X.Width(); ++j )
-                for( int i=0; i<X.Height(); ++i )
-                    X.Set(i,j,0);
+            EntrywiseMap( X, entrywise::ZeroMap() );
         else
-            for( int j=0; j<X.Width(); ++j )
-                blas::Scal( X.Height(), alpha, X.Buffer(0,j), 1 );
+            EntrywiseMap( X, entrywise::ScaleMap<T>( alpha ) );
     }
 }
 
@@ -66,6 +80,65 @@ inline void
 Scal( BASE(T) alpha, DistMatrix<T,U,V>& A )
 { Scale( T(alpha), A ); }
 
+template<typename R>
+inline void
+Scale( R alpha, SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Scale");
+#endif
+    Scale( alpha, A.Real() );
+    Scale( alpha, A.Imag() );
+}
+
+template<typename R>
+inline void
+Scale( Complex<R> alpha, SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Scale");
+#endif
+    if( alpha.imag == R(0) )
+    {
+        Scale( alpha.real, A );
+        return;
+    }
+    const R alphaRe = alpha.real;
+    const R alphaIm = alpha.imag;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        R* RESTRICT aRe = A.Real().Buffer(0,j);
+        R* RESTRICT aIm = A.Imag().Buffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            const R re = aRe[i];
+            const R im = aIm[i];
+            aRe[i] = alphaRe*re - alphaIm*im;
+            aIm[i] = alphaRe*im + alphaIm*re;
+        }
+    }
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Scale( R alpha, SplitDistMatrix<R,U,V>& A )
+{
+    SplitMatrix<R> ALocal;
+    LocalView( ALocal, A );
+    Scale( alpha, ALocal );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+Scale( Complex<R> alpha, SplitDistMatrix<R,U,V>& A )
+{
+    SplitMatrix<R> ALocal;
+    LocalView( ALocal, A );
+    Scale( alpha, ALocal );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_SCALE_HPP
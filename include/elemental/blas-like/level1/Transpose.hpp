@@ -35,18 +35,10 @@ Transpose( const Matrix<T>& A, Matrix<T>& B, bool conjugate=false )
     else
         B.ResizeTo( n, m );
 
-    if( conjugate )
-    {
-        for( int j=0; j<n; ++j )
-            for( int i=0; i<m; ++i )
-                B.Set(j,i,Conj(A.Get(i,j)));
-    }
-    else
-    {
-        for( int j=0; j<n; ++j )
-            for( int i=0; i<m; ++i )
-                B.Set(j,i,A.Get(i,j));
-    }
+    InterleaveMatrix
+    ( m, n,
+      A.LockedBuffer(), 1, A.LDim(),
+      B.Buffer(), B.LDim(), 1, conjugate );
 }
 
 template<typename T,Distribution U,Distribution V,
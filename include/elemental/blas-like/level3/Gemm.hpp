@@ -152,6 +152,7 @@ inline void LocalGemm
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/Split.hpp"
 
 namespace elem {
 
@@ -269,6 +270,93 @@ Gemm
     Gemm( orientationOfA, orientationOfB, alpha, A, B, T(0), C );
 }
 
+// C := alpha op(A) op(B) + beta C, where all of the matrices are stored in
+// split form and the complex product is formed from either three (GEMM_3M) or
+// four (GEMM_4M) real products
+template<typename R>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const SplitMatrix<R>& A, const SplitMatrix<R>& B,
+  Complex<R> beta,        SplitMatrix<R>& C,
+  ComplexGemmAlgorithm alg=GEMM_3M )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemm");
+#endif
+    if( alg == GEMM_3M )
+        gemm::Split3M
+        ( orientationOfA, orientationOfB,
+          alpha, A.LockedReal(), A.LockedImag(),
+                 B.LockedReal(), B.LockedImag(),
+          beta,  C.Real(),       C.Imag() );
+    else
+        gemm::Split4M
+        ( orientationOfA, orientationOfB,
+          alpha, A.LockedReal(), A.LockedImag(),
+                 B.LockedReal(), B.LockedImag(),
+          beta,  C.Real(),       C.Imag() );
+}
+
+template<typename R>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const SplitMatrix<R>& A, const SplitMatrix<R>& B,
+                          SplitMatrix<R>& C,
+  ComplexGemmAlgorithm alg=GEMM_3M )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemm");
+#endif
+    const int m = ( orientationOfA==NORMAL ? A.Height() : A.Width() );
+    const int n = ( orientationOfB==NORMAL ? B.Width() : B.Height() );
+    C.ResizeTo( m, n );
+    Gemm( orientationOfA, orientationOfB, alpha, A, B, Complex<R>(0), C, alg );
+}
+
+template<typename R>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const SplitDistMatrix<R>& A, const SplitDistMatrix<R>& B,
+  Complex<R> beta,        SplitDistMatrix<R>& C,
+  ComplexGemmAlgorithm alg=GEMM_3M )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemm");
+#endif
+    if( alg == GEMM_3M )
+        gemm::Split3M
+        ( orientationOfA, orientationOfB,
+          alpha, A.LockedReal(), A.LockedImag(),
+                 B.LockedReal(), B.LockedImag(),
+          beta,  C.Real(),       C.Imag() );
+    else
+        gemm::Split4M
+        ( orientationOfA, orientationOfB,
+          alpha, A.LockedReal(), A.LockedImag(),
+                 B.LockedReal(), B.LockedImag(),
+          beta,  C.Real(),       C.Imag() );
+}
+
+template<typename R>
+inline void
+Gemm
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const SplitDistMatrix<R>& A, const SplitDistMatrix<R>& B,
+                          SplitDistMatrix<R>& C,
+  ComplexGemmAlgorithm alg=GEMM_3M )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Gemm");
+#endif
+    const int m = ( orientationOfA==NORMAL ? A.Height() : A.Width() );
+    const int n = ( orientationOfB==NORMAL ? B.Width() : B.Height() );
+    C.ResizeTo( m, n );
+    Gemm( orientationOfA, orientationOfB, alpha, A, B, Complex<R>(0), C, alg );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_GEMM_HPP
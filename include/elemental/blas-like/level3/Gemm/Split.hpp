@@ -0,0 +1,213 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_GEMM_SPLIT_HPP
+#define BLAS_GEMM_SPLIT_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+
+//
+// Complex matrix products in split storage, op(A) op(B) = P = PRe + i PIm,
+// formed from real products of the real and imaginary parts. With
+// ARe' = op(ARe), AIm' = +-op(AIm) (negated for an adjoint), and similarly
+// for B,
+//
+//   4M: PRe = ARe' BRe' - AIm' BIm',  PIm = ARe' BIm' + AIm' BRe',
+//   3M: T1 = ARe' BRe', T2 = AIm' BIm', T3 = (ARe'+AIm')(BRe'+BIm'),
+//       PRe = T1 - T2,  PIm = T3 - T1 - T2.
+//
+// The same routines handle sequential and [MC,MR] matrices, as all of the
+// entrywise work is local to each process.
+//
+
+namespace elem {
+namespace gemm {
+
+// Make T an uninitialized matrix distributed (and aligned) as C
+template<typename R>
+inline void
+MakeLike( const Matrix<R>& C, Matrix<R>& T )
+{ T.ResizeTo( C.Height(), C.Width() ); }
+
+template<typename R>
+inline void
+MakeLike( const DistMatrix<R>& C, DistMatrix<R>& T )
+{
+    T.SetGrid( C.Grid() );
+    T.AlignWith( C );
+    T.ResizeTo( C.Height(), C.Width() );
+}
+
+template<typename R>
+inline Matrix<R>&
+LocalPart( Matrix<R>& A )
+{ return A; }
+
+template<typename R>
+inline const Matrix<R>&
+LockedLocalPart( const Matrix<R>& A )
+{ return A; }
+
+template<typename R>
+inline Matrix<R>&
+LocalPart( DistMatrix<R>& A )
+{ return A.Matrix(); }
+
+template<typename R>
+inline const Matrix<R>&
+LockedLocalPart( const DistMatrix<R>& A )
+{ return A.LockedMatrix(); }
+
+// Z := X + sigma Y, where Y is distributed (and aligned) as X
+template<typename R,class RealMatrix>
+inline void
+SplitSum( const RealMatrix& X, R sigma, const RealMatrix& Y, RealMatrix& Z )
+{
+    MakeLike( X, Z );
+    const Matrix<R>& XLoc = LockedLocalPart( X );
+    const Matrix<R>& YLoc = LockedLocalPart( Y );
+    Matrix<R>& ZLoc = LocalPart( Z );
+    const int height = XLoc.Height();
+    const int width = XLoc.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT x = XLoc.LockedBuffer(0,j);
+        const R* RESTRICT y = YLoc.LockedBuffer(0,j);
+        R* RESTRICT z = ZLoc.Buffer(0,j);
+        for( int i=0; i<height; ++i )
+            z[i] = x[i] + sigma*y[i];
+    }
+}
+
+// C := alpha P + beta C in a single pass, where PRe and PIm are distributed
+// as CRe and CIm
+template<typename R,class RealMatrix>
+inline void
+SplitUpdate
+( Complex<R> alpha, const RealMatrix& PRe, const RealMatrix& PIm,
+  Complex<R> beta,        RealMatrix& CRe,       RealMatrix& CIm )
+{
+    const Matrix<R>& PReLoc = LockedLocalPart( PRe );
+    const Matrix<R>& PImLoc = LockedLocalPart( PIm );
+    Matrix<R>& CReLoc = LocalPart( CRe );
+    Matrix<R>& CImLoc = LocalPart( CIm );
+    const R alphaRe = alpha.real;
+    const R alphaIm = alpha.imag;
+    const R betaRe = beta.real;
+    const R betaIm = beta.imag;
+    const int height = CReLoc.Height();
+    const int width = CReLoc.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT pRe = PReLoc.LockedBuffer(0,j);
+        const R* RESTRICT pIm = PImLoc.LockedBuffer(0,j);
+        R* RESTRICT cRe = CReLoc.Buffer(0,j);
+        R* RESTRICT cIm = CImLoc.Buffer(0,j);
+        if( betaRe == R(0) && betaIm == R(0) )
+        {
+            // Avoid propagating any NaNs from the original C
+            for( int i=0; i<height; ++i )
+            {
+                cRe[i] = alphaRe*pRe[i] - alphaIm*pIm[i];
+                cIm[i] = alphaRe*pIm[i] + alphaIm*pRe[i];
+            }
+        }
+        else
+        {
+            for( int i=0; i<height; ++i )
+            {
+                const R gammaRe = cRe[i];
+                const R gammaIm = cIm[i];
+                cRe[i] = betaRe*gammaRe - betaIm*gammaIm +
+                         alphaRe*pRe[i] - alphaIm*pIm[i];
+                cIm[i] = betaRe*gammaIm + betaIm*gammaRe +
+                         alphaRe*pIm[i] + alphaIm*pRe[i];
+            }
+        }
+    }
+}
+
+template<typename R,class RealMatrix>
+inline void
+Split3M
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const RealMatrix& ARe, const RealMatrix& AIm,
+                    const RealMatrix& BRe, const RealMatrix& BIm,
+  Complex<R> beta,        RealMatrix& CRe,       RealMatrix& CIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("gemm::Split3M");
+#endif
+    const Orientation orientA = ( orientationOfA==NORMAL ? NORMAL : TRANSPOSE );
+    const Orientation orientB = ( orientationOfB==NORMAL ? NORMAL : TRANSPOSE );
+    const R signA = ( orientationOfA==ADJOINT ? R(-1) : R(1) );
+    const R signB = ( orientationOfB==ADJOINT ? R(-1) : R(1) );
+
+    RealMatrix T1, T2, T3, ASum, BSum;
+    MakeLike( CRe, T1 );
+    MakeLike( CRe, T2 );
+    MakeLike( CRe, T3 );
+    Gemm( orientA, orientB, R(1), ARe, BRe, R(0), T1 );
+    Gemm( orientA, orientB, signA*signB, AIm, BIm, R(0), T2 );
+    SplitSum( ARe, signA, AIm, ASum );
+    SplitSum( BRe, signB, BIm, BSum );
+    Gemm( orientA, orientB, R(1), ASum, BSum, R(0), T3 );
+    ASum.Empty();
+    BSum.Empty();
+
+    // PIm := T3 - T1 - T2 (in T3) and PRe := T1 - T2 (in T1)
+    Axpy( R(-1), T1, T3 );
+    Axpy( R(-1), T2, T3 );
+    Axpy( R(-1), T2, T1 );
+    SplitUpdate( alpha, T1, T3, beta, CRe, CIm );
+}
+
+template<typename R,class RealMatrix>
+inline void
+Split4M
+( Orientation orientationOfA, Orientation orientationOfB,
+  Complex<R> alpha, const RealMatrix& ARe, const RealMatrix& AIm,
+                    const RealMatrix& BRe, const RealMatrix& BIm,
+  Complex<R> beta,        RealMatrix& CRe,       RealMatrix& CIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("gemm::Split4M");
+#endif
+    const Orientation orientA = ( orientationOfA==NORMAL ? NORMAL : TRANSPOSE );
+    const Orientation orientB = ( orientationOfB==NORMAL ? NORMAL : TRANSPOSE );
+    const R signA = ( orientationOfA==ADJOINT ? R(-1) : R(1) );
+    const R signB = ( orientationOfB==ADJOINT ? R(-1) : R(1) );
+
+    if( alpha.imag == R(0) && beta.imag == R(0) )
+    {
+        // The products can be accumulated directly into C
+        const R alphaRe = alpha.real;
+        const R betaRe = beta.real;
+        Gemm( orientA, orientB, alphaRe, ARe, BRe, betaRe, CRe );
+        Gemm( orientA, orientB, -signA*signB*alphaRe, AIm, BIm, R(1), CRe );
+        Gemm( orientA, orientB, signB*alphaRe, ARe, BIm, betaRe, CIm );
+        Gemm( orientA, orientB, signA*alphaRe, AIm, BRe, R(1), CIm );
+    }
+    else
+    {
+        RealMatrix PRe, PIm;
+        MakeLike( CRe, PRe );
+        MakeLike( CRe, PIm );
+        Gemm( orientA, orientB, R(1), ARe, BRe, R(0), PRe );
+        Gemm( orientA, orientB, -signA*signB, AIm, BIm, R(1), PRe );
+        Gemm( orientA, orientB, signB, ARe, BIm, R(0), PIm );
+        Gemm( orientA, orientB, signA, AIm, BRe, R(1), PIm );
+        SplitUpdate( alpha, PRe, PIm, beta, CRe, CIm );
+    }
+}
+
+} // namespace gemm
+} // namespace elem
+
+#endif // ifndef BLAS_GEMM_SPLIT_HPP
@@ -68,6 +68,33 @@ Her2k
     Syr2k( uplo, orientation, alpha, A, B, T(0), C, true );
 }
 
+// Only the triangle stored by C is updated
+template<typename T>
+inline void
+Her2k
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Her2k");
+#endif
+    Syr2k( orientation, alpha, A, B, beta, C, true );
+}
+
+template<typename T>
+inline void
+Her2k
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+                 PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Her2k");
+#endif
+    Syr2k( uplo, orientation, alpha, A, B, C, true );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_HER2K_HPP
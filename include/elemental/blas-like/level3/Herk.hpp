@@ -66,6 +66,31 @@ Herk
     Syrk( uplo, orientation, alpha, A, T(0), C, true );
 }
 
+// Only the triangle stored by C is updated
+template<typename T>
+inline void
+Herk
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, T beta, PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Herk");
+#endif
+    Syrk( orientation, alpha, A, beta, C, true );
+}
+
+template<typename T>
+inline void
+Herk
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DistMatrix<T>& A, PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Herk");
+#endif
+    Syrk( uplo, orientation, alpha, A, C, true );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_HERK_HPP
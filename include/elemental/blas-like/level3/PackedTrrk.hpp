@@ -0,0 +1,265 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_PACKEDTRRK_HPP
+#define BLAS_PACKEDTRRK_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+
+//
+// Versions of LocalTrrk and LocalTrr2k which update the stored triangle of a
+// PackedDistMatrix, e.g.,
+//
+//     C[MC,MR] := alpha A[MC,* ] B[* ,MR] + beta C[MC,MR]   (stored triangle)
+//
+// Each panel of Blocksize() local columns of C is formed with a single Gemm
+// over the range of local rows which intersect the triangle within the panel,
+// and the result is then added into the packed columns.
+//
+
+namespace elem {
+namespace internal {
+
+// A := alpha A within the stored triangle
+template<typename T,Distribution U,Distribution V>
+inline void
+ScalePacked( T alpha, PackedDistMatrix<T,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::ScalePacked");
+#endif
+    if( alpha == T(1) )
+        return;
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int begin = A.LocalColumnBegin( jLocal );
+        const int end = A.LocalColumnEnd( jLocal );
+        if( begin >= end )
+            continue;
+        T* RESTRICT ACol = A.Buffer( begin, jLocal );
+        for( int iLocal=0; iLocal<end-begin; ++iLocal )
+            ACol[iLocal] *= alpha;
+    }
+}
+
+// E := alpha (op(A) op(B) + op(C) op(D)) + beta E within the stored triangle,
+// where op(A) and op(C) are E.LocalHeight() x k and op(B) and op(D) are
+// k x E.LocalWidth(). If C is NULL, then only the first product is used.
+template<typename T>
+inline void
+LocalTrr2kPacked
+( Orientation orientationOfA, Orientation orientationOfB,
+  Orientation orientationOfC, Orientation orientationOfD,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+           const Matrix<T>* C, const Matrix<T>* D,
+  T beta,  PackedDistMatrix<T>& E )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::LocalTrr2kPacked");
+#endif
+    const int localWidth = E.LocalWidth();
+    const int bsize = Blocksize();
+    Matrix<T> A1, B1, C1, D1, W;
+    for( int jStart=0; jStart<localWidth; jStart+=bsize )
+    {
+        const int nb = std::min(bsize,localWidth-jStart);
+
+        // The local rows of the triangle within this panel of columns
+        const int iStart = E.LocalColumnBegin( jStart );
+        const int iEnd = E.LocalColumnEnd( jStart+nb-1 );
+        if( iStart >= iEnd )
+            continue;
+        const int mb = iEnd - iStart;
+
+        W.ResizeTo( mb, nb );
+        if( orientationOfA == NORMAL )
+            LockedView( A1, A, iStart, 0, mb, A.Width() );
+        else
+            LockedView( A1, A, 0, iStart, A.Height(), mb );
+        if( orientationOfB == NORMAL )
+            LockedView( B1, B, 0, jStart, B.Height(), nb );
+        else
+            LockedView( B1, B, jStart, 0, nb, B.Width() );
+        Gemm( orientationOfA, orientationOfB, alpha, A1, B1, T(0), W );
+        if( C != 0 )
+        {
+            if( orientationOfC == NORMAL )
+                LockedView( C1, *C, iStart, 0, mb, C->Width() );
+            else
+                LockedView( C1, *C, 0, iStart, C->Height(), mb );
+            if( orientationOfD == NORMAL )
+                LockedView( D1, *D, 0, jStart, D->Height(), nb );
+            else
+                LockedView( D1, *D, jStart, 0, nb, D->Width() );
+            Gemm( orientationOfC, orientationOfD, alpha, C1, D1, T(1), W );
+        }
+
+        for( int jLocal=jStart; jLocal<jStart+nb; ++jLocal )
+        {
+            const int begin = E.LocalColumnBegin( jLocal );
+            const int end = E.LocalColumnEnd( jLocal );
+            if( begin >= end )
+                continue;
+            T* RESTRICT ECol = E.Buffer( begin, jLocal );
+            const T* RESTRICT WCol =
+                W.LockedBuffer( begin-iStart, jLocal-jStart );
+            if( beta == T(0) )
+                for( int iLocal=0; iLocal<end-begin; ++iLocal )
+                    ECol[iLocal] = WCol[iLocal];
+            else
+                for( int iLocal=0; iLocal<end-begin; ++iLocal )
+                    ECol[iLocal] = beta*ECol[iLocal] + WCol[iLocal];
+        }
+    }
+}
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+CheckPackedTrrk
+( const DistMatrix<T,U,V>& A, const DistMatrix<T,W,Z>& B,
+  const PackedDistMatrix<T>& C )
+{
+    if( A.Grid() != C.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error("All matrices must use the same grid");
+    const bool AIsCol = ( U == MC );
+    const bool BIsRow = ( Z == MR );
+    const int AHeight = ( AIsCol ? A.Height() : A.Width() );
+    const int BWidth = ( BIsRow ? B.Width() : B.Height() );
+    const int AWidth = ( AIsCol ? A.Width() : A.Height() );
+    const int BHeight = ( BIsRow ? B.Height() : B.Width() );
+    if( AHeight != C.Height() || BWidth != C.Width() || AWidth != BHeight )
+        throw std::logic_error("Nonconformal packed LocalTrrk");
+    const int AColAlignment =
+        ( AIsCol ? A.ColAlignment() : A.RowAlignment() );
+    const int BRowAlignment =
+        ( BIsRow ? B.RowAlignment() : B.ColAlignment() );
+    if( AColAlignment != C.ColAlignment() ||
+        BRowAlignment != C.RowAlignment() )
+        throw std::logic_error("Misaligned packed LocalTrrk");
+}
+
+} // namespace internal
+
+// C := alpha A B + beta C within the stored triangle of C
+template<typename T>
+inline void
+LocalTrrk
+( T alpha, const DistMatrix<T,MC,  STAR>& A,
+           const DistMatrix<T,STAR,MR  >& B,
+  T beta,        PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrrk");
+    internal::CheckPackedTrrk( A, B, C );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( NORMAL, NORMAL, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), 0, 0, beta, C );
+}
+
+// C := alpha A op(B) + beta C within the stored triangle of C
+template<typename T>
+inline void
+LocalTrrk
+( Orientation orientationOfB,
+  T alpha, const DistMatrix<T,MC,STAR>& A,
+           const DistMatrix<T,MR,STAR>& B,
+  T beta,        PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrrk");
+    internal::CheckPackedTrrk( A, B, C );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( NORMAL, orientationOfB, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), 0, 0, beta, C );
+}
+
+// C := alpha op(A) B + beta C within the stored triangle of C
+template<typename T>
+inline void
+LocalTrrk
+( Orientation orientationOfA,
+  T alpha, const DistMatrix<T,STAR,MC>& A,
+           const DistMatrix<T,STAR,MR>& B,
+  T beta,        PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrrk");
+    internal::CheckPackedTrrk( A, B, C );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( orientationOfA, NORMAL, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), 0, 0, beta, C );
+}
+
+// C := alpha op(A) op(B) + beta C within the stored triangle of C
+template<typename T>
+inline void
+LocalTrrk
+( Orientation orientationOfA, Orientation orientationOfB,
+  T alpha, const DistMatrix<T,STAR,MC  >& A,
+           const DistMatrix<T,MR,  STAR>& B,
+  T beta,        PackedDistMatrix<T>& C )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrrk");
+    internal::CheckPackedTrrk( A, B, C );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( orientationOfA, orientationOfB, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), 0, 0, beta, C );
+}
+
+// E := alpha (A B + C D) + beta E within the stored triangle of E
+template<typename T>
+inline void
+LocalTrr2k
+( T alpha, const DistMatrix<T,MC,  STAR>& A, const DistMatrix<T,STAR,MR>& B,
+           const DistMatrix<T,MC,  STAR>& C, const DistMatrix<T,STAR,MR>& D,
+  T beta,        PackedDistMatrix<T>& E )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrr2k");
+    internal::CheckPackedTrrk( A, B, E );
+    internal::CheckPackedTrrk( C, D, E );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( NORMAL, NORMAL, NORMAL, NORMAL,
+      alpha, A.LockedMatrix(), B.LockedMatrix(),
+      &C.LockedMatrix(), &D.LockedMatrix(), beta, E );
+}
+
+// E := alpha (op(A) op(B) + op(C) op(D)) + beta E within the stored triangle
+// of E
+template<typename T>
+inline void
+LocalTrr2k
+( Orientation orientationOfA, Orientation orientationOfB,
+  Orientation orientationOfC, Orientation orientationOfD,
+  T alpha, const DistMatrix<T,STAR,MC>& A, const DistMatrix<T,MR,STAR>& B,
+           const DistMatrix<T,STAR,MC>& C, const DistMatrix<T,MR,STAR>& D,
+  T beta,        PackedDistMatrix<T>& E )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LocalTrr2k");
+    internal::CheckPackedTrrk( A, B, E );
+    internal::CheckPackedTrrk( C, D, E );
+#endif
+    internal::LocalTrr2kPacked<T>
+    ( orientationOfA, orientationOfB, orientationOfC, orientationOfD,
+      alpha, A.LockedMatrix(), B.LockedMatrix(),
+      &C.LockedMatrix(), &D.LockedMatrix(), beta, E );
+}
+
+} // namespace elem
+
+#endif // ifndef BLAS_PACKEDTRRK_HPP
@@ -14,6 +14,7 @@
 #include "./Syr2k/LT.hpp"
 #include "./Syr2k/UN.hpp"
 #include "./Syr2k/UT.hpp"
+#include "./Syr2k/Packed.hpp"
 
 namespace elem {
 
@@ -112,6 +113,37 @@ Syr2k
     Syr2k( uplo, orientation, alpha, A, B, T(0), C, conjugate );
 }
 
+// Only the triangle stored by C is updated
+template<typename T>
+inline void
+Syr2k
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Syr2k");
+#endif
+    internal::Syr2kPacked( orientation, alpha, A, B, beta, C, conjugate );
+}
+
+template<typename T>
+inline void
+Syr2k
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+                 PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Syr2k");
+#endif
+    const int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    C.ResizeTo( uplo, n );
+    internal::Syr2kPacked( orientation, alpha, A, B, T(0), C, conjugate );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_SYR2K_HPP
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_SYR2K_PACKED_HPP
+#define BLAS_SYR2K_PACKED_HPP
+
+#include "elemental/blas-like/level3/PackedTrrk.hpp"
+
+namespace elem {
+namespace internal {
+
+// C := alpha (op(A) op(B)^{T/H} + op(B) op(A)^{T/H}) + beta C, where only the
+// stored triangle of the packed matrix C is formed
+template<typename T>
+inline void
+Syr2kPacked
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, const DistMatrix<T>& B,
+  T beta,        PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::Syr2kPacked");
+    if( A.Grid() != B.Grid() || B.Grid() != C.Grid() )
+        throw std::logic_error
+        ("{A,B,C} must be distributed over the same grid");
+    const int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    if( A.Height() != B.Height() || A.Width() != B.Width() ||
+        n != C.Height() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal Syr2kPacked:\n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  B ~ " << B.Height() << " x " << B.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    const Grid& g = A.Grid();
+    ScalePacked( beta, C );
+    if( orientation == NORMAL )
+    {
+        // Matrix views
+        DistMatrix<T> AL(g), AR(g),
+                      A0(g), A1(g), A2(g);
+        DistMatrix<T> BL(g), BR(g),
+                      B0(g), B1(g), B2(g);
+
+        // Temporary distributions
+        DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
+        DistMatrix<T,MC,  STAR> B1_MC_STAR(g);
+        DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
+        DistMatrix<T,VR,  STAR> B1_VR_STAR(g);
+        DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+        DistMatrix<T,STAR,MR  > B1Trans_STAR_MR(g);
+
+        A1_MC_STAR.AlignWith( C.DistData() );
+        B1_MC_STAR.AlignWith( C.DistData() );
+        A1_VR_STAR.AlignWith( C.DistData() );
+        B1_VR_STAR.AlignWith( C.DistData() );
+        A1Trans_STAR_MR.AlignWith( C.DistData() );
+        B1Trans_STAR_MR.AlignWith( C.DistData() );
+
+        LockedPartitionRight( A, AL, AR, 0 );
+        LockedPartitionRight( B, BL, BR, 0 );
+        while( AR.Width() > 0 )
+        {
+            LockedRepartitionRight
+            ( AL, /**/ AR,
+              A0, /**/ A1, A2 );
+
+            LockedRepartitionRight
+            ( BL, /**/ BR,
+              B0, /**/ B1, B2 );
+
+            //----------------------------------------------------------------//
+            A1_VR_STAR = A1_MC_STAR = A1;
+            A1Trans_STAR_MR.TransposeFrom( A1_VR_STAR, conjugate );
+
+            B1_VR_STAR = B1_MC_STAR = B1;
+            B1Trans_STAR_MR.TransposeFrom( B1_VR_STAR, conjugate );
+
+            LocalTrr2k
+            ( alpha, A1_MC_STAR, B1Trans_STAR_MR,
+                     B1_MC_STAR, A1Trans_STAR_MR,
+              T(1),  C );
+            //----------------------------------------------------------------//
+
+            SlideLockedPartitionRight
+            ( AL,     /**/ AR,
+              A0, A1, /**/ A2 );
+
+            SlideLockedPartitionRight
+            ( BL,     /**/ BR,
+              B0, B1, /**/ B2 );
+        }
+    }
+    else
+    {
+        const Orientation adjOrTrans = ( conjugate ? ADJOINT : TRANSPOSE );
+
+        // Matrix views
+        DistMatrix<T> AT(g),  A0(g),
+                      AB(g),  A1(g),
+                              A2(g);
+        DistMatrix<T> BT(g),  B0(g),
+                      BB(g),  B1(g),
+                              B2(g);
+
+        // Temporary distributions
+        DistMatrix<T,MR,  STAR> A1Trans_MR_STAR(g);
+        DistMatrix<T,MR,  STAR> B1Trans_MR_STAR(g);
+        DistMatrix<T,STAR,VR  > A1_STAR_VR(g);
+        DistMatrix<T,STAR,VR  > B1_STAR_VR(g);
+        DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+        DistMatrix<T,STAR,MC  > B1_STAR_MC(g);
+
+        A1Trans_MR_STAR.AlignWith( C.DistData() );
+        B1Trans_MR_STAR.AlignWith( C.DistData() );
+        A1_STAR_MC.AlignWith( C.DistData() );
+        B1_STAR_MC.AlignWith( C.DistData() );
+
+        LockedPartitionDown
+        ( A, AT,
+             AB, 0 );
+        LockedPartitionDown
+        ( B, BT,
+             BB, 0 );
+        while( AB.Height() > 0 )
+        {
+            LockedRepartitionDown
+            ( AT,  A0,
+             /**/ /**/
+                   A1,
+              AB,  A2 );
+
+            LockedRepartitionDown
+            ( BT,  B0,
+             /**/ /**/
+                   B1,
+              BB,  B2 );
+
+            //----------------------------------------------------------------//
+            A1Trans_MR_STAR.TransposeFrom( A1 );
+            A1_STAR_VR.TransposeFrom( A1Trans_MR_STAR );
+            A1_STAR_MC = A1_STAR_VR;
+
+            B1Trans_MR_STAR.TransposeFrom( B1 );
+            B1_STAR_VR.TransposeFrom( B1Trans_MR_STAR );
+            B1_STAR_MC = B1_STAR_VR;
+
+            LocalTrr2k
+            ( adjOrTrans, TRANSPOSE, adjOrTrans, TRANSPOSE,
+              alpha, A1_STAR_MC, B1Trans_MR_STAR,
+                     B1_STAR_MC, A1Trans_MR_STAR,
+              T(1),  C );
+            //----------------------------------------------------------------//
+
+            SlideLockedPartitionDown
+            ( AT,  A0,
+                   A1,
+             /**/ /**/
+              AB,  A2 );
+
+            SlideLockedPartitionDown
+            ( BT,  B0,
+                   B1,
+             /**/ /**/
+              BB,  B2 );
+        }
+    }
+}
+
+} // namespace internal
+} // namespace elem
+
+#endif // ifndef BLAS_SYR2K_PACKED_HPP
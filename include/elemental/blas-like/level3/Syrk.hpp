@@ -14,6 +14,7 @@
 #include "./Syrk/LT.hpp"
 #include "./Syrk/UN.hpp"
 #include "./Syrk/UT.hpp"
+#include "./Syrk/Packed.hpp"
 
 namespace elem {
 
@@ -106,6 +107,35 @@ Syrk
     Syrk( uplo, orientation, alpha, A, T(0), C, conjugate );
 }
 
+// Only the triangle stored by C is updated
+template<typename T>
+inline void
+Syrk
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, T beta, PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Syrk");
+#endif
+    internal::SyrkPacked( orientation, alpha, A, beta, C, conjugate );
+}
+
+template<typename T>
+inline void
+Syrk
+( UpperOrLower uplo, Orientation orientation,
+  T alpha, const DistMatrix<T>& A, PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Syrk");
+#endif
+    const int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    C.ResizeTo( uplo, n );
+    internal::SyrkPacked( orientation, alpha, A, T(0), C, conjugate );
+}
+
 } // namespace elem
 
 #endif // ifndef BLAS_SYRK_HPP
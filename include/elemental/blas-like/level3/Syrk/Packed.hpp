@@ -0,0 +1,127 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_SYRK_PACKED_HPP
+#define BLAS_SYRK_PACKED_HPP
+
+#include "elemental/blas-like/level3/PackedTrrk.hpp"
+
+namespace elem {
+namespace internal {
+
+// C := alpha op(A) op(A)^{T/H} + beta C, where only the stored triangle of
+// the packed matrix C is formed
+template<typename T>
+inline void
+SyrkPacked
+( Orientation orientation,
+  T alpha, const DistMatrix<T>& A, T beta, PackedDistMatrix<T>& C,
+  bool conjugate=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("internal::SyrkPacked");
+    if( A.Grid() != C.Grid() )
+        throw std::logic_error
+        ("A and C must be distributed over the same grid");
+    const int n = ( orientation==NORMAL ? A.Height() : A.Width() );
+    if( n != C.Height() )
+    {
+        std::ostringstream msg;
+        msg << "Nonconformal SyrkPacked:\n"
+            << "  A ~ " << A.Height() << " x " << A.Width() << "\n"
+            << "  C ~ " << C.Height() << " x " << C.Width() << "\n";
+        throw std::logic_error( msg.str().c_str() );
+    }
+#endif
+    const Grid& g = A.Grid();
+    ScalePacked( beta, C );
+    if( orientation == NORMAL )
+    {
+        // Matrix views
+        DistMatrix<T> AL(g), AR(g),
+                      A0(g), A1(g), A2(g);
+
+        // Temporary distributions
+        DistMatrix<T,MC,  STAR> A1_MC_STAR(g);
+        DistMatrix<T,VR,  STAR> A1_VR_STAR(g);
+        DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
+
+        A1_MC_STAR.AlignWith( C.DistData() );
+        A1_VR_STAR.AlignWith( C.DistData() );
+        A1Trans_STAR_MR.AlignWith( C.DistData() );
+
+        LockedPartitionRight( A, AL, AR, 0 );
+        while( AR.Width() > 0 )
+        {
+            LockedRepartitionRight
+            ( AL, /**/ AR,
+              A0, /**/ A1, A2 );
+
+            //----------------------------------------------------------------//
+            A1_VR_STAR = A1_MC_STAR = A1;
+            A1Trans_STAR_MR.TransposeFrom( A1_VR_STAR, conjugate );
+            LocalTrrk( alpha, A1_MC_STAR, A1Trans_STAR_MR, T(1), C );
+            //----------------------------------------------------------------//
+
+            SlideLockedPartitionRight
+            ( AL,     /**/ AR,
+              A0, A1, /**/ A2 );
+        }
+    }
+    else
+    {
+        const Orientation adjOrTrans = ( conjugate ? ADJOINT : TRANSPOSE );
+
+        // Matrix views
+        DistMatrix<T> AT(g),  A0(g),
+                      AB(g),  A1(g),
+                              A2(g);
+
+        // Temporary distributions
+        DistMatrix<T,MR,  STAR> A1Trans_MR_STAR(g);
+        DistMatrix<T,STAR,VR  > A1_STAR_VR(g);
+        DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
+
+        A1Trans_MR_STAR.AlignWith( C.DistData() );
+        A1_STAR_MC.AlignWith( C.DistData() );
+
+        LockedPartitionDown
+        ( A, AT,
+             AB, 0 );
+        while( AB.Height() > 0 )
+        {
+            LockedRepartitionDown
+            ( AT,  A0,
+             /**/ /**/
+                   A1,
+              AB,  A2 );
+
+            //----------------------------------------------------------------//
+            A1Trans_MR_STAR.TransposeFrom( A1 );
+            A1_STAR_VR.TransposeFrom( A1Trans_MR_STAR );
+            A1_STAR_MC = A1_STAR_VR;
+
+            LocalTrrk
+            ( adjOrTrans, TRANSPOSE,
+              alpha, A1_STAR_MC, A1Trans_MR_STAR, T(1), C );
+            //----------------------------------------------------------------//
+
+            SlideLockedPartitionDown
+            ( AT,  A0,
+                   A1,
+             /**/ /**/
+              AB,  A2 );
+        }
+    }
+}
+
+} // namespace internal
+} // namespace elem
+
+#endif // ifndef BLAS_SYRK_PACKED_HPP
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef BLAS_TASKS_HPP
+#define BLAS_TASKS_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+
+//
+// Sequential level 3 BLAS calls on tiles of a Matrix, packaged as tasks for a
+// TaskGraph. Each task keeps views of its operands, so the underlying matrix
+// must outlive the execution of the graph.
+//
+
+namespace elem {
+
+// View the (i,j) tile of A given the tile boundaries of its rows and columns
+template<typename F>
+inline void
+ViewTile
+( Matrix<F>& ATile, Matrix<F>& A,
+  const std::vector<int>& rowOffsets, const std::vector<int>& colOffsets,
+  int i, int j )
+{
+    View
+    ( ATile, A, rowOffsets[i], colOffsets[j],
+      rowOffsets[i+1]-rowOffsets[i], colOffsets[j+1]-colOffsets[j] );
+}
+
+template<typename F>
+class GemmTask : public Task
+{
+public:
+    GemmTask
+    ( Orientation orientationOfA, Orientation orientationOfB,
+      F alpha, const Matrix<F>& A, const Matrix<F>& B, F beta, Matrix<F>& C )
+    : orientationOfA_(orientationOfA), orientationOfB_(orientationOfB),
+      alpha_(alpha), beta_(beta)
+    { LockedView( A_, A ); LockedView( B_, B ); View( C_, C ); }
+
+    void Run()
+    { Gemm( orientationOfA_, orientationOfB_, alpha_, A_, B_, beta_, C_ ); }
+
+private:
+    Orientation orientationOfA_, orientationOfB_;
+    F alpha_, beta_;
+    Matrix<F> A_, B_, C_;
+};
+
+template<typename F>
+class HerkTask : public Task
+{
+public:
+    HerkTask
+    ( UpperOrLower uplo, Orientation orientation,
+      F alpha, const Matrix<F>& A, F beta, Matrix<F>& C )
+    : uplo_(uplo), orientation_(orientation), alpha_(alpha), beta_(beta)
+    { LockedView( A_, A ); View( C_, C ); }
+
+    void Run()
+    { Herk( uplo_, orientation_, alpha_, A_, beta_, C_ ); }
+
+private:
+    UpperOrLower uplo_;
+    Orientation orientation_;
+    F alpha_, beta_;
+    Matrix<F> A_, C_;
+};
+
+template<typename F>
+class TrsmTask : public Task
+{
+public:
+    TrsmTask
+    ( LeftOrRight side, UpperOrLower uplo,
+      Orientation orientation, UnitOrNonUnit diag,
+      F alpha, const Matrix<F>& A, Matrix<F>& B )
+    : side_(side), uplo_(uplo), orientation_(orientation), diag_(diag),
+      alpha_(alpha)
+    { LockedView( A_, A ); View( B_, B ); }
+
+    void Run()
+    { Trsm( side_, uplo_, orientation_, diag_, alpha_, A_, B_ ); }
+
+private:
+    LeftOrRight side_;
+    UpperOrLower uplo_;
+    Orientation orientation_;
+    UnitOrNonUnit diag_;
+    F alpha_;
+    Matrix<F> A_, B_;
+};
+
+} // namespace elem
+
+#endif // ifndef BLAS_TASKS_HPP
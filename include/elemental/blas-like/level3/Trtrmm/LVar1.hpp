@@ -104,14 +104,14 @@ TrtrmmLVar1( Orientation orientation, DistMatrix<T>& L )
         LocalTrrk
         ( LOWER, orientation, T(1), L10_STAR_MC, L10_STAR_MR, T(1), L00 );
 
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, L11, L11_STAR_STAR );
         LocalTrmm
         ( LEFT, LOWER, orientation, NON_UNIT, 
           T(1), L11_STAR_STAR, L10_STAR_VR );
         L10 = L10_STAR_VR;
 
         LocalTrtrmm( orientation, LOWER, L11_STAR_STAR );
-        L11 = L11_STAR_STAR;
+        RedistributeTriangle( LOWER, L11_STAR_STAR, L11 );
         //--------------------------------------------------------------------//
 
         SlidePartitionDownDiagonal
@@ -100,14 +100,14 @@ TrtrmmUVar1( Orientation orientation, DistMatrix<T>& U )
         U01Trans_STAR_MR.TransposeFrom( U01_VR_STAR, conjugate );
         LocalTrrk( UPPER, T(1), U01_MC_STAR, U01Trans_STAR_MR, T(1), U00 );
 
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, U11, U11_STAR_STAR );
         LocalTrmm
         ( RIGHT, UPPER, orientation, NON_UNIT, 
           T(1), U11_STAR_STAR, U01_VC_STAR );
         U01 = U01_VC_STAR;
 
         LocalTrtrmm( orientation, UPPER, U11_STAR_STAR );
-        U11 = U11_STAR_STAR;
+        RedistributeTriangle( UPPER, U11_STAR_STAR, U11 );
         //--------------------------------------------------------------------//
 
         SlidePartitionDownDiagonal
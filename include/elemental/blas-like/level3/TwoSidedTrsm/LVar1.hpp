@@ -209,10 +209,10 @@ TwoSidedTrsmLVar1
         A11.SumScatterUpdate( F(1), X11_STAR_STAR );
 
         // A11 := inv(L11) A11 inv(L11)'
-        A11_STAR_STAR = A11;
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
         LocalTwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
 
         // A10 := A10 - 1/2 Y10
         Axpy( F(-1)/F(2), Y10, A10 );
@@ -218,16 +218,16 @@ TwoSidedTrsmLVar2
         Axpy( F(-1), X11, A11 );
 
         // A10 := inv(L11) A10
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
         A10_STAR_VR.AdjointFrom( A10Adj_MR_STAR );
         LocalTrsm
         ( LEFT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, A10_STAR_VR );
         A10 = A10_STAR_VR;
 
         // A11 := inv(L11) A11 inv(L11)'
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
 
         // A21 := A21 - A20 L10'
         LocalGemm( NORMAL, NORMAL, F(1), A20, L10Adj_MR_STAR, X21_MC_STAR );
@@ -239,10 +239,10 @@ TwoSidedTrsmLVar3
         A11.SumScatterUpdate( F(-1), X11_STAR_STAR );
 
         // A11 := inv(L11) A11 inv(L11)'
-        A11_STAR_STAR = A11;
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
         LocalTwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
 
         // A21 := A21 - A20 L10'
         L10_STAR_MR = L10_STAR_VR;
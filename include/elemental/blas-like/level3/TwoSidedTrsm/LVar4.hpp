@@ -181,15 +181,15 @@ TwoSidedTrsmLVar4
         Y21_VC_STAR.AlignWith( A22 );
         //--------------------------------------------------------------------//
         // A10 := inv(L11) A10
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
         A10_STAR_VR = A10;
         LocalTrsm
         ( LEFT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, A10_STAR_VR );
 
         // A11 := inv(L11) A11 inv(L11)'
-        A11_STAR_STAR = A11; 
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
 
         // A20 := A20 - L21 A10
         L21_MC_STAR = L21;
@@ -175,10 +175,10 @@ TwoSidedTrsmLVar5
         Y21_VC_STAR.AlignWith( A22 );
         //--------------------------------------------------------------------//
         // A11 := inv(L11) A11 inv(L11)'
-        L11_STAR_STAR = L11;
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( LOWER, diag, A11_STAR_STAR, L11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
 
         // Y21 := L21 A11
         L21_VC_STAR = L21;
@@ -205,10 +205,10 @@ TwoSidedTrsmUVar1
         A11.SumScatterUpdate( F(1), X11_STAR_STAR );
 
         // A11 := inv(U11)' A11 inv(U11)
-        A11_STAR_STAR = A11;
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
         LocalTwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
 
         // A01 := A01 - 1/2 Y01
         Axpy( F(-1)/F(2), Y01, A01 );
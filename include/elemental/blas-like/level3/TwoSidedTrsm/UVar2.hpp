@@ -215,16 +215,16 @@ TwoSidedTrsmUVar2
         Axpy( F(-1), X11, A11 );
 
         // A01 := A01 inv(U11)
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
         A01_VC_STAR = A01_MC_STAR;
         LocalTrsm
         ( RIGHT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, A01_VC_STAR );
         A01 = A01_VC_STAR;
 
         // A11 := inv(U11)' A11 inv(U11)
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
 
         // A12 := A12 - A02' U01
         LocalGemm( ADJOINT, NORMAL, F(1), A02, U01_MC_STAR, X12Adj_MR_STAR );
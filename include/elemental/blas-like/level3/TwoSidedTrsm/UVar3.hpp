@@ -239,10 +239,10 @@ TwoSidedTrsmUVar3
         A11.SumScatterUpdate( F(-1), X11_STAR_STAR );
 
         // A11 := inv(U11)' A11 inv(U11)
-        A11_STAR_STAR = A11;
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
         LocalTwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
 
         // A12 := A12 - U01' A02
         U01_MC_STAR = U01;
@@ -184,15 +184,15 @@ TwoSidedTrsmUVar4
         //--------------------------------------------------------------------//
         // A01 := A01 inv(U11)
         A01_VC_STAR = A01;
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
         LocalTrsm
         ( RIGHT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, A01_VC_STAR );
         A01 = A01_VC_STAR;
 
         // A11 := inv(U11)' A11 inv(U11)
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
 
         // A02 := A02 - A01 U12
         A01Trans_STAR_MC.TransposeFrom( A01_VC_STAR );
@@ -175,10 +175,10 @@ TwoSidedTrsmUVar5
         Y12_STAR_VR.AlignWith( A12 );
         //--------------------------------------------------------------------//
         // A11 := inv(U11)' A11 inv(U11)
-        U11_STAR_STAR = U11;
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
         LocalTwoSidedTrsm( UPPER, diag, A11_STAR_STAR, U11_STAR_STAR );
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
 
         // Y12 := A11 U12
         U12_STAR_VR = U12;
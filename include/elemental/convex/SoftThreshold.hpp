@@ -10,6 +10,8 @@
 #ifndef CONVEX_SOFTTHRESHOLD_HPP
 #define CONVEX_SOFTTHRESHOLD_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -26,6 +28,34 @@ SoftThreshold( F alpha, BASE(F) tau )
     return ( scale <= tau ? F(0) : alpha-(alpha/scale)*tau );
 }
 
+namespace entrywise {
+
+// Each entry is scaled by max(1-tau/|alpha|,0), which involves a selection
+// rather than a branch so that the map can be vectorized
+template<typename F>
+class SoftThresholdMap
+{
+public:
+    typedef BASE(F) R;
+    SoftThresholdMap( R tau ) : tau_(tau)
+    {
+#ifndef RELEASE
+        if( tau < 0 )
+            throw std::logic_error("Negative threshold does not make sense");
+#endif
+    }
+    F operator()( const F& alpha ) const
+    {
+        const R scale = Abs(alpha);
+        const R shrink = ( scale <= tau_ ? R(0) : 1-tau_/scale );
+        return shrink*alpha;
+    }
+private:
+    R tau_;
+};
+
+} // namespace entrywise
+
 template<typename F>
 inline void
 SoftThreshold( Matrix<F>& A, BASE(F) tau )
@@ -33,21 +63,55 @@ SoftThreshold( Matrix<F>& A, BASE(F) tau )
 #ifndef RELEASE
     CallStackEntry entry("SoftThreshold");
 #endif
+    EntrywiseMap( A, entrywise::SoftThresholdMap<F>( tau ) );
+}
+
+template<typename F,Distribution U,Distribution V>
+inline void
+SoftThreshold( DistMatrix<F,U,V>& A, BASE(F) tau )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SoftThreshold");
+#endif
+    SoftThreshold( A.Matrix(), tau );
+}
+
+template<typename R>
+inline void
+SoftThreshold( SplitMatrix<R>& A, R tau )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SoftThreshold");
+    if( tau < 0 )
+        throw std::logic_error("Negative threshold does not make sense");
+#endif
+    // Each entry is scaled by max(1-tau/|alpha|,0)
     const int height = A.Height();
     const int width = A.Width();
     for( int j=0; j<width; ++j )
+    {
+        R* RESTRICT aRe = A.Real().Buffer(0,j);
+        R* RESTRICT aIm = A.Imag().Buffer(0,j);
         for( int i=0; i<height; ++i )
-            A.Set( i, j, SoftThreshold(A.Get(i,j),tau) );
+        {
+            const R scale = Sqrt( aRe[i]*aRe[i] + aIm[i]*aIm[i] );
+            const R shrink = ( scale <= tau ? R(0) : 1-tau/scale );
+            aRe[i] *= shrink;
+            aIm[i] *= shrink;
+        }
+    }
 }
 
-template<typename F,Distribution U,Distribution V>
+template<typename R,Distribution U,Distribution V>
 inline void
-SoftThreshold( DistMatrix<F,U,V>& A, BASE(F) tau )
+SoftThreshold( SplitDistMatrix<R,U,V>& A, R tau )
 {
 #ifndef RELEASE
     CallStackEntry entry("SoftThreshold");
 #endif
-    SoftThreshold( A.Matrix(), tau );
+    SplitMatrix<R> ALocal;
+    LocalView( ALocal, A );
+    SoftThreshold( ALocal, tau );
 }
 
 } // namespace elem
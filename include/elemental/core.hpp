@@ -20,7 +20,9 @@
 #include <ctime>
 #include <fstream>
 #include <iostream>
+#include <map>
 #include <memory>
+#include <new>
 #include <sstream>
 #include <stack>
 #include <stdexcept>
@@ -37,6 +39,10 @@
 # endif
 #endif
 
+#if defined(HAVE_MADV_HUGEPAGE) || defined(HAVE_MAP_HUGETLB)
+# include <sys/mman.h>
+#endif
+
 #if defined(BLAS_POST)
 #define BLAS(name) name ## _
 #else
@@ -65,6 +71,7 @@
 #include "elemental/core/dist_matrix.hpp"
 #include "elemental/core/environment_decl.hpp"
 #include "elemental/core/indexing_decl.hpp"
+#include "elemental/core/task_graph_decl.hpp"
 
 #include "elemental/core/imports/blas.hpp"
 #include "elemental/core/imports/lapack.hpp"
@@ -97,6 +104,10 @@
 #include "elemental/core/random_impl.hpp"
 #include "elemental/core/axpy_interface_decl.hpp"
 #include "elemental/core/axpy_interface_impl.hpp"
+#include "elemental/core/packed_dist_matrix.hpp"
+#include "elemental/core/split_matrix.hpp"
+#include "elemental/core/redistribute_triangle.hpp"
+#include "elemental/core/redistribute.hpp"
 
 #include "elemental/core/ReduceComm.hpp"
 
@@ -21,6 +21,77 @@ struct DistData
     Int diagPath; // only relevant for [MD,* ]/[* ,MD] distributions
     const Grid* grid;
 };
+
+namespace dist_data {
+
+// The number of processes which the given distribution cycles over
+inline int
+Stride( Distribution dist, const Grid& g )
+{
+    switch( dist )
+    {
+    case MC: return g.Height();
+    case MR: return g.Width();
+    case VC: 
+    case VR: return g.Size();
+    default: return 1;
+    }
+}
+
+// Whether the ranks of every process within the two (non-trivial) 
+// distributions agree. For instance, the [MC], [VC], and [VR] ranks of each 
+// process are all equal to its grid row on a p x 1 grid.
+inline bool
+SameRanks( Distribution U, Distribution W, const Grid& g )
+{
+    if( U == W )
+        return true;
+    const bool UIsVector = ( U == VC || U == VR );
+    const bool WIsVector = ( W == VC || W == VR );
+    if( g.Width() == 1 )
+        return ( U == MC || UIsVector ) && ( W == MC || WIsVector );
+    if( g.Height() == 1 )
+        return ( U == MR || UIsVector ) && ( W == MR || WIsVector );
+    return false;
+}
+
+template<typename Int>
+inline bool
+DimensionsCoincide
+( Distribution U, Int alignmentOfU, Distribution W, Int alignmentOfW, 
+  const Grid& g )
+{
+    const int stride = Stride( U, g );
+    if( stride != Stride( W, g ) )
+        return false;
+    if( stride == 1 )
+        return true;
+    return alignmentOfU == alignmentOfW && SameRanks( U, W, g );
+}
+
+} // namespace dist_data
+
+// Whether or not the two distributions assign each entry to the same set of 
+// processes, with the same local ordering, for the given grid and alignments.
+// For example, [MC,MR] and [VC,* ] coincide on a p x 1 grid, and [MC,* ] 
+// coincides with [VC,* ] on an r x 1 grid. Redistributions between such pairs
+// only require local copies.
+template<typename Int>
+inline bool
+DistributionsCoincide( const DistData<Int>& A, const DistData<Int>& B )
+{
+    if( A.colDist == MD || A.rowDist == MD || 
+        B.colDist == MD || B.rowDist == MD )
+        return false;
+    if( *A.grid != *B.grid )
+        return false;
+    const Grid& g = *A.grid;
+    return dist_data::DimensionsCoincide
+           ( A.colDist, A.colAlignment, B.colDist, B.colAlignment, g ) &&
+           dist_data::DimensionsCoincide
+           ( A.rowDist, A.rowAlignment, B.rowDist, B.rowAlignment, g );
+}
+
 } // namespace elem
 
 #include "elemental/core/dist_matrix/abstract.hpp"
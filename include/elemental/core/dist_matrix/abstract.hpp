@@ -244,6 +244,11 @@ protected:
     void SetRowShift();
     void SetGrid();
 
+    // If, after adopting any free alignments, this matrix's distribution 
+    // coincides with that of A, then perform this = A with a local copy and
+    // return true; otherwise, return false without modifying this matrix.
+    bool CopyIfCoincident( const AbstractDistMatrix<T,Int>& A );
+
     virtual void PrintBase( std::ostream& os, const std::string msg ) const = 0;
 
     template<typename S,Distribution U,Distribution V,typename Ord> 
@@ -292,6 +297,15 @@ protected:
       const DistMatrix<S,U,V,Ord>& BBL,
       const DistMatrix<S,U,V,Ord>& BBR );
 
+    template<typename S,Distribution U,Distribution V,
+                        Distribution W,Distribution Z,typename Ord>
+    friend bool AliasView
+    ( DistMatrix<S,U,V,Ord>& A, DistMatrix<S,W,Z,Ord>& B );
+    template<typename S,Distribution U,Distribution V,
+                        Distribution W,Distribution Z,typename Ord>
+    friend bool LockedAliasView
+    ( DistMatrix<S,U,V,Ord>& A, const DistMatrix<S,W,Z,Ord>& B );
+
     template<typename S,Distribution U,Distribution V,typename Ord>
     friend class DistMatrix;
 };
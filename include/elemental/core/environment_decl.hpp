@@ -37,6 +37,29 @@ void SetBlocksize( int blocksize );
 void PushBlocksizeStack( int blocksize );
 void PopBlocksizeStack();
 
+// The size of the square tiles used by the TaskGraph-based factorizations
+// of sequential matrices (default: 64)
+int TileSize();
+void SetTileSize( int tileSize );
+
+// Whether or not redistributions over topology-aware grids should exchange 
+// their on-node portions through shared-memory windows (default: false)
+bool SharedMemoryRedistributions();
+void SetSharedMemoryRedistributions( bool enable );
+
+// Whether or not local buffers of at least LARGE_ALLOCATION_SIZE bytes are
+// initialized by all of the OpenMP threads, so that their pages are placed 
+// on the NUMA nodes of the threads which later operate on them 
+// (default: true; this has no effect without OpenMP)
+bool ParallelFirstTouch();
+void SetParallelFirstTouch( bool enable );
+
+// Whether or not local buffers of at least LARGE_ALLOCATION_SIZE bytes are
+// backed by 2 MB pages (default: NO_HUGE_PAGES). EXPLICIT_HUGE_PAGES falls 
+// back to TRANSPARENT_HUGE_PAGES if no huge pages have been reserved.
+HugePagePolicy GetHugePagePolicy();
+void SetHugePagePolicy( HugePagePolicy policy );
+
 // Replacement for std::memcpy, which is known to often be suboptimal.
 // Notice the sizeof(T) is no longer required.
 template<typename T>
@@ -51,6 +74,19 @@ void StridedMemCopy
 (       T* dest,   std::size_t destStride,
   const T* source, std::size_t sourceStride, std::size_t numEntries );
 
+// B(i,j) := A(i,j), or its conjugate, where A(i,j) is stored at
+// A[i*colStrideA+j*rowStrideA] and B(i,j) at B[i*colStrideB+j*rowStrideB].
+// The local packing, unpacking, and transposition within redistributions are
+// all of this form. When A and B are traversed in opposite orders, e.g., for
+// a transposition, the copy proceeds over small square tiles so that the
+// strided accesses stay within cache.
+template<typename T>
+void InterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB,
+  bool conjugate=false );
+
 // Replacement for std::memset, which is likely suboptimal and hard to extend
 // to non-POD datatypes. Notice that sizeof(T) is no longer required.
 template<typename T>
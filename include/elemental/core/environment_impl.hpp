@@ -56,8 +56,136 @@ StridedMemCopy
 (       T* dest,   std::size_t destStride, 
   const T* source, std::size_t sourceStride, std::size_t numEntries )
 {
-    // For now, use the BLAS wrappers/generalization
-    blas::Copy( numEntries, source, sourceStride, dest, destStride );
+    if( destStride == 1 && sourceStride == 1 )
+    {
+        MemCopy( dest, source, numEntries );
+        return;
+    }
+    // Unroll so that the independent strided loads (or stores) can be
+    // issued back-to-back
+    T* RESTRICT d = dest;
+    const T* RESTRICT s = source;
+    const std::size_t numUnrolled = numEntries - numEntries%4;
+    std::size_t k=0;
+    if( destStride == 1 )
+    {
+        for( ; k<numUnrolled; k+=4 )
+        {
+            const T* RESTRICT sk = &s[k*sourceStride];
+            d[k  ] = sk[0];
+            d[k+1] = sk[sourceStride];
+            d[k+2] = sk[2*sourceStride];
+            d[k+3] = sk[3*sourceStride];
+        }
+        for( ; k<numEntries; ++k )
+            d[k] = s[k*sourceStride];
+    }
+    else if( sourceStride == 1 )
+    {
+        for( ; k<numUnrolled; k+=4 )
+        {
+            T* RESTRICT dk = &d[k*destStride];
+            dk[0           ] = s[k  ];
+            dk[destStride  ] = s[k+1];
+            dk[2*destStride] = s[k+2];
+            dk[3*destStride] = s[k+3];
+        }
+        for( ; k<numEntries; ++k )
+            d[k*destStride] = s[k];
+    }
+    else
+    {
+        for( ; k<numEntries; ++k )
+            d[k*destStride] = s[k*sourceStride];
+    }
+}
+
+namespace internal {
+
+template<typename T,bool Conjugate>
+inline void
+InterleaveMatrixKernel
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB )
+{
+    const bool transposing =
+        ( colStrideA > rowStrideA ) != ( colStrideB > rowStrideB );
+    if( !transposing )
+    {
+        // Ensure that the inner loop runs along the faster dimension
+        if( colStrideB > rowStrideB )
+        {
+            std::swap( height, width );
+            std::swap( colStrideA, rowStrideA );
+            std::swap( colStrideB, rowStrideB );
+        }
+        const int numCols = width;
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( int j=0; j<numCols; ++j )
+        {
+            const T* ACol = &A[j*rowStrideA];
+            T* BCol = &B[j*rowStrideB];
+            if( Conjugate )
+            {
+                for( std::size_t i=0; i<height; ++i )
+                    BCol[i*colStrideB] = Conj(ACol[i*colStrideA]);
+            }
+            else
+                StridedMemCopy( BCol, colStrideB, ACol, colStrideA, height );
+        }
+        return;
+    }
+
+    // Copy over square tiles which are small enough that the cache lines of
+    // both A and B which they touch remain in L1
+    const std::size_t bsize = ( sizeof(T) > 8 ? 16 : 32 );
+    const int numColBlocks = (width+bsize-1) / bsize;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jBlock=0; jBlock<numColBlocks; ++jBlock )
+    {
+        const std::size_t jStart = jBlock*bsize;
+        const std::size_t jEnd = std::min(jStart+bsize,width);
+        for( std::size_t iStart=0; iStart<height; iStart+=bsize )
+        {
+            const std::size_t iEnd = std::min(iStart+bsize,height);
+            for( std::size_t j=jStart; j<jEnd; ++j )
+            {
+                const T* RESTRICT ACol = &A[j*rowStrideA];
+                T* RESTRICT BCol = &B[j*rowStrideB];
+                if( Conjugate )
+                    for( std::size_t i=iStart; i<iEnd; ++i )
+                        BCol[i*colStrideB] = Conj(ACol[i*colStrideA]);
+                else
+                    for( std::size_t i=iStart; i<iEnd; ++i )
+                        BCol[i*colStrideB] = ACol[i*colStrideA];
+            }
+        }
+    }
+}
+
+} // namespace internal
+
+template<typename T>
+inline void
+InterleaveMatrix
+( std::size_t height, std::size_t width,
+  const T* A, std::size_t colStrideA, std::size_t rowStrideA,
+        T* B, std::size_t colStrideB, std::size_t rowStrideB,
+  bool conjugate )
+{
+    if( height == 0 || width == 0 )
+        return;
+    if( conjugate )
+        internal::InterleaveMatrixKernel<T,true>
+        ( height, width, A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
+    else
+        internal::InterleaveMatrixKernel<T,false>
+        ( height, width, A, colStrideA, rowStrideA, B, colStrideB, rowStrideB );
 }
 
 template<typename T>
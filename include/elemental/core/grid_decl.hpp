@@ -20,6 +20,11 @@ public:
     Grid( mpi::Comm comm, int height, int width );
     ~Grid();
 
+    // Topology-aware grids: the processes which share a node are placed 
+    // within the same process column (COLUMN_MAJOR) or row (ROW_MAJOR)
+    Grid( mpi::Comm comm, GridOrder order );
+    Grid( mpi::Comm comm, int height, int width, GridOrder order );
+
     // Simple interface (simpler version of distributed-based interface)
     int Row() const;           // same as MCRank()
     int Col() const;           // same as MRRank()
@@ -45,6 +50,19 @@ public:
     mpi::Comm VCComm() const;
     mpi::Comm VRComm() const;
 
+    // Node-aware versions of the above communicators (topology-aware only)
+    bool NodeAware() const;
+    const mpi::TwoLevelComm& MCTwoLevelComm() const;
+    const mpi::TwoLevelComm& MRTwoLevelComm() const;
+    const mpi::TwoLevelComm& VCTwoLevelComm() const;
+    const mpi::TwoLevelComm& VRTwoLevelComm() const;
+
+    // Shared-memory windows over the on-node members of the MC and MR teams,
+    // which redistributions grow on demand (topology-aware only)
+    bool SharedWindows() const;
+    mpi::SharedWindow& MCSharedWindow() const;
+    mpi::SharedWindow& MRSharedWindow() const;
+
     // Advanced routines
     Grid( mpi::Comm viewers, mpi::Group owners );
     Grid( mpi::Comm viewers, mpi::Group owners, int height, int width ); 
@@ -64,6 +82,7 @@ public:
     int FirstVCRank( int diagPath ) const;
 
     static int FindFactor( int p );
+    static int FindFactor( int p, int nodeSize );
 
 private:
     int height_, width_, size_, gcd_;
@@ -100,7 +119,18 @@ private:
     mpi::Comm vectorColComm_;
     mpi::Comm vectorRowComm_;
 
+    // Only valid for topology-aware grids
+    bool nodeAware_;
+    mpi::TwoLevelComm matrixColTwoLevelComm_;
+    mpi::TwoLevelComm matrixRowTwoLevelComm_;
+    mpi::TwoLevelComm vectorColTwoLevelComm_;
+    mpi::TwoLevelComm vectorRowTwoLevelComm_;
+    mutable mpi::SharedWindow matrixColWindow_;
+    mutable mpi::SharedWindow matrixRowWindow_;
+
     void SetUpGrid();
+    void SetUpNodeAwareGrid
+    ( mpi::Comm comm, int height, int width, GridOrder order );
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
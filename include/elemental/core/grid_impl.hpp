@@ -22,6 +22,31 @@ Grid::FindFactor( int p )
     return factor;
 }
 
+// Find the factor of p nearest to sqrt(p) which is either a divisor or a 
+// multiple of the number of processes per node, so that the node boundaries
+// line up with the process columns (or rows) of the resulting grid
+inline int
+Grid::FindFactor( int p, int nodeSize )
+{
+    const double sqrtP = sqrt(double(p));
+    int bestFactor = FindFactor( p );
+    double bestDist = -1;
+    for( int factor=1; factor<=p; ++factor )
+    {
+        if( p % factor != 0 )
+            continue;
+        if( nodeSize % factor != 0 && factor % nodeSize != 0 )
+            continue;
+        const double dist = std::abs( factor-sqrtP );
+        if( bestDist < 0 || dist < bestDist )
+        {
+            bestFactor = factor;
+            bestDist = dist;
+        }
+    }
+    return bestFactor;
+}
+
 inline 
 Grid::Grid( mpi::Comm comm )
 {
@@ -29,6 +54,7 @@ Grid::Grid( mpi::Comm comm )
     CallStackEntry entry("Grid::Grid");
 #endif
     inGrid_ = true; // this is true by assumption for this constructor
+    nodeAware_ = false;
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::CommDup( comm, viewingComm_ );
@@ -55,6 +81,7 @@ Grid::Grid( mpi::Comm comm, int height, int width )
     CallStackEntry entry("Grid::Grid");
 #endif
     inGrid_ = true; // this is true by assumption for this constructor
+    nodeAware_ = false;
 
     // Extract our rank, the underlying group, and the number of processes
     mpi::CommDup( comm, viewingComm_ );
@@ -76,6 +103,86 @@ Grid::Grid( mpi::Comm comm, int height, int width )
     SetUpGrid();
 }
 
+inline
+Grid::Grid( mpi::Comm comm, GridOrder order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Grid::Grid");
+#endif
+    SetUpNodeAwareGrid( comm, 0, 0, order );
+}
+
+inline
+Grid::Grid( mpi::Comm comm, int height, int width, GridOrder order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Grid::Grid");
+#endif
+    if( height <= 0 || width <= 0 )
+        throw std::logic_error("Process grid dimensions must be positive");
+    SetUpNodeAwareGrid( comm, height, width, order );
+}
+
+// If height and width are zero, then they are chosen to align with the nodes
+inline void
+Grid::SetUpNodeAwareGrid
+( mpi::Comm comm, int height, int width, GridOrder order )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Grid::SetUpNodeAwareGrid");
+#endif
+    inGrid_ = true; // this is true by assumption for this constructor
+    nodeAware_ = true;
+    size_ = mpi::CommSize( comm );
+
+    // Determine the node-major position of each process
+    mpi::TwoLevelComm twoLevelComm;
+    mpi::TwoLevelCommCreate( comm, twoLevelComm );
+    const int minNodeSize = 
+        *std::min_element
+        ( twoLevelComm.nodeSizes.begin(), twoLevelComm.nodeSizes.end() );
+
+    if( height == 0 && width == 0 )
+    {
+        if( order == COLUMN_MAJOR )
+        {
+            height = FindFactor( size_, minNodeSize );
+            width = size_ / height;
+        }
+        else
+        {
+            width = FindFactor( size_, minNodeSize );
+            height = size_ / width;
+        }
+    }
+    height_ = height;
+    width_ = width;
+    if( size_ != height_*width_ )
+        throw std::logic_error("Number of processes must match grid size");
+
+    // Consecutive node-major positions fill a column (or row) of the grid, 
+    // so we form the owning group by listing the processes in the order of 
+    // their VC ranks
+    mpi::CommDup( comm, viewingComm_ );
+    mpi::CommGroup( viewingComm_, viewingGroup_ );
+    viewingRank_ = mpi::CommRank( viewingComm_ );
+    std::vector<int> vcRanks( size_ );
+    for( int q=0; q<size_; ++q )
+    {
+        const int position = twoLevelComm.positions[q];
+        if( order == COLUMN_MAJOR )
+            vcRanks[position] = q;
+        else
+            vcRanks[position/width_+(position % width_)*height_] = q;
+    }
+    mpi::TwoLevelCommFree( twoLevelComm );
+    mpi::GroupIncl( viewingGroup_, size_, &vcRanks[0], owningGroup_ );
+    notOwningGroup_ = mpi::GROUP_EMPTY;
+    owningRank_ = mpi::GroupRank( owningGroup_ );
+
+    SetUpGrid();
+}
+
 inline void 
 Grid::SetUpGrid()
 {
@@ -161,6 +268,18 @@ Grid::SetUpGrid()
         mpi::ErrorHandlerSet
         ( vectorRowComm_, mpi::ERRORS_RETURN );
 #endif
+
+        if( nodeAware_ )
+        {
+            mpi::TwoLevelCommCreate( matrixColComm_, matrixColTwoLevelComm_ );
+            mpi::TwoLevelCommCreate( matrixRowComm_, matrixRowTwoLevelComm_ );
+            mpi::TwoLevelCommCreate( vectorColComm_, vectorColTwoLevelComm_ );
+            mpi::TwoLevelCommCreate( vectorRowComm_, vectorRowTwoLevelComm_ );
+            mpi::SharedWindowCreate
+            ( matrixColTwoLevelComm_.nodeComm, matrixColWindow_ );
+            mpi::SharedWindowCreate
+            ( matrixRowTwoLevelComm_.nodeComm, matrixRowWindow_ );
+        }
     }
     else
     {
@@ -170,7 +289,6 @@ Grid::SetUpGrid()
         vectorColRank_ = mpi::UNDEFINED;
         vectorRowRank_ = mpi::UNDEFINED;
     }
-    mpi::Broadcast( &diagPathsAndRanks_[0], 2*size_, 0, viewingComm_ );
 
     // Set up the map from the VC group to the viewingGroup_ ranks.
     // Since the VC communicator preserves the ordering of the owningGroup_
@@ -182,6 +300,12 @@ Grid::SetUpGrid()
     mpi::GroupTranslateRanks
     ( owningGroup_, size_, &ranks[0], viewingGroup_, 
       &vectorColToViewingMap_[0] );
+
+    // The diagonal path information must be broadcast from a member of the
+    // grid, which need not include the root of the viewing communicator
+    mpi::Broadcast
+    ( &diagPathsAndRanks_[0], 2*size_, vectorColToViewingMap_[0], 
+      viewingComm_ );
 }
 
 inline 
@@ -189,6 +313,15 @@ Grid::~Grid()
 {
     if( !mpi::Finalized() )
     {
+        if( inGrid_ && nodeAware_ )
+        {
+            mpi::SharedWindowFree( matrixColWindow_ );
+            mpi::SharedWindowFree( matrixRowWindow_ );
+            mpi::TwoLevelCommFree( matrixColTwoLevelComm_ );
+            mpi::TwoLevelCommFree( matrixRowTwoLevelComm_ );
+            mpi::TwoLevelCommFree( vectorColTwoLevelComm_ );
+            mpi::TwoLevelCommFree( vectorRowTwoLevelComm_ );
+        }
         if( inGrid_ )
         {
             mpi::CommFree( matrixColComm_ );
@@ -205,6 +338,8 @@ Grid::~Grid()
 
         if( notOwningGroup_ != mpi::GROUP_EMPTY )
             mpi::GroupFree( notOwningGroup_ );
+        if( nodeAware_ )
+            mpi::GroupFree( owningGroup_ );
 
         mpi::CommFree( viewingComm_ );
         mpi::GroupFree( viewingGroup_ );
@@ -259,6 +394,62 @@ inline mpi::Comm
 Grid::VRComm() const
 { return vectorRowComm_; }
 
+inline bool
+Grid::NodeAware() const
+{ return nodeAware_; }
+
+inline const mpi::TwoLevelComm&
+Grid::MCTwoLevelComm() const
+{ 
+    if( !nodeAware_ )
+        throw std::logic_error("Two-level comms require a topology-aware grid");
+    return matrixColTwoLevelComm_; 
+}
+
+inline const mpi::TwoLevelComm&
+Grid::MRTwoLevelComm() const
+{ 
+    if( !nodeAware_ )
+        throw std::logic_error("Two-level comms require a topology-aware grid");
+    return matrixRowTwoLevelComm_; 
+}
+
+inline const mpi::TwoLevelComm&
+Grid::VCTwoLevelComm() const
+{ 
+    if( !nodeAware_ )
+        throw std::logic_error("Two-level comms require a topology-aware grid");
+    return vectorColTwoLevelComm_; 
+}
+
+inline const mpi::TwoLevelComm&
+Grid::VRTwoLevelComm() const
+{ 
+    if( !nodeAware_ )
+        throw std::logic_error("Two-level comms require a topology-aware grid");
+    return vectorRowTwoLevelComm_; 
+}
+
+inline bool
+Grid::SharedWindows() const
+{ return nodeAware_ && SharedMemoryRedistributions(); }
+
+inline mpi::SharedWindow&
+Grid::MCSharedWindow() const
+{
+    if( !nodeAware_ )
+        throw std::logic_error("Shared windows require a topology-aware grid");
+    return matrixColWindow_;
+}
+
+inline mpi::SharedWindow&
+Grid::MRSharedWindow() const
+{
+    if( !nodeAware_ )
+        throw std::logic_error("Shared windows require a topology-aware grid");
+    return matrixRowWindow_;
+}
+
 //
 // Provided for simplicity, but redundant
 //
@@ -310,6 +501,8 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners )
     CallStackEntry entry("Grid::Grid");
 #endif
 
+    nodeAware_ = false;
+
     // Extract our rank and the underlying group from the viewing comm
     mpi::CommDup( viewers, viewingComm_ );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
@@ -339,6 +532,8 @@ Grid::Grid( mpi::Comm viewers, mpi::Group owners, int height, int width )
     CallStackEntry entry("Grid::Grid");
 #endif
 
+    nodeAware_ = false;
+
     // Extract our rank and the underlying group from the viewing comm
     mpi::CommDup( viewers, viewingComm_ );
     mpi::CommGroup( viewingComm_, viewingGroup_ );
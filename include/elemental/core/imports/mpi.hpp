@@ -54,6 +54,7 @@ const int THREAD_FUNNELED = MPI_THREAD_FUNNELED;
 const int THREAD_SERIALIZED = MPI_THREAD_SERIALIZED;
 const int THREAD_MULTIPLE = MPI_THREAD_MULTIPLE;
 const int UNDEFINED = MPI_UNDEFINED;
+const Comm COMM_NULL = MPI_COMM_NULL;
 const Comm COMM_SELF = MPI_COMM_SELF;
 const Comm COMM_WORLD = MPI_COMM_WORLD;
 const ErrorHandler ERRORS_RETURN = MPI_ERRORS_RETURN;
@@ -76,6 +77,39 @@ const Op BINARY_XOR = MPI_BXOR;
 // Added constant(s)
 const int MIN_COLL_MSG = 1; // minimum message size for collectives
 
+// A communicator along with its decomposition into shared-memory nodes, which
+// allows for collectives which first aggregate within each node and then 
+// only communicate between one 'leader' process per node.
+//
+// The 'node-major' position of a process is its offset in the ordering which
+// lists all members of node 0, then all members of node 1, etc.
+struct TwoLevelComm
+{
+    Comm comm;       // the original communicator (not owned)
+    Comm nodeComm;   // the members of 'comm' which share our node
+    Comm leaderComm; // the first member of each node (COMM_NULL otherwise)
+    int node, nodeRank, nodeSize, numNodes;
+    std::vector<int> nodeSizes;   // number of members of each node
+    std::vector<int> nodeOffsets; // node-major position of each node leader
+    std::vector<int> positions;   // node-major position of each rank
+    std::vector<int> ranks;       // rank at each node-major position
+};
+
+// A buffer which is carved out of an MPI-3 shared-memory window over the 
+// members of a node, so that each member may directly read the segments of 
+// the others. Without MPI-3 support, each process simply owns a private 
+// segment and the segments of its peers are left null.
+struct SharedWindow
+{
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    MPI_Win win;
+#endif
+    Comm comm;                   // the node communicator (not owned)
+    std::size_t size;            // the number of bytes in each segment
+    byte* buffer;                // our segment
+    std::vector<byte*> segments; // the segment of each node member
+};
+
 //----------------------------------------------------------------------------//
 // Routines                                                                   //
 //----------------------------------------------------------------------------//
@@ -98,10 +132,23 @@ int CommSize( Comm comm );
 void CommCreate( Comm parentComm, Group subsetGroup, Comm& subsetComm );
 void CommDup( Comm original, Comm& duplicate );
 void CommSplit( Comm comm, int color, int key, Comm& newComm );
+// Split into the subsets of processes which can share memory (if MPI-3 is 
+// not available, each process is treated as its own node)
+void CommSplitShared( Comm comm, int key, Comm& nodeComm );
 void CommFree( Comm& comm );
 bool CongruentComms( Comm comm1, Comm comm2 );
 void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler );
 
+// Two-level (node-aware) communicator routines
+void TwoLevelCommCreate( Comm comm, TwoLevelComm& twoLevelComm );
+void TwoLevelCommFree( TwoLevelComm& twoLevelComm );
+
+// Shared-memory window routines
+void SharedWindowCreate( Comm nodeComm, SharedWindow& window );
+void SharedWindowRequire( SharedWindow& window, std::size_t size );
+void SharedWindowSync( SharedWindow& window );
+void SharedWindowFree( SharedWindow& window );
+
 // Cartesian communicator routines
 void CartCreate
 ( Comm comm, int numDims, const int* dimensions, const int* periods, 
@@ -324,6 +371,37 @@ template<typename R>
 void ReduceScatter
 ( const Complex<R>* sbuf, Complex<R>* rbuf, const int* rcs, Op op, Comm comm );
 
+// Two-level collectives
+//
+// These are drop-in replacements for the equally-sized AllGather, 
+// ReduceScatter, and AllToAll, but they first aggregate within each node so 
+// that only the node leaders communicate over the network.
+
+template<typename T>
+void AllGather
+( const T* sbuf, int sc, 
+        T* rbuf, int rc, const TwoLevelComm& comm );
+
+template<typename T>
+void ReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, const TwoLevelComm& comm );
+
+template<typename T>
+void AllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, const TwoLevelComm& comm );
+
+// An AllToAll whose send buffer is the local segment of a shared window 
+// over comm.nodeComm: the portions sent by members of our node are read in 
+// place from their segments, and only the remaining portions are copied into 
+// 'rbuf'. On exit, portions[q] points to the data sent by rank q of comm.comm.
+// SharedWindowSync must be called once the portions have been consumed and 
+// before the segment is next modified.
+template<typename T>
+void SharedAllToAll
+( int sc, T* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const T*>& portions );
+
 } // mpi
 } // elem
 
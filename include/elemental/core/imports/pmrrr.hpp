@@ -13,6 +13,19 @@
 namespace elem {
 namespace pmrrr {
 
+// Set the number of threads used by each process within PMRRR; a 
+// non-positive value restores the default, which is the value of the 
+// PMR_NUM_THREADS environment variable if it is set, and otherwise the 
+// number of OpenMP threads available outside of a parallel region (or one
+// if OpenMP is not in use). Threads are only used if MPI was initialized 
+// with at least MPI_THREAD_FUNNELED support.
+void SetNumThreads( int numThreads );
+int NumThreads();
+
+// PMRRR keeps its worker threads alive between calls; this releases them 
+// and is called by Finalize
+void FreeThreadPool();
+
 struct Estimate {
     int numLocalEigenvalues;
     int numGlobalEigenvalues;
@@ -12,11 +12,26 @@
 
 namespace elem {
 
+// Buffers of at least this many bytes may be initialized in parallel and
+// backed by huge pages (see SetParallelFirstTouch and SetHugePagePolicy)
+const std::size_t LARGE_ALLOCATION_SIZE = 2097152;
+
 template<typename G>
 class Memory
 {
+    enum AllocationType
+    {
+        HEAP_ALLOCATION,    // new[]
+        ALIGNED_ALLOCATION, // posix_memalign
+        MAPPED_ALLOCATION   // mmap from the reserved huge pages
+    };
+
     std::size_t size_;
     G* buffer_;
+    AllocationType allocationType_;
+
+    void Allocate( std::size_t size );
+    void Deallocate();
 public:
     Memory();
     Memory( std::size_t size );
@@ -15,19 +15,127 @@ namespace elem {
 template<typename G>
 inline 
 Memory<G>::Memory()
-: size_(0), buffer_(NULL)
+: size_(0), buffer_(NULL), allocationType_(HEAP_ALLOCATION)
 { }
 
 template<typename G>
 inline 
 Memory<G>::Memory( std::size_t size )
-: size_(size), buffer_(new G[size])
-{ }
+: size_(0), buffer_(NULL), allocationType_(HEAP_ALLOCATION)
+{ 
+    Allocate( size );
+    size_ = size;
+}
 
 template<typename G>
 inline 
 Memory<G>::~Memory()
-{ delete[] buffer_; }
+{ Deallocate(); }
+
+template<typename G>
+inline void
+Memory<G>::Allocate( std::size_t size )
+{
+    const std::size_t numBytes = size*sizeof(G);
+    allocationType_ = HEAP_ALLOCATION;
+    if( numBytes < LARGE_ALLOCATION_SIZE )
+    {
+        buffer_ = new G[size];
+        return;
+    }
+
+    const HugePagePolicy policy = GetHugePagePolicy();
+    void* ptr = NULL;
+#ifdef HAVE_MAP_HUGETLB
+    if( policy == EXPLICIT_HUGE_PAGES )
+    {
+        const std::size_t numPages = 
+            (numBytes+LARGE_ALLOCATION_SIZE-1) / LARGE_ALLOCATION_SIZE;
+        ptr = mmap
+        ( NULL, numPages*LARGE_ALLOCATION_SIZE, PROT_READ|PROT_WRITE,
+          MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0 );
+        // Fall back to the transparent huge pages if none are reserved
+        if( ptr == MAP_FAILED )
+            ptr = NULL;
+        else
+            allocationType_ = MAPPED_ALLOCATION;
+    }
+#endif
+#ifdef HAVE_POSIX_MEMALIGN
+    if( ptr == NULL )
+    {
+        // Align to a huge page if we might be backed by them, and otherwise
+        // to a (generous) cache line
+        const std::size_t alignment = 
+            ( policy == NO_HUGE_PAGES ? 128 : LARGE_ALLOCATION_SIZE );
+        if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+            throw std::bad_alloc();
+        allocationType_ = ALIGNED_ALLOCATION;
+# ifdef HAVE_MADV_HUGEPAGE
+        if( policy != NO_HUGE_PAGES )
+            madvise( ptr, numBytes, MADV_HUGEPAGE );
+# endif
+    }
+#endif
+    if( ptr == NULL )
+    {
+        buffer_ = new G[size];
+        return;
+    }
+    buffer_ = static_cast<G*>(ptr);
+
+    // Since pages are placed on the NUMA node of the thread which first 
+    // touches them, zero the raw storage with the same static schedule
+    // over contiguous ranges that the threaded local kernels use for the
+    // columns of a matrix
+#ifdef HAVE_OPENMP
+    if( ParallelFirstTouch() )
+    {
+        const long numEntries = size;
+        char* bytes = static_cast<char*>(ptr);
+        #pragma omp parallel for schedule(static)
+        for( long k=0; k<numEntries; ++k )
+            std::memset( &bytes[k*sizeof(G)], 0, sizeof(G) );
+    }
+#endif
+
+    // The storage did not come from new[], so construct the entries in place
+    // (which, as with new[], leaves built-in types uninitialized)
+    for( std::size_t k=0; k<size; ++k )
+        new (&buffer_[k]) G;
+}
+
+template<typename G>
+inline void
+Memory<G>::Deallocate()
+{
+    if( buffer_ == NULL )
+        return;
+    switch( allocationType_ )
+    {
+    case HEAP_ALLOCATION: 
+        delete[] buffer_; 
+        break;
+    case ALIGNED_ALLOCATION: 
+        for( std::size_t k=0; k<size_; ++k )
+            buffer_[k].~G();
+        free( buffer_ ); 
+        break;
+    case MAPPED_ALLOCATION:
+    {
+        for( std::size_t k=0; k<size_; ++k )
+            buffer_[k].~G();
+#ifdef HAVE_MAP_HUGETLB
+        const std::size_t numBytes = size_*sizeof(G);
+        const std::size_t numPages = 
+            (numBytes+LARGE_ALLOCATION_SIZE-1) / LARGE_ALLOCATION_SIZE;
+        munmap( buffer_, numPages*LARGE_ALLOCATION_SIZE );
+#endif
+        break;
+    }
+    }
+    buffer_ = NULL;
+}
 
 template<typename G>
 inline G* 
@@ -45,11 +153,12 @@ Memory<G>::Require( std::size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        Deallocate();
+        size_ = 0;
 #ifndef RELEASE
         try {
 #endif
-        buffer_ = new G[size];
+        Allocate( size );
 #ifndef RELEASE
         } 
         catch( std::bad_alloc& exception )
@@ -76,9 +185,8 @@ template<typename G>
 inline void 
 Memory<G>::Empty()
 {
-    delete[] buffer_;
+    Deallocate();
     size_ = 0;
-    buffer_ = 0;
 }
 
 } // namespace elem
@@ -0,0 +1,946 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_PACKEDDISTMATRIX_HPP
+#define CORE_PACKEDDISTMATRIX_HPP
+
+//
+// A square distributed matrix for which only the lower or upper triangle is
+// stored, e.g., a Hermitian matrix or a triangular factor.
+//
+// The matrix is distributed exactly as the corresponding DistMatrix<T,U,V>,
+// but each process only stores the entries of its local submatrix which lie
+// within the referenced triangle: local column jLocal (global column j) holds
+// the local rows with i >= j (LOWER) or i <= j (UPPER) contiguously, so that
+// the storage, and the volume of every redistribution, is roughly half of
+// that of the full matrix.
+//
+// Since each stored local column is contiguous, Buffer(iLocal,jLocal) may be
+// used exactly as for a DistMatrix, as long as (iLocal,jLocal) lies within
+// [LocalColumnBegin(jLocal),LocalColumnEnd(jLocal)).
+//
+// Redistributions between packed matrices (and, through RedistributeTriangle,
+// between the triangles of ordinary distributed matrices) are performed with
+// a single AllToAll over the VC communicator in which each referenced entry is
+// sent exactly once to each process which owns it in the new distribution.
+// The [MD,* ] and [* ,MD] distributions are not supported.
+//
+
+namespace elem {
+
+template<typename T,Distribution U=MC,Distribution V=MR>
+class PackedDistMatrix;
+
+namespace packed {
+
+inline int
+Stride( Distribution dist, const Grid& g )
+{
+    switch( dist )
+    {
+    case MC: return g.Height();
+    case MR: return g.Width();
+    case VC:
+    case VR: return g.Size();
+    case STAR: return 1;
+    default: throw std::logic_error("Unsupported distribution");
+    }
+    return 1;
+}
+
+inline int
+Rank( Distribution dist, const Grid& g )
+{
+    switch( dist )
+    {
+    case MC: return g.Row();
+    case MR: return g.Col();
+    case VC: return g.VCRank();
+    case VR: return g.VRRank();
+    case STAR: return 0;
+    default: throw std::logic_error("Unsupported distribution");
+    }
+    return 0;
+}
+
+// The number of processes which own a copy of each entry
+inline int
+NumReplicas( Distribution U, Distribution V, const Grid& g )
+{ return g.Size() / (Stride(U,g)*Stride(V,g)); }
+
+// Our index within the set of processes which own copies of our entries
+inline int
+ReplicaIndex( Distribution U, Distribution V, const Grid& g )
+{
+    if( U == MC && V == STAR )
+        return g.Col();
+    else if( U == STAR && V == MR )
+        return g.Row();
+    else if( U == MR && V == STAR )
+        return g.Row();
+    else if( U == STAR && V == MC )
+        return g.Col();
+    else if( U == STAR && V == STAR )
+        return g.VCRank();
+    else
+        return 0;
+}
+
+// The VC rank of the k'th owner of the entries whose row is assigned to rank
+// 'colRank' of the U team and whose column is assigned to rank 'rowRank' of
+// the V team
+inline int
+VCOwner
+( Distribution U, Distribution V, int colRank, int rowRank, int k,
+  const Grid& g )
+{
+    const int r = g.Height();
+    const int c = g.Width();
+    if( U == MC && V == MR )
+        return colRank + rowRank*r;
+    else if( U == MR && V == MC )
+        return rowRank + colRank*r;
+    else if( U == MC && V == STAR )
+        return colRank + k*r;
+    else if( U == STAR && V == MR )
+        return k + rowRank*r;
+    else if( U == MR && V == STAR )
+        return k + colRank*r;
+    else if( U == STAR && V == MC )
+        return rowRank + k*r;
+    else if( U == VC && V == STAR )
+        return colRank;
+    else if( U == STAR && V == VC )
+        return rowRank;
+    else if( U == VR && V == STAR )
+        return colRank/c + (colRank % c)*r;
+    else if( U == STAR && V == VR )
+        return rowRank/c + (rowRank % c)*r;
+    else if( U == STAR && V == STAR )
+        return k;
+    else
+        throw std::logic_error("Unsupported distribution pair");
+    return 0;
+}
+
+// The range of local rows, [begin,end), of global column j which lie within
+// the specified triangle
+inline void
+TriangleRange
+( UpperOrLower uplo, UnitOrNonUnit diag, int j,
+  int colShift, int colStride, int localHeight, int& begin, int& end )
+{
+    if( uplo == LOWER )
+    {
+        begin = Length_( ( diag==UNIT ? j+1 : j ), colShift, colStride );
+        end = localHeight;
+    }
+    else
+    {
+        begin = 0;
+        end = Length_( ( diag==UNIT ? j : j+1 ), colShift, colStride );
+    }
+}
+
+// B := the 'uplo' triangle of A, where A and B may be any combination of
+// DistMatrix and PackedDistMatrix (with any supported distributions) and B
+// has already been sized. If 'diag' is UNIT, the diagonal is not referenced.
+// The entries of B outside of the triangle are not modified.
+template<typename T,class SourceType,class DestType>
+inline void
+RedistributeTriangle
+( UpperOrLower uplo, UnitOrNonUnit diag, const SourceType& A, DestType& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("packed::RedistributeTriangle");
+    if( A.Height() != A.Width() || B.Height() != B.Width() )
+        throw std::logic_error("Triangles must be square");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("Matrices must be the same size");
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("Matrices must be on the same grid");
+#endif
+    const Grid& g = A.Grid();
+    if( !g.InGrid() )
+        return;
+    const elem::DistData<int> ADist = A.DistData();
+    const elem::DistData<int> BDist = B.DistData();
+    const Distribution AU = ADist.colDist;
+    const Distribution AV = ADist.rowDist;
+    const Distribution BU = BDist.colDist;
+    const Distribution BV = BDist.rowDist;
+
+    // If the distributions coincide, then no communication is required
+    if( AU == BU && AV == BV &&
+        A.ColAlignment() == B.ColAlignment() &&
+        A.RowAlignment() == B.RowAlignment() )
+    {
+        const int localWidth = A.LocalWidth();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int j = A.RowShift() + jLocal*A.RowStride();
+            int begin, end;
+            TriangleRange
+            ( uplo, diag, j, A.ColShift(), A.ColStride(), A.LocalHeight(),
+              begin, end );
+            if( begin < end )
+                MemCopy
+                ( B.Buffer(begin,jLocal), A.LockedBuffer(begin,jLocal),
+                  end-begin );
+        }
+        return;
+    }
+
+    const int p = g.Size();
+    const int vcRank = g.VCRank();
+    const int AReplicas = NumReplicas( AU, AV, g );
+    const int BReplicas = NumReplicas( BU, BV, g );
+    const int myAReplica = ReplicaIndex( AU, AV, g );
+
+    // Determine the owners, within B's distribution, of our rows and columns
+    // of A
+    const int ALocalHeight = A.LocalHeight();
+    const int ALocalWidth = A.LocalWidth();
+    const int AColShift = A.ColShift();
+    const int ARowShift = A.RowShift();
+    const int AColStride = A.ColStride();
+    const int ARowStride = A.RowStride();
+    const int BColStride = B.ColStride();
+    const int BRowStride = B.RowStride();
+    std::vector<int> rowOwners( ALocalHeight ), colOwners( ALocalWidth );
+    for( int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+        rowOwners[iLocal] =
+            (AColShift+iLocal*AColStride+B.ColAlignment()) % BColStride;
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+        colOwners[jLocal] =
+            (ARowShift+jLocal*ARowStride+B.RowAlignment()) % BRowStride;
+
+    // Each entry is sent to each of its owners in B's distribution by
+    // the owner in A's distribution with replica index q mod AReplicas
+    std::vector<int> sendCounts( p, 0 );
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+    {
+        const int j = ARowShift + jLocal*ARowStride;
+        int begin, end;
+        TriangleRange
+        ( uplo, diag, j, AColShift, AColStride, ALocalHeight, begin, end );
+        for( int iLocal=begin; iLocal<end; ++iLocal )
+        {
+            for( int k=0; k<BReplicas; ++k )
+            {
+                const int q =
+                    VCOwner( BU, BV, rowOwners[iLocal], colOwners[jLocal], k, g );
+                if( q % AReplicas == myAReplica )
+                    ++sendCounts[q];
+            }
+        }
+    }
+
+    // Determine which process sends each of our entries of B
+    const int BLocalHeight = B.LocalHeight();
+    const int BLocalWidth = B.LocalWidth();
+    const int BColShift = B.ColShift();
+    const int BRowShift = B.RowShift();
+    const int sourceReplica = vcRank % AReplicas;
+    std::vector<int> sourceRowOwners( BLocalHeight ),
+                     sourceColOwners( BLocalWidth );
+    for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+        sourceRowOwners[iLocal] =
+            (BColShift+iLocal*BColStride+A.ColAlignment()) % AColStride;
+    for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+        sourceColOwners[jLocal] =
+            (BRowShift+jLocal*BRowStride+A.RowAlignment()) % ARowStride;
+    std::vector<int> recvCounts( p, 0 );
+    for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+    {
+        const int j = BRowShift + jLocal*BRowStride;
+        int begin, end;
+        TriangleRange
+        ( uplo, diag, j, BColShift, BColStride, BLocalHeight, begin, end );
+        for( int iLocal=begin; iLocal<end; ++iLocal )
+            ++recvCounts[VCOwner
+                         ( AU, AV, sourceRowOwners[iLocal],
+                           sourceColOwners[jLocal], sourceReplica, g )];
+    }
+
+    std::vector<int> sendDispls( p ), recvDispls( p );
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<p; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    // Pack
+    std::vector<T> sendBuffer( std::max(totalSend,1) ),
+                   recvBuffer( std::max(totalRecv,1) );
+    std::vector<int> offsets = sendDispls;
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+    {
+        const int j = ARowShift + jLocal*ARowStride;
+        int begin, end;
+        TriangleRange
+        ( uplo, diag, j, AColShift, AColStride, ALocalHeight, begin, end );
+        if( begin >= end )
+            continue;
+        const T* ACol = A.LockedBuffer( begin, jLocal );
+        for( int iLocal=begin; iLocal<end; ++iLocal )
+        {
+            for( int k=0; k<BReplicas; ++k )
+            {
+                const int q =
+                    VCOwner( BU, BV, rowOwners[iLocal], colOwners[jLocal], k, g );
+                if( q % AReplicas == myAReplica )
+                    sendBuffer[offsets[q]++] = ACol[iLocal-begin];
+            }
+        }
+    }
+
+    // Communicate
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], g.VCComm() );
+
+    // Unpack
+    offsets = recvDispls;
+    for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+    {
+        const int j = BRowShift + jLocal*BRowStride;
+        int begin, end;
+        TriangleRange
+        ( uplo, diag, j, BColShift, BColStride, BLocalHeight, begin, end );
+        if( begin >= end )
+            continue;
+        T* BCol = B.Buffer( begin, jLocal );
+        for( int iLocal=begin; iLocal<end; ++iLocal )
+        {
+            const int q =
+                VCOwner
+                ( AU, AV, sourceRowOwners[iLocal], sourceColOwners[jLocal],
+                  sourceReplica, g );
+            BCol[iLocal-begin] = recvBuffer[offsets[q]++];
+        }
+    }
+}
+
+} // namespace packed
+
+template<typename T,Distribution U,Distribution V>
+class PackedDistMatrix
+{
+public:
+    PackedDistMatrix( const elem::Grid& g=DefaultGrid() );
+    PackedDistMatrix
+    ( UpperOrLower uplo, int n, const elem::Grid& g=DefaultGrid() );
+    // Pack the 'uplo' triangle of A
+    PackedDistMatrix( UpperOrLower uplo, const DistMatrix<T,U,V>& A );
+    PackedDistMatrix( const PackedDistMatrix<T,U,V>& A );
+
+    UpperOrLower Uplo() const { return uplo_; }
+    int Height() const { return height_; }
+    int Width() const { return height_; }
+    const elem::Grid& Grid() const { return *grid_; }
+    bool Viewing() const { return viewing_; }
+    bool Locked() const { return locked_; }
+
+    int ColAlignment() const { return colAlignment_; }
+    int RowAlignment() const { return rowAlignment_; }
+    int ColShift() const { return colShift_; }
+    int RowShift() const { return rowShift_; }
+    int ColStride() const { return packed::Stride( U, *grid_ ); }
+    int RowStride() const { return packed::Stride( V, *grid_ ); }
+    int LocalHeight() const
+    { return Length_( height_, colShift_, ColStride() ); }
+    int LocalWidth() const
+    { return Length_( height_, rowShift_, RowStride() ); }
+    elem::DistData<int> DistData() const;
+
+    // The number of entries stored by this process
+    int LocalEntries() const;
+
+    // The stored local rows of local column jLocal are
+    // [LocalColumnBegin(jLocal),LocalColumnEnd(jLocal))
+    int LocalColumnBegin( int jLocal ) const;
+    int LocalColumnEnd( int jLocal ) const;
+
+    T* Buffer( int iLocal, int jLocal );
+    const T* LockedBuffer( int iLocal, int jLocal ) const;
+    T GetLocal( int iLocal, int jLocal ) const
+    { return *LockedBuffer( iLocal, jLocal ); }
+    void SetLocal( int iLocal, int jLocal, T alpha )
+    { *Buffer( iLocal, jLocal ) = alpha; }
+    void UpdateLocal( int iLocal, int jLocal, T alpha )
+    { *Buffer( iLocal, jLocal ) += alpha; }
+
+    void Align( int colAlignment, int rowAlignment );
+    void AlignWith( const elem::DistData<int>& data );
+    void ResizeTo( UpperOrLower uplo, int n );
+    void Empty();
+
+    // Pack the 'uplo' triangle of A (adopting its alignments)
+    void Pack( UpperOrLower uplo, const DistMatrix<T,U,V>& A );
+    // Set A to the full matrix with the stored triangle and zeros elsewhere
+    void Unpack( DistMatrix<T,U,V>& A ) const;
+
+    // B := A(i:i+height-1,j:j+width-1), where B is aligned with the
+    // corresponding submatrix and the unstored entries are zero
+    void GetBlock
+    ( int i, int j, int height, int width, DistMatrix<T,U,V>& B ) const;
+    // Overwrite the stored entries of A(i:i+B.Height()-1,j:j+B.Width()-1)
+    // with those of B, which must either be [* ,* ] or aligned with the
+    // submatrix (as returned by GetBlock)
+    template<Distribution W,Distribution Z>
+    void SetBlock( int i, int j, const DistMatrix<T,W,Z>& B );
+
+    // Make this matrix a (locked) view of the diagonal block
+    // A(offset:offset+size-1,offset:offset+size-1)
+    void AttachDiagonalBlock( PackedDistMatrix<T,U,V>& A, int offset, int size );
+    void LockedAttachDiagonalBlock
+    ( const PackedDistMatrix<T,U,V>& A, int offset, int size );
+
+    const PackedDistMatrix<T,U,V>& operator=( const PackedDistMatrix<T,U,V>& A );
+    template<Distribution W,Distribution Z>
+    const PackedDistMatrix<T,U,V>& operator=( const PackedDistMatrix<T,W,Z>& A );
+
+private:
+    UpperOrLower uplo_;
+    int height_;
+    const elem::Grid* grid_;
+    int colAlignment_, rowAlignment_;
+    int colShift_, rowShift_;
+    bool viewing_, locked_;
+    // Whether the alignments were explicitly specified (and should therefore
+    // be preserved by assignments)
+    bool constrainedAlignment_;
+    std::vector<T> memory_;
+    T* buffer_;
+    const T* lockedBuffer_;
+    // The position in the buffer of the first stored entry of each column
+    std::vector<int> offsets_;
+
+    void SetShifts();
+    void SetOffsets();
+    void AttachDiagonalBlockHelper
+    ( const PackedDistMatrix<T,U,V>& A, int offset, int size );
+};
+
+//
+// Implementation
+//
+
+template<typename T,Distribution U,Distribution V>
+inline
+PackedDistMatrix<T,U,V>::PackedDistMatrix( const elem::Grid& g )
+: uplo_(LOWER), height_(0), grid_(&g), colAlignment_(0), rowAlignment_(0),
+  viewing_(false), locked_(false), constrainedAlignment_(false),
+  buffer_(0), lockedBuffer_(0)
+{ SetShifts(); }
+
+template<typename T,Distribution U,Distribution V>
+inline
+PackedDistMatrix<T,U,V>::PackedDistMatrix
+( UpperOrLower uplo, int n, const elem::Grid& g )
+: uplo_(uplo), height_(0), grid_(&g), colAlignment_(0), rowAlignment_(0),
+  viewing_(false), locked_(false), constrainedAlignment_(false),
+  buffer_(0), lockedBuffer_(0)
+{
+    SetShifts();
+    ResizeTo( uplo, n );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline
+PackedDistMatrix<T,U,V>::PackedDistMatrix
+( UpperOrLower uplo, const DistMatrix<T,U,V>& A )
+: uplo_(uplo), height_(0), grid_(&A.Grid()), colAlignment_(0),
+  rowAlignment_(0), viewing_(false), locked_(false),
+  constrainedAlignment_(false), buffer_(0), lockedBuffer_(0)
+{
+    SetShifts();
+    Pack( uplo, A );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline
+PackedDistMatrix<T,U,V>::PackedDistMatrix( const PackedDistMatrix<T,U,V>& A )
+: uplo_(A.Uplo()), height_(0), grid_(&A.Grid()),
+  colAlignment_(A.ColAlignment()), rowAlignment_(A.RowAlignment()),
+  viewing_(false), locked_(false), constrainedAlignment_(false),
+  buffer_(0), lockedBuffer_(0)
+{
+    SetShifts();
+    *this = A;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::SetShifts()
+{
+    if( grid_->InGrid() )
+    {
+        colShift_ = Shift_
+            ( packed::Rank(U,*grid_), colAlignment_, ColStride() );
+        rowShift_ = Shift_
+            ( packed::Rank(V,*grid_), rowAlignment_, RowStride() );
+    }
+    else
+    {
+        colShift_ = 0;
+        rowShift_ = 0;
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::SetOffsets()
+{
+    const int localWidth = LocalWidth();
+    offsets_.resize( localWidth );
+    int offset = 0;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        offsets_[jLocal] = offset;
+        offset += LocalColumnEnd(jLocal) - LocalColumnBegin(jLocal);
+    }
+    memory_.resize( std::max(offset,1) );
+    buffer_ = &memory_[0];
+    lockedBuffer_ = buffer_;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline elem::DistData<int>
+PackedDistMatrix<T,U,V>::DistData() const
+{
+    elem::DistData<int> data;
+    data.colDist = U;
+    data.rowDist = V;
+    data.colAlignment = colAlignment_;
+    data.rowAlignment = rowAlignment_;
+    data.diagPath = 0;
+    data.grid = grid_;
+    return data;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline int
+PackedDistMatrix<T,U,V>::LocalColumnBegin( int jLocal ) const
+{
+    if( uplo_ == UPPER )
+        return 0;
+    const int j = rowShift_ + jLocal*RowStride();
+    return Length_( j, colShift_, ColStride() );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline int
+PackedDistMatrix<T,U,V>::LocalColumnEnd( int jLocal ) const
+{
+    if( uplo_ == LOWER )
+        return LocalHeight();
+    const int j = rowShift_ + jLocal*RowStride();
+    return Length_( j+1, colShift_, ColStride() );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline int
+PackedDistMatrix<T,U,V>::LocalEntries() const
+{
+    const int localWidth = LocalWidth();
+    int numEntries = 0;
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        numEntries += LocalColumnEnd(jLocal) - LocalColumnBegin(jLocal);
+    return numEntries;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline T*
+PackedDistMatrix<T,U,V>::Buffer( int iLocal, int jLocal )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::Buffer");
+    if( locked_ )
+        throw std::logic_error("Cannot return a modifiable pointer to a view");
+    if( iLocal < LocalColumnBegin(jLocal) || iLocal > LocalColumnEnd(jLocal) )
+        throw std::logic_error("Entry is not stored");
+#endif
+    return &buffer_[offsets_[jLocal]+(iLocal-LocalColumnBegin(jLocal))];
+}
+
+template<typename T,Distribution U,Distribution V>
+inline const T*
+PackedDistMatrix<T,U,V>::LockedBuffer( int iLocal, int jLocal ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::LockedBuffer");
+    if( iLocal < LocalColumnBegin(jLocal) || iLocal > LocalColumnEnd(jLocal) )
+        throw std::logic_error("Entry is not stored");
+#endif
+    return &lockedBuffer_[offsets_[jLocal]+(iLocal-LocalColumnBegin(jLocal))];
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::Align( int colAlignment, int rowAlignment )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::Align");
+    if( viewing_ )
+        throw std::logic_error("Cannot realign a view");
+#endif
+    colAlignment_ = colAlignment;
+    rowAlignment_ = rowAlignment;
+    constrainedAlignment_ = true;
+    SetShifts();
+    SetOffsets();
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::AlignWith( const elem::DistData<int>& data )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::AlignWith");
+#endif
+    if( data.colDist == U && data.rowDist == V )
+        Align( data.colAlignment, data.rowAlignment );
+    else if( data.colDist == U && data.rowDist == STAR )
+        Align( data.colAlignment, rowAlignment_ );
+    else if( data.colDist == STAR && data.rowDist == V )
+        Align( colAlignment_, data.rowAlignment );
+    else if( data.colDist == V && data.rowDist == U )
+        Align( data.rowAlignment, data.colAlignment );
+    else
+        throw std::logic_error("Unsupported alignment");
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::ResizeTo( UpperOrLower uplo, int n )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::ResizeTo");
+    if( viewing_ && (n != height_ || uplo != uplo_) )
+        throw std::logic_error("Cannot resize a view");
+    if( n < 0 )
+        throw std::logic_error("Height must be non-negative");
+#endif
+    if( viewing_ )
+        return;
+    uplo_ = uplo;
+    height_ = n;
+    SetOffsets();
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::Empty()
+{
+    height_ = 0;
+    viewing_ = false;
+    locked_ = false;
+    constrainedAlignment_ = false;
+    colAlignment_ = 0;
+    rowAlignment_ = 0;
+    SetShifts();
+    std::vector<T>().swap( memory_ );
+    SetOffsets();
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::Pack( UpperOrLower uplo, const DistMatrix<T,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::Pack");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Can only pack square matrices");
+    if( A.Grid() != *grid_ )
+        throw std::logic_error("Matrices must be on the same grid");
+#endif
+    if( viewing_ )
+    {
+        if( A.ColAlignment() != colAlignment_ ||
+            A.RowAlignment() != rowAlignment_ )
+            throw std::logic_error("Views must be packed from aligned data");
+    }
+    else
+    {
+        colAlignment_ = A.ColAlignment();
+        rowAlignment_ = A.RowAlignment();
+        SetShifts();
+    }
+    ResizeTo( uplo, A.Height() );
+    const int localWidth = LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int begin = LocalColumnBegin( jLocal );
+        const int end = LocalColumnEnd( jLocal );
+        if( begin < end )
+            MemCopy( Buffer(begin,jLocal), A.LockedBuffer(begin,jLocal),
+                     end-begin );
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::Unpack( DistMatrix<T,U,V>& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::Unpack");
+#endif
+    if( !A.Viewing() )
+    {
+        A.FreeAlignments();
+        A.Align( colAlignment_, rowAlignment_ );
+    }
+    else if( A.ColAlignment() != colAlignment_ ||
+             A.RowAlignment() != rowAlignment_ )
+        throw std::logic_error("Cannot unpack into a misaligned view");
+    A.ResizeTo( height_, height_ );
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int begin = LocalColumnBegin( jLocal );
+        const int end = LocalColumnEnd( jLocal );
+        T* ACol = A.Buffer(0,jLocal);
+        for( int iLocal=0; iLocal<begin; ++iLocal )
+            ACol[iLocal] = 0;
+        if( begin < end )
+            MemCopy( &ACol[begin], LockedBuffer(begin,jLocal), end-begin );
+        for( int iLocal=end; iLocal<localHeight; ++iLocal )
+            ACol[iLocal] = 0;
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::GetBlock
+( int i, int j, int height, int width, DistMatrix<T,U,V>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::GetBlock");
+    if( i < 0 || j < 0 || i+height > height_ || j+width > height_ )
+        throw std::logic_error("Block is out of bounds");
+#endif
+    const int colStride = ColStride();
+    const int rowStride = RowStride();
+    const int colAlignment = (colAlignment_+i) % colStride;
+    const int rowAlignment = (rowAlignment_+j) % rowStride;
+    if( !B.Viewing() )
+    {
+        // B is overwritten, so discard any alignment left over from a
+        // previous use (e.g., the previous iteration of a blocked loop)
+        B.FreeAlignments();
+        B.Align( colAlignment, rowAlignment );
+    }
+    else if( B.ColAlignment() != colAlignment ||
+             B.RowAlignment() != rowAlignment )
+        throw std::logic_error("Cannot extract into a misaligned view");
+    B.ResizeTo( height, width );
+    const int iLocalOffset = Length_( i, colShift_, colStride );
+    const int jLocalOffset = Length_( j, rowShift_, rowStride );
+    const int localHeight = B.LocalHeight();
+    const int localWidth = B.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int jLocalA = jLocalOffset + jLocal;
+        const int begin = std::max
+            ( LocalColumnBegin(jLocalA)-iLocalOffset, 0 );
+        const int end = std::min
+            ( LocalColumnEnd(jLocalA)-iLocalOffset, localHeight );
+        T* BCol = B.Buffer(0,jLocal);
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            BCol[iLocal] = 0;
+        if( begin < end )
+            MemCopy
+            ( &BCol[begin], LockedBuffer(iLocalOffset+begin,jLocalA),
+              end-begin );
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+template<Distribution W,Distribution Z>
+inline void
+PackedDistMatrix<T,U,V>::SetBlock( int i, int j, const DistMatrix<T,W,Z>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::SetBlock");
+    if( i < 0 || j < 0 || i+B.Height() > height_ || j+B.Width() > height_ )
+        throw std::logic_error("Block is out of bounds");
+#endif
+    const int colStride = ColStride();
+    const int rowStride = RowStride();
+    const int BColStride = B.ColStride();
+    const int BRowStride = B.RowStride();
+    const bool replicated = ( BColStride == 1 && BRowStride == 1 );
+    if( !replicated &&
+        ( W != U || Z != V ||
+          B.ColAlignment() != (colAlignment_+i) % colStride ||
+          B.RowAlignment() != (rowAlignment_+j) % rowStride ) )
+        throw std::logic_error("B must be [* ,* ] or aligned with the block");
+    const int iLocalOffset = Length_( i, colShift_, colStride );
+    const int jLocalOffset = Length_( j, rowShift_, rowStride );
+    const int localHeight = Length_( i+B.Height(), colShift_, colStride );
+    const int localWidth = Length_( j+B.Width(), rowShift_, rowStride );
+    for( int jLocalA=jLocalOffset; jLocalA<localWidth; ++jLocalA )
+    {
+        const int begin = std::max( LocalColumnBegin(jLocalA), iLocalOffset );
+        const int end = std::min( LocalColumnEnd(jLocalA), localHeight );
+        if( begin >= end )
+            continue;
+        T* ACol = Buffer( begin, jLocalA );
+        if( replicated )
+        {
+            const int jB = rowShift_ + jLocalA*rowStride - j;
+            const int iBStart = colShift_ + begin*colStride - i;
+            const T* BCol = B.LockedBuffer(0,jB);
+            for( int iLocal=begin; iLocal<end; ++iLocal )
+                ACol[iLocal-begin] =
+                    BCol[iBStart+(iLocal-begin)*colStride];
+        }
+        else
+            MemCopy
+            ( ACol, B.LockedBuffer(begin-iLocalOffset,jLocalA-jLocalOffset),
+              end-begin );
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::AttachDiagonalBlockHelper
+( const PackedDistMatrix<T,U,V>& A, int offset, int size )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::AttachDiagonalBlockHelper");
+    if( offset < 0 || size < 0 || offset+size > A.Height() )
+        throw std::logic_error("Diagonal block is out of bounds");
+#endif
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    grid_ = &A.Grid();
+    uplo_ = A.Uplo();
+    height_ = size;
+    colAlignment_ = (A.ColAlignment()+offset) % colStride;
+    rowAlignment_ = (A.RowAlignment()+offset) % rowStride;
+    SetShifts();
+    std::vector<T>().swap( memory_ );
+    const int iLocalOffset = Length_( offset, A.ColShift(), colStride );
+    const int jLocalOffset = Length_( offset, A.RowShift(), rowStride );
+    const int localWidth = LocalWidth();
+    offsets_.resize( localWidth );
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int jLocalA = jLocalOffset + jLocal;
+        offsets_[jLocal] = A.offsets_[jLocalA] +
+            (iLocalOffset+LocalColumnBegin(jLocal)-A.LocalColumnBegin(jLocalA));
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::AttachDiagonalBlock
+( PackedDistMatrix<T,U,V>& A, int offset, int size )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::AttachDiagonalBlock");
+    if( A.Locked() )
+        throw std::logic_error("Cannot view a locked matrix as mutable");
+#endif
+    AttachDiagonalBlockHelper( A, offset, size );
+    buffer_ = A.buffer_;
+    lockedBuffer_ = A.buffer_;
+    viewing_ = true;
+    locked_ = false;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+PackedDistMatrix<T,U,V>::LockedAttachDiagonalBlock
+( const PackedDistMatrix<T,U,V>& A, int offset, int size )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::LockedAttachDiagonalBlock");
+#endif
+    AttachDiagonalBlockHelper( A, offset, size );
+    buffer_ = 0;
+    lockedBuffer_ = A.lockedBuffer_;
+    viewing_ = true;
+    locked_ = true;
+}
+
+template<typename T,Distribution U,Distribution V>
+inline const PackedDistMatrix<T,U,V>&
+PackedDistMatrix<T,U,V>::operator=( const PackedDistMatrix<T,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::operator=");
+#endif
+    if( &A == this )
+        return *this;
+    if( viewing_ )
+    {
+        if( A.Height() != height_ || A.Uplo() != uplo_ )
+            throw std::logic_error("Cannot resize a view");
+    }
+    else
+    {
+        grid_ = &A.Grid();
+        if( !constrainedAlignment_ )
+        {
+            colAlignment_ = A.ColAlignment();
+            rowAlignment_ = A.RowAlignment();
+        }
+        SetShifts();
+        ResizeTo( A.Uplo(), A.Height() );
+    }
+    if( A.ColAlignment() == colAlignment_ && A.RowAlignment() == rowAlignment_ )
+    {
+        const int localWidth = LocalWidth();
+        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        {
+            const int begin = LocalColumnBegin( jLocal );
+            const int end = LocalColumnEnd( jLocal );
+            if( begin < end )
+                MemCopy
+                ( Buffer(begin,jLocal), A.LockedBuffer(begin,jLocal),
+                  end-begin );
+        }
+    }
+    else
+        packed::RedistributeTriangle<T>( uplo_, NON_UNIT, A, *this );
+    return *this;
+}
+
+template<typename T,Distribution U,Distribution V>
+template<Distribution W,Distribution Z>
+inline const PackedDistMatrix<T,U,V>&
+PackedDistMatrix<T,U,V>::operator=( const PackedDistMatrix<T,W,Z>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("PackedDistMatrix::operator=");
+    if( A.Grid() != *grid_ )
+        throw std::logic_error("Matrices must be on the same grid");
+#endif
+    if( viewing_ )
+    {
+        if( A.Height() != height_ || A.Uplo() != uplo_ )
+            throw std::logic_error("Cannot resize a view");
+    }
+    else
+        ResizeTo( A.Uplo(), A.Height() );
+    packed::RedistributeTriangle<T>( uplo_, NON_UNIT, A, *this );
+    return *this;
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_PACKEDDISTMATRIX_HPP
@@ -18,6 +18,52 @@ const double Pi = 3.141592653589793;
 // origin of the ring implied by the type T using the most natural metric.
 template<typename T> T SampleUnitBall();
 
+// A stream of samples from the Philox-4x32-10 counter-based generator of 
+// Salmon et al., "Parallel random numbers: as easy as 1, 2, 3". Each sample 
+// is a pure function of the seed, the index of the stream, and the (i,j) 
+// counter, so that the entries of a random matrix do not depend upon the 
+// process grid, the distribution, or the order in which they are generated.
+class RandomStream
+{
+public:
+    RandomStream( unsigned long seed, unsigned long stream );
+
+    // Return four random 32-bit words
+    void Sample( int i, int j, unsigned* words ) const;
+
+    // Return a sample from a uniform PDF over [0,1)
+    double Uniform( int i, int j ) const;
+
+    // The counter-based analogue of SampleUnitBall<T>()
+    template<typename T> T SampleUnitBall( int i, int j ) const;
+
+    // Return a sample from a standard normal distribution (for complex T, 
+    // the real and imaginary parts each have variance 1/2)
+    template<typename T> T SampleNormal( int i, int j ) const;
+
+private:
+    unsigned key_[2];
+    unsigned stream_[2];
+};
+
+// Set the seed for counter-based generation and restart its sequences of 
+// streams. The seed is broadcast from the root of mpi::COMM_WORLD within 
+// Initialize, and this routine should be called with the same value on 
+// every process.
+void SetRandomSeed( unsigned long seed );
+unsigned long RandomSeed();
+
+// Return the stream for the next distributed random matrix. Since these 
+// streams are numbered consecutively, every process must request them in the
+// same order (as is the case for the collective routines which use them).
+RandomStream NextRandomStream();
+
+// Return the stream for the next local random matrix, which is drawn from an
+// independent sequence so that local generation need not be collective. The
+// sequence depends upon the rank within mpi::COMM_WORLD, so that the local
+// random matrices of different processes differ.
+RandomStream NextLocalRandomStream();
+
 } // namespace elem
 
 #endif // ifndef CORE_RANDOM_DECL_HPP
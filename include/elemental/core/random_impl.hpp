@@ -67,6 +67,184 @@ SampleUnitBall<Complex<double> >()
     return Complex<double>(r*cos(angle),r*sin(angle));
 }
 
+//
+// Counter-based generation
+//
+
+inline
+RandomStream::RandomStream( unsigned long seed, unsigned long stream )
+{
+    // Split the (at most 64-bit) seed and stream index into 32-bit words
+    key_[0] = seed & 0xFFFFFFFFUL;
+    key_[1] = ((seed >> 16) >> 16) & 0xFFFFFFFFUL;
+    stream_[0] = stream & 0xFFFFFFFFUL;
+    stream_[1] = ((stream >> 16) >> 16) & 0xFFFFFFFFUL;
+}
+
+inline void
+RandomStream::Sample( int i, int j, unsigned* words ) const
+{
+    const unsigned long long M0 = 0xD2511F53ULL, M1 = 0xCD9E8D57ULL;
+    const unsigned W0 = 0x9E3779B9U, W1 = 0xBB67AE85U;
+
+    unsigned c0 = i, c1 = j, c2 = stream_[0], c3 = stream_[1];
+    unsigned k0 = key_[0], k1 = key_[1];
+    for( int round=0; round<10; ++round )
+    {
+        const unsigned long long p0 = M0*c0;
+        const unsigned long long p1 = M1*c2;
+        const unsigned hi0 = p0 >> 32, lo0 = p0 & 0xFFFFFFFFULL;
+        const unsigned hi1 = p1 >> 32, lo1 = p1 & 0xFFFFFFFFULL;
+        c0 = hi1 ^ c1 ^ k0;
+        c1 = lo1;
+        c2 = hi0 ^ c3 ^ k1;
+        c3 = lo0;
+        k0 += W0;
+        k1 += W1;
+    }
+    words[0] = c0;
+    words[1] = c1;
+    words[2] = c2;
+    words[3] = c3;
+}
+
+// Form a double-precision value in [0,1) from the top 53 bits of two words
+inline double
+WordsToUniform( unsigned hi, unsigned lo )
+{ return ((hi >> 5)*67108864.0 + (lo >> 6))*(1.0/9007199254740992.0); }
+
+inline double
+RandomStream::Uniform( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    return WordsToUniform( words[0], words[1] );
+}
+
+template<>
+inline int
+RandomStream::SampleUnitBall<int>( int i, int j ) const
+{
+    const double u = Uniform( i, j );
+    if( u <= 1./3. )
+        return -1;
+    else if( u <= 2./3. )
+        return 0;
+    else
+        return +1;
+}
+
+template<>
+inline Complex<int>
+RandomStream::SampleUnitBall<Complex<int> >( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    const double u[2] = { WordsToUniform( words[0], words[1] ), 
+                          WordsToUniform( words[2], words[3] ) };
+    int values[2];
+    for( int k=0; k<2; ++k )
+    {
+        if( u[k] <= 1./3. )
+            values[k] = -1;
+        else if( u[k] <= 2./3. )
+            values[k] = 0;
+        else
+            values[k] = +1;
+    }
+    return Complex<int>( values[0], values[1] );
+}
+
+template<>
+inline float
+RandomStream::SampleUnitBall<float>( int i, int j ) const
+{ return 2*float(Uniform(i,j))-1.0f; }
+
+template<>
+inline double
+RandomStream::SampleUnitBall<double>( int i, int j ) const
+{ return 2*Uniform(i,j)-1.0; }
+
+template<>
+inline Complex<float>
+RandomStream::SampleUnitBall<Complex<float> >( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    const float r = WordsToUniform( words[0], words[1] );
+    const float angle = 2*Pi*WordsToUniform( words[2], words[3] );
+    return Complex<float>(r*cos(angle),r*sin(angle));
+}
+
+template<>
+inline Complex<double>
+RandomStream::SampleUnitBall<Complex<double> >( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    const double r = WordsToUniform( words[0], words[1] );
+    const double angle = 2*Pi*WordsToUniform( words[2], words[3] );
+    return Complex<double>(r*cos(angle),r*sin(angle));
+}
+
+// Use the Box-Muller transform on the two uniform samples from each counter
+inline void
+WordsToNormals( const unsigned* words, double& x, double& y )
+{
+    // Draw the radial sample from (0,1] so that its logarithm is finite
+    const double u = 1 - WordsToUniform( words[0], words[1] );
+    const double angle = 2*Pi*WordsToUniform( words[2], words[3] );
+    const double r = sqrt( -2*log(u) );
+    x = r*cos(angle);
+    y = r*sin(angle);
+}
+
+template<>
+inline float
+RandomStream::SampleNormal<float>( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    double x, y;
+    WordsToNormals( words, x, y );
+    return x;
+}
+
+template<>
+inline double
+RandomStream::SampleNormal<double>( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    double x, y;
+    WordsToNormals( words, x, y );
+    return x;
+}
+
+template<>
+inline Complex<float>
+RandomStream::SampleNormal<Complex<float> >( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    double x, y;
+    WordsToNormals( words, x, y );
+    const double scale = 1/sqrt(2.);
+    return Complex<float>( scale*x, scale*y );
+}
+
+template<>
+inline Complex<double>
+RandomStream::SampleNormal<Complex<double> >( int i, int j ) const
+{
+    unsigned words[4];
+    Sample( i, j, words );
+    double x, y;
+    WordsToNormals( words, x, y );
+    const double scale = 1/sqrt(2.);
+    return Complex<double>( scale*x, scale*y );
+}
+
 } // namespace elem
 
 #endif // ifndef CORE_RANDOM_IMPL_HPP
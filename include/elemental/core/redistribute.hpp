@@ -0,0 +1,295 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_REDISTRIBUTE_HPP
+#define CORE_REDISTRIBUTE_HPP
+
+namespace elem {
+
+// B := op(A), where the chain of redistributions (and the transposition) which
+// would otherwise be required, e.g.,
+//
+//     A_VR_STAR = A;
+//     ATrans_STAR_MR.TransposeFrom( A_VR_STAR );
+//
+// is fused into a single all-to-all over the VC communicator, and no
+// intermediate distributed matrices are formed. If each process already owns
+// all of its entries of op(A) within A, then no communication is performed.
+// Note that the chains over process rows or columns are typically cheaper than
+// the p-way exchange, so they should be preferred where they exist.
+//
+// If B is a view, then it must already be the correct size. Otherwise, B is
+// resized and any of its free alignments whose distributions match the
+// corresponding distribution of op(A) are set to the alignment of op(A).
+// The [MD,* ] and [* ,MD] distributions are not supported.
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+Redistribute
+( Orientation orientation, const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Redistribute");
+    B.AssertNotLocked();
+    if( A.Grid() != B.Grid() )
+        throw std::logic_error("A and B must use the same grid");
+    if( U == MD || V == MD || W == MD || Z == MD )
+        throw std::logic_error("[MD,* ] and [* ,MD] are not supported");
+#endif
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    const int height = ( normal ? A.Height() : A.Width() );
+    const int width = ( normal ? A.Width() : A.Height() );
+
+    // The distributions and alignments of A which correspond to the column
+    // and row dimensions of B
+    const Distribution AColDist = ( normal ? U : V );
+    const Distribution ARowDist = ( normal ? V : U );
+    const int AColAlignment = ( normal ? A.ColAlignment() : A.RowAlignment() );
+    const int ARowAlignment = ( normal ? A.RowAlignment() : A.ColAlignment() );
+    if( B.Viewing() )
+    {
+        if( B.Height() != height || B.Width() != width )
+            throw std::logic_error("Cannot resize a view");
+    }
+    else
+    {
+        if( !B.ConstrainedColAlignment() && W == AColDist )
+            B.AlignCols( AColAlignment );
+        if( !B.ConstrainedRowAlignment() && Z == ARowDist )
+            B.AlignRows( ARowAlignment );
+        B.ResizeTo( height, width );
+    }
+    const Grid& g = B.Grid();
+    if( !g.InGrid() )
+        return;
+
+    const int BLocalHeight = B.LocalHeight();
+    const int BLocalWidth = B.LocalWidth();
+    const int BColShift = B.ColShift();
+    const int BRowShift = B.RowShift();
+    const int BColStride = B.ColStride();
+    const int BRowStride = B.RowStride();
+    const int AColStride = packed::Stride( AColDist, g );
+    const int ARowStride = packed::Stride( ARowDist, g );
+    const T* ABuffer = A.LockedBuffer();
+    const int ALDim = A.LDim();
+
+    // If each dimension of op(A) is either undistributed or coincides with
+    // the corresponding dimension of B, then our entries of B are local
+    const bool localCols =
+        ( AColStride == 1 ||
+          dist_data::DimensionsCoincide
+          ( AColDist, AColAlignment, W, B.ColAlignment(), g ) );
+    const bool localRows =
+        ( ARowStride == 1 ||
+          dist_data::DimensionsCoincide
+          ( ARowDist, ARowAlignment, Z, B.RowAlignment(), g ) );
+    if( localCols && localRows )
+    {
+        // The local indices of op(A) which hold each local row and column
+        // of B
+        std::vector<int> rowIndices( BLocalHeight ), colIndices( BLocalWidth );
+        for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+            rowIndices[iLocal] =
+                ( AColStride == 1 ? BColShift+iLocal*BColStride : iLocal );
+        for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+            colIndices[jLocal] =
+                ( ARowStride == 1 ? BRowShift+jLocal*BRowStride : jLocal );
+        const bool contiguous =
+            normal && ( AColStride != 1 || BColStride == 1 );
+        for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+        {
+            T* BCol = B.Buffer(0,jLocal);
+            const int jA = colIndices[jLocal];
+            if( BLocalHeight == 0 )
+                break;
+            else if( contiguous )
+                MemCopy( BCol, &ABuffer[rowIndices[0]+jA*ALDim], BLocalHeight );
+            else if( normal )
+                for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+                    BCol[iLocal] = ABuffer[rowIndices[iLocal]+jA*ALDim];
+            else if( conjugate )
+                for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+                    BCol[iLocal] = Conj(ABuffer[jA+rowIndices[iLocal]*ALDim]);
+            else
+                for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+                    BCol[iLocal] = ABuffer[jA+rowIndices[iLocal]*ALDim];
+        }
+        return;
+    }
+
+    // Since the VC rank of each owner is the sum of a term which depends
+    // upon the row owner, a term which depends upon the column owner, and a
+    // term which depends upon the replica, the owners can be tabulated
+    // separately for each local row and column
+    const int p = g.Size();
+    const int AReplicas = packed::NumReplicas( U, V, g );
+    const int BReplicas = packed::NumReplicas( W, Z, g );
+    const int myAReplica = packed::ReplicaIndex( U, V, g );
+    const int ALocalHeight = A.LocalHeight();
+    const int ALocalWidth = A.LocalWidth();
+    const int AColShift = A.ColShift();
+    const int ARowShift = A.RowShift();
+    std::vector<int> destRowTerms( ALocalHeight ), destColTerms( ALocalWidth ),
+                     destReplicaTerms( BReplicas );
+    for( int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+    {
+        const int i = AColShift + iLocal*A.ColStride();
+        destRowTerms[iLocal] = ( normal ?
+          packed::VCOwner( W, Z, (i+B.ColAlignment())%BColStride, 0, 0, g ) :
+          packed::VCOwner( W, Z, 0, (i+B.RowAlignment())%BRowStride, 0, g ) );
+    }
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+    {
+        const int j = ARowShift + jLocal*A.RowStride();
+        destColTerms[jLocal] = ( normal ?
+          packed::VCOwner( W, Z, 0, (j+B.RowAlignment())%BRowStride, 0, g ) :
+          packed::VCOwner( W, Z, (j+B.ColAlignment())%BColStride, 0, 0, g ) );
+    }
+    for( int k=0; k<BReplicas; ++k )
+        destReplicaTerms[k] = packed::VCOwner( W, Z, 0, 0, k, g );
+
+    // The owner within A of each of our entries of B
+    const int sourceReplicaTerm =
+        packed::VCOwner( U, V, 0, 0, g.VCRank() % AReplicas, g );
+    std::vector<int> sourceRowTerms( BLocalHeight ),
+                     sourceColTerms( BLocalWidth );
+    for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+    {
+        const int owner =
+            (BColShift+iLocal*BColStride+AColAlignment) % AColStride;
+        sourceRowTerms[iLocal] = ( normal ?
+          packed::VCOwner( U, V, owner, 0, 0, g ) :
+          packed::VCOwner( U, V, 0, owner, 0, g ) );
+    }
+    for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+    {
+        const int owner =
+            (BRowShift+jLocal*BRowStride+ARowAlignment) % ARowStride;
+        sourceColTerms[jLocal] = ( normal ?
+          packed::VCOwner( U, V, 0, owner, 0, g ) :
+          packed::VCOwner( U, V, owner, 0, 0, g ) );
+    }
+
+    // Form the send and recv counts from histograms of the terms
+    std::vector<int> rowHist( p, 0 ), colHist( p, 0 );
+    for( int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+        ++rowHist[destRowTerms[iLocal]];
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+        ++colHist[destColTerms[jLocal]];
+    std::vector<int> sendCounts( p, 0 ), recvCounts( p, 0 );
+    for( int a=0; a<p; ++a )
+    {
+        if( rowHist[a] == 0 )
+            continue;
+        for( int b=0; b<p; ++b )
+        {
+            if( colHist[b] == 0 )
+                continue;
+            for( int k=0; k<BReplicas; ++k )
+            {
+                const int q = a + b + destReplicaTerms[k];
+                if( q % AReplicas == myAReplica )
+                    sendCounts[q] += rowHist[a]*colHist[b];
+            }
+        }
+    }
+    rowHist.assign( p, 0 );
+    colHist.assign( p, 0 );
+    for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+        ++rowHist[sourceRowTerms[iLocal]];
+    for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+        ++colHist[sourceColTerms[jLocal]];
+    for( int a=0; a<p; ++a )
+    {
+        if( rowHist[a] == 0 )
+            continue;
+        for( int b=0; b<p; ++b )
+            if( colHist[b] != 0 )
+                recvCounts[a+b+sourceReplicaTerm] += rowHist[a]*colHist[b];
+    }
+
+    std::vector<int> sendDispls( p ), recvDispls( p );
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<p; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    // Pack in the column-major order of A
+    std::vector<T> sendBuffer( std::max(totalSend,1) ),
+                   recvBuffer( std::max(totalRecv,1) );
+    std::vector<int> offsets = sendDispls;
+    for( int jLocal=0; jLocal<ALocalWidth; ++jLocal )
+    {
+        const T* ACol = &ABuffer[jLocal*ALDim];
+        const int colTerm = destColTerms[jLocal];
+        for( int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+        {
+            const T alpha = ( conjugate ? Conj(ACol[iLocal]) : ACol[iLocal] );
+            const int base = destRowTerms[iLocal] + colTerm;
+            for( int k=0; k<BReplicas; ++k )
+            {
+                const int q = base + destReplicaTerms[k];
+                if( q % AReplicas == myAReplica )
+                    sendBuffer[offsets[q]++] = alpha;
+            }
+        }
+    }
+
+    // Communicate
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], g.VCComm() );
+
+    // Unpack in the same order, which is row-major for B if transposing
+    offsets = recvDispls;
+    T* BBuffer = B.Buffer();
+    const int BLDim = B.LDim();
+    if( normal )
+    {
+        for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+        {
+            T* BCol = &BBuffer[jLocal*BLDim];
+            const int colTerm = sourceColTerms[jLocal] + sourceReplicaTerm;
+            for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+                BCol[iLocal] =
+                    recvBuffer[offsets[sourceRowTerms[iLocal]+colTerm]++];
+        }
+    }
+    else
+    {
+        for( int iLocal=0; iLocal<BLocalHeight; ++iLocal )
+        {
+            const int rowTerm = sourceRowTerms[iLocal] + sourceReplicaTerm;
+            for( int jLocal=0; jLocal<BLocalWidth; ++jLocal )
+                BBuffer[iLocal+jLocal*BLDim] =
+                    recvBuffer[offsets[rowTerm+sourceColTerms[jLocal]]++];
+        }
+    }
+}
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+Redistribute( const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Redistribute");
+#endif
+    Redistribute( NORMAL, A, B );
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_REDISTRIBUTE_HPP
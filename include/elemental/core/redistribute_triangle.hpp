@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_REDISTRIBUTETRIANGLE_HPP
+#define CORE_REDISTRIBUTETRIANGLE_HPP
+
+namespace elem {
+
+// B := the 'uplo' triangle of the square matrix A, where only the entries
+// within the triangle (excluding the diagonal if 'diag' is UNIT) are
+// communicated, which roughly halves the volume of B = A for triangular and
+// Hermitian matrices.
+//
+// If B is a view, then its entries outside of the triangle are left
+// unchanged; otherwise B is resized (but not realigned) and the entries
+// outside of the triangle are set to zero. Since the [MD,* ] and [* ,MD]
+// distributions are not supported by the triangular redistribution, they
+// fall back to B = A.
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+RedistributeTriangle
+( UpperOrLower uplo, UnitOrNonUnit diag,
+  const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RedistributeTriangle");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("A must be square");
+#endif
+    if( U == MD || V == MD || W == MD || Z == MD )
+    {
+        B = A;
+        return;
+    }
+    if( !B.Viewing() )
+    {
+        B.ResizeTo( A.Height(), A.Width() );
+        const int localHeight = B.LocalHeight();
+        const int localWidth = B.LocalWidth();
+        const int colShift = B.ColShift();
+        const int rowShift = B.RowShift();
+        const int colStride = B.ColStride();
+        const int rowStride = B.RowStride();
+        for( int jLocal=0; jLocal<localWidth && localHeight>0; ++jLocal )
+        {
+            const int j = rowShift + jLocal*rowStride;
+            int begin, end;
+            packed::TriangleRange
+            ( uplo, diag, j, colShift, colStride, localHeight, begin, end );
+            T* BCol = B.Buffer(0,jLocal);
+            for( int iLocal=0; iLocal<begin; ++iLocal )
+                BCol[iLocal] = 0;
+            for( int iLocal=end; iLocal<localHeight; ++iLocal )
+                BCol[iLocal] = 0;
+        }
+    }
+#ifndef RELEASE
+    else if( B.Height() != A.Height() || B.Width() != A.Width() )
+        throw std::logic_error("Cannot resize a view");
+#endif
+    packed::RedistributeTriangle<T>( uplo, diag, A, B );
+}
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z>
+inline void
+RedistributeTriangle
+( UpperOrLower uplo, const DistMatrix<T,U,V>& A, DistMatrix<T,W,Z>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RedistributeTriangle");
+#endif
+    RedistributeTriangle( uplo, NON_UNIT, A, B );
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_REDISTRIBUTETRIANGLE_HPP
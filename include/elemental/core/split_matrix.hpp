@@ -0,0 +1,412 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_SPLITMATRIX_HPP
+#define CORE_SPLITMATRIX_HPP
+
+//
+// Complex matrices stored as a pair of real matrices, one holding the real
+// parts and the other the imaginary parts ("split" storage), rather than as a
+// single matrix of interleaved Complex<R> entries.
+//
+// Entrywise kernels on split matrices run over contiguous arrays of reals, and
+// can therefore be vectorized without any shuffling, and complex matrix
+// products can be formed from three (or four) real products (see the
+// SplitMatrix overloads of Gemm). Since BLAS and LAPACK require interleaved
+// storage, split storage is opt-in: Split and Merge convert between the two
+// layouts with a single strided pass over the data, whereas a split matrix
+// can view existing real and imaginary parts (e.g., a real matrix and a zero
+// matrix) without any copies.
+//
+// A SplitDistMatrix<R,U,V> holds two identically distributed (and aligned)
+// DistMatrix<R,U,V>, so that its local data is a SplitMatrix<R>.
+//
+
+namespace elem {
+
+template<typename R>
+class SplitMatrix
+{
+public:
+    SplitMatrix() { }
+    SplitMatrix( int height, int width )
+    : real_(height,width), imag_(height,width)
+    { }
+    // Create a split copy of A
+    SplitMatrix( const Matrix<Complex<R> >& A )
+    { Split( A ); }
+
+    int Height() const { return real_.Height(); }
+    int Width() const { return real_.Width(); }
+    bool Viewing() const { return real_.Viewing(); }
+    bool Locked() const { return real_.Locked(); }
+
+    Matrix<R>& Real() { return real_; }
+    Matrix<R>& Imag() { return imag_; }
+    const Matrix<R>& LockedReal() const { return real_; }
+    const Matrix<R>& LockedImag() const { return imag_; }
+
+    Complex<R> Get( int i, int j ) const
+    { return Complex<R>(real_.Get(i,j),imag_.Get(i,j)); }
+    void Set( int i, int j, Complex<R> alpha )
+    { real_.Set(i,j,alpha.real); imag_.Set(i,j,alpha.imag); }
+    void Update( int i, int j, Complex<R> alpha )
+    { real_.Update(i,j,alpha.real); imag_.Update(i,j,alpha.imag); }
+
+    void ResizeTo( int height, int width )
+    { real_.ResizeTo( height, width ); imag_.ResizeTo( height, width ); }
+    void Empty()
+    { real_.Empty(); imag_.Empty(); }
+
+    // Overwrite this matrix with the entries of the interleaved matrix A
+    void Split( const Matrix<Complex<R> >& A );
+    // Overwrite the interleaved matrix A with the entries of this matrix
+    void Merge( Matrix<Complex<R> >& A ) const;
+
+private:
+    Matrix<R> real_, imag_;
+};
+
+template<typename R,Distribution U=MC,Distribution V=MR>
+class SplitDistMatrix
+{
+public:
+    SplitDistMatrix( const elem::Grid& g=DefaultGrid() )
+    : real_(g), imag_(g)
+    { }
+    SplitDistMatrix( int height, int width, const elem::Grid& g=DefaultGrid() )
+    : real_(height,width,g), imag_(height,width,g)
+    { }
+    // Create a split copy of A (with the same alignments)
+    SplitDistMatrix( const DistMatrix<Complex<R>,U,V>& A )
+    : real_(A.Grid()), imag_(A.Grid())
+    { Split( A ); }
+
+    int Height() const { return real_.Height(); }
+    int Width() const { return real_.Width(); }
+    int LocalHeight() const { return real_.LocalHeight(); }
+    int LocalWidth() const { return real_.LocalWidth(); }
+    const elem::Grid& Grid() const { return real_.Grid(); }
+    int ColAlignment() const { return real_.ColAlignment(); }
+    int RowAlignment() const { return real_.RowAlignment(); }
+    int ColShift() const { return real_.ColShift(); }
+    int RowShift() const { return real_.RowShift(); }
+    elem::DistData<int> DistData() const { return real_.DistData(); }
+    bool Viewing() const { return real_.Viewing(); }
+    bool Locked() const { return real_.Locked(); }
+
+    DistMatrix<R,U,V>& Real() { return real_; }
+    DistMatrix<R,U,V>& Imag() { return imag_; }
+    const DistMatrix<R,U,V>& LockedReal() const { return real_; }
+    const DistMatrix<R,U,V>& LockedImag() const { return imag_; }
+
+    // Collective
+    Complex<R> Get( int i, int j ) const
+    { return Complex<R>(real_.Get(i,j),imag_.Get(i,j)); }
+    void Set( int i, int j, Complex<R> alpha )
+    { real_.Set(i,j,alpha.real); imag_.Set(i,j,alpha.imag); }
+    void Update( int i, int j, Complex<R> alpha )
+    { real_.Update(i,j,alpha.real); imag_.Update(i,j,alpha.imag); }
+
+    // Local
+    Complex<R> GetLocal( int iLocal, int jLocal ) const
+    {
+        return Complex<R>
+        (real_.GetLocal(iLocal,jLocal),imag_.GetLocal(iLocal,jLocal));
+    }
+    void SetLocal( int iLocal, int jLocal, Complex<R> alpha )
+    {
+        real_.SetLocal(iLocal,jLocal,alpha.real);
+        imag_.SetLocal(iLocal,jLocal,alpha.imag);
+    }
+    void UpdateLocal( int iLocal, int jLocal, Complex<R> alpha )
+    {
+        real_.UpdateLocal(iLocal,jLocal,alpha.real);
+        imag_.UpdateLocal(iLocal,jLocal,alpha.imag);
+    }
+
+    void AlignWith( const elem::DistData<int>& data )
+    { real_.AlignWith( data ); imag_.AlignWith( data ); }
+    void ResizeTo( int height, int width )
+    { real_.ResizeTo( height, width ); imag_.ResizeTo( height, width ); }
+    void Empty()
+    { real_.Empty(); imag_.Empty(); }
+
+    // Overwrite this matrix with the entries of the interleaved matrix A,
+    // adopting its grid and alignments unless this matrix is a view
+    void Split( const DistMatrix<Complex<R>,U,V>& A );
+    // Overwrite the interleaved matrix A with the entries of this matrix,
+    // which A is realigned with unless it is a view
+    void Merge( DistMatrix<Complex<R>,U,V>& A ) const;
+
+private:
+    DistMatrix<R,U,V> real_, imag_;
+};
+
+//
+// Conversion kernels
+//
+
+// Copy the interleaved m x n matrix A into the real matrices ARe and AIm
+template<typename R>
+inline void
+SplitKernel
+( int m, int n, const Complex<R>* A, int ldim,
+  R* ARe, int realLDim, R* AIm, int imagLDim )
+{
+    const R* AData = reinterpret_cast<const R*>(A);
+    InterleaveMatrix( m, n, &AData[0], 2, 2*ldim, ARe, 1, realLDim );
+    InterleaveMatrix( m, n, &AData[1], 2, 2*ldim, AIm, 1, imagLDim );
+}
+
+// Copy the real matrices ARe and AIm into the interleaved m x n matrix A
+template<typename R>
+inline void
+MergeKernel
+( int m, int n, const R* ARe, int realLDim, const R* AIm, int imagLDim,
+  Complex<R>* A, int ldim )
+{
+    R* AData = reinterpret_cast<R*>(A);
+    InterleaveMatrix( m, n, ARe, 1, realLDim, &AData[0], 2, 2*ldim );
+    InterleaveMatrix( m, n, AIm, 1, imagLDim, &AData[1], 2, 2*ldim );
+}
+
+template<typename R>
+inline void
+SplitMatrix<R>::Split( const Matrix<Complex<R> >& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SplitMatrix::Split");
+    if( Viewing() && (A.Height() != Height() || A.Width() != Width()) )
+        throw std::logic_error("Cannot resize a split view");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    if( !Viewing() )
+        ResizeTo( m, n );
+    SplitKernel
+    ( m, n, A.LockedBuffer(), A.LDim(),
+      real_.Buffer(), real_.LDim(), imag_.Buffer(), imag_.LDim() );
+}
+
+template<typename R>
+inline void
+SplitMatrix<R>::Merge( Matrix<Complex<R> >& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("SplitMatrix::Merge");
+    if( A.Viewing() && (A.Height() != Height() || A.Width() != Width()) )
+        throw std::logic_error("Cannot resize a view");
+#endif
+    const int m = Height();
+    const int n = Width();
+    if( !A.Viewing() )
+        A.ResizeTo( m, n );
+    MergeKernel
+    ( m, n, real_.LockedBuffer(), real_.LDim(),
+      imag_.LockedBuffer(), imag_.LDim(), A.Buffer(), A.LDim() );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+SplitDistMatrix<R,U,V>::Split( const DistMatrix<Complex<R>,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SplitDistMatrix::Split");
+#endif
+    if( Viewing() )
+    {
+        if( A.Height() != Height() || A.Width() != Width() ||
+            A.ColAlignment() != ColAlignment() ||
+            A.RowAlignment() != RowAlignment() || A.Grid() != Grid() )
+            throw std::logic_error
+            ("A split view must match the size and alignments of A");
+    }
+    else
+    {
+        if( A.Grid() != Grid() )
+        {
+            real_.SetGrid( A.Grid() );
+            imag_.SetGrid( A.Grid() );
+        }
+        Empty();
+        AlignWith( A.DistData() );
+        ResizeTo( A.Height(), A.Width() );
+    }
+    SplitKernel
+    ( A.LocalHeight(), A.LocalWidth(), A.LockedBuffer(), A.LDim(),
+      real_.Buffer(), real_.LDim(),
+      imag_.Buffer(), imag_.LDim() );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+SplitDistMatrix<R,U,V>::Merge( DistMatrix<Complex<R>,U,V>& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("SplitDistMatrix::Merge");
+#endif
+    if( A.Viewing() )
+    {
+        if( A.Height() != Height() || A.Width() != Width() ||
+            A.ColAlignment() != ColAlignment() ||
+            A.RowAlignment() != RowAlignment() || A.Grid() != Grid() )
+            throw std::logic_error
+            ("A view must match the size and alignments of the split matrix");
+    }
+    else
+    {
+        if( A.Grid() != Grid() )
+            A.SetGrid( Grid() );
+        A.Empty();
+        A.AlignWith( DistData() );
+        A.ResizeTo( Height(), Width() );
+    }
+    MergeKernel
+    ( LocalHeight(), LocalWidth(),
+      real_.LockedBuffer(), real_.LDim(),
+      imag_.LockedBuffer(), imag_.LDim(),
+      A.Buffer(), A.LDim() );
+}
+
+//
+// Views (none of which copy any data)
+//
+
+// A := ARe + i AIm
+template<typename R>
+inline void
+View( SplitMatrix<R>& A, Matrix<R>& ARe, Matrix<R>& AIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("View");
+    if( ARe.Height() != AIm.Height() || ARe.Width() != AIm.Width() )
+        throw std::logic_error("Real and imaginary parts must be conformal");
+#endif
+    View( A.Real(), ARe );
+    View( A.Imag(), AIm );
+}
+
+template<typename R>
+inline void
+LockedView( SplitMatrix<R>& A, const Matrix<R>& ARe, const Matrix<R>& AIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LockedView");
+    if( ARe.Height() != AIm.Height() || ARe.Width() != AIm.Width() )
+        throw std::logic_error("Real and imaginary parts must be conformal");
+#endif
+    LockedView( A.Real(), ARe );
+    LockedView( A.Imag(), AIm );
+}
+
+template<typename R>
+inline void
+View
+( SplitMatrix<R>& A, SplitMatrix<R>& B, int i, int j, int height, int width )
+{
+#ifndef RELEASE
+    CallStackEntry entry("View");
+#endif
+    View( A.Real(), B.Real(), i, j, height, width );
+    View( A.Imag(), B.Imag(), i, j, height, width );
+}
+
+template<typename R>
+inline void
+LockedView
+( SplitMatrix<R>& A, const SplitMatrix<R>& B,
+  int i, int j, int height, int width )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LockedView");
+#endif
+    LockedView( A.Real(), B.LockedReal(), i, j, height, width );
+    LockedView( A.Imag(), B.LockedImag(), i, j, height, width );
+}
+
+// A := ARe + i AIm, where ARe and AIm must be aligned
+template<typename R,Distribution U,Distribution V>
+inline void
+View
+( SplitDistMatrix<R,U,V>& A, DistMatrix<R,U,V>& ARe, DistMatrix<R,U,V>& AIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("View");
+    if( ARe.Height() != AIm.Height() || ARe.Width() != AIm.Width() )
+        throw std::logic_error("Real and imaginary parts must be conformal");
+    if( ARe.ColAlignment() != AIm.ColAlignment() ||
+        ARe.RowAlignment() != AIm.RowAlignment() )
+        throw std::logic_error("Real and imaginary parts must be aligned");
+#endif
+    View( A.Real(), ARe );
+    View( A.Imag(), AIm );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+LockedView
+( SplitDistMatrix<R,U,V>& A,
+  const DistMatrix<R,U,V>& ARe, const DistMatrix<R,U,V>& AIm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LockedView");
+    if( ARe.Height() != AIm.Height() || ARe.Width() != AIm.Width() )
+        throw std::logic_error("Real and imaginary parts must be conformal");
+    if( ARe.ColAlignment() != AIm.ColAlignment() ||
+        ARe.RowAlignment() != AIm.RowAlignment() )
+        throw std::logic_error("Real and imaginary parts must be aligned");
+#endif
+    LockedView( A.Real(), ARe );
+    LockedView( A.Imag(), AIm );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+View
+( SplitDistMatrix<R,U,V>& A, SplitDistMatrix<R,U,V>& B,
+  int i, int j, int height, int width )
+{
+#ifndef RELEASE
+    CallStackEntry entry("View");
+#endif
+    View( A.Real(), B.Real(), i, j, height, width );
+    View( A.Imag(), B.Imag(), i, j, height, width );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline void
+LockedView
+( SplitDistMatrix<R,U,V>& A, const SplitDistMatrix<R,U,V>& B,
+  int i, int j, int height, int width )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LockedView");
+#endif
+    LockedView( A.Real(), B.LockedReal(), i, j, height, width );
+    LockedView( A.Imag(), B.LockedImag(), i, j, height, width );
+}
+
+// ALocal := the local data of A
+template<typename R,Distribution U,Distribution V>
+inline void
+LocalView( SplitMatrix<R>& ALocal, SplitDistMatrix<R,U,V>& A )
+{ View( ALocal, A.Real().Matrix(), A.Imag().Matrix() ); }
+
+template<typename R,Distribution U,Distribution V>
+inline void
+LockedLocalView( SplitMatrix<R>& ALocal, const SplitDistMatrix<R,U,V>& A )
+{
+    LockedView
+    ( ALocal, A.LockedReal().LockedMatrix(), A.LockedImag().LockedMatrix() );
+}
+
+} // namespace elem
+
+#endif // ifndef CORE_SPLITMATRIX_HPP
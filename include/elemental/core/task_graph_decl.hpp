@@ -0,0 +1,93 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef CORE_TASK_GRAPH_DECL_HPP
+#define CORE_TASK_GRAPH_DECL_HPP
+
+namespace elem {
+
+// A unit of work within a TaskGraph, e.g., a BLAS call on a few tiles
+class Task
+{
+public:
+    virtual ~Task() { }
+    virtual void Run() = 0;
+};
+
+// A directed acyclic graph of tasks whose edges are inferred from the
+// (integer) handles that each task reads and writes, in the manner of a
+// superscalar processor: tasks are added in a valid sequential order, and each
+// task is made to wait on the last task to write any of its handles, as well
+// as, for the handles it writes, on every task which has read them since.
+//
+// Execute() then runs the tasks with all of the available OpenMP threads,
+// where each task that becomes ready is handed to the OpenMP runtime as an
+// explicit task, which then runs the highest-priority task whose dependencies
+// are satisfied. Idle threads therefore wait within the runtime rather than
+// polling for work. Giving the tasks along the critical path (e.g.,
+// the panel factorizations) the highest priorities yields look-ahead. Without
+// OpenMP, or within an existing parallel region, the tasks are simply run in
+// the order in which they were added.
+class TaskGraph
+{
+public:
+    TaskGraph();
+    ~TaskGraph();
+
+    // Take ownership of 'task', which should then have its accesses described
+    // by calls to Reads and Writes.
+    void Add( Task* task, int priority=0 );
+    void Reads( int handle );
+    void Writes( int handle );
+
+    int NumTasks() const;
+
+    // Run and then delete all of the tasks. If a task throws an exception,
+    // no further tasks are started, and the exception is rethrown (as a
+    // NonHPDMatrixException, SingularMatrixException, std::logic_error, or
+    // std::runtime_error).
+    void Execute();
+
+    // The number of threads which Execute() would make use of
+    static int NumThreads();
+
+private:
+    std::vector<Task*> tasks_;
+    std::vector<int> priorities_, numDependencies_;
+    std::vector<std::vector<int> > successors_;
+    std::map<int,int> lastWriter_;
+    std::map<int,std::vector<int> > readers_;
+
+    struct ExecutionState;
+
+    void AddDependency( int before, int after );
+    void RunNextReadyTask( ExecutionState* state );
+    void Clear();
+
+    // Disallow copies, since the tasks are owned by the graph
+    TaskGraph( const TaskGraph& );
+    const TaskGraph& operator=( const TaskGraph& );
+};
+
+// The boundaries of a partition of [0,n) into tiles of (at most) the given
+// size, with an additional boundary at 'split' (if 0 < split < n), so that
+// the leading min(m,n) x min(m,n) submatrix of an m x n matrix can be tiled
+// with square diagonal tiles.
+void TileOffsets
+( int n, int tileSize, std::vector<int>& offsets, int split=-1 );
+
+// Whether a sequential factorization whose diagonal has length n should be
+// run as a task graph: there must be more than one thread available and at
+// least two diagonal tiles per thread, as otherwise the threads would mostly
+// wait on the panels and the recursive algorithms are faster.
+bool UseTaskGraph( int n );
+
+} // namespace elem
+
+#endif // ifndef CORE_TASK_GRAPH_DECL_HPP
@@ -72,6 +72,26 @@ enum GridOrder
 }
 using namespace grid_order_wrapper;
 
+namespace huge_page_policy_wrapper {
+enum HugePagePolicy
+{
+    NO_HUGE_PAGES,          // Only use the default page size
+    TRANSPARENT_HUGE_PAGES, // Align to 2 MB and advise the kernel to use THP
+    EXPLICIT_HUGE_PAGES     // Map from the reserved 2 MB pages (hugetlbfs)
+};
+}
+using namespace huge_page_policy_wrapper;
+
+namespace complex_gemm_algorithm_wrapper {
+enum ComplexGemmAlgorithm
+{
+    GEMM_3M, // Three real products (the imaginary part is slightly less
+             // accurate, in the componentwise sense)
+    GEMM_4M  // Four real products
+};
+}
+using namespace complex_gemm_algorithm_wrapper;
+
 namespace left_or_right_wrapper {
 enum LeftOrRight
 {
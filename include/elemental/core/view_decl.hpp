@@ -30,6 +30,19 @@ template<typename T,Distribution U,Distribution V,typename Int>
 void LockedView
 ( DistMatrix<T,U,V,Int>& A, const DistMatrix<T,U,V,Int>& B );
 
+//
+// Viewing a full matrix through a coinciding distribution
+//
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+bool AliasView
+( DistMatrix<T,U,V,Int>& A, DistMatrix<T,W,Z,Int>& B );
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+bool LockedAliasView
+( DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B );
+
 //
 // Viewing a submatrix
 //
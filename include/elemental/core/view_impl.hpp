@@ -116,6 +116,82 @@ inline void LockedView
     }
 }
 
+// If the [U,V] distribution coincides with the distribution of B for B's grid
+// and alignments (see DistributionsCoincide), then A becomes a view of B and
+// true is returned. Otherwise, A is left unmodified and false is returned.
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+inline bool
+AliasView( DistMatrix<T,U,V,Int>& A, DistMatrix<T,W,Z,Int>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("AliasView");
+#endif
+    const DistData<Int> BData = B.DistData();
+    DistData<Int> AData = BData;
+    AData.colDist = U;
+    AData.rowDist = V;
+    if( !DistributionsCoincide( AData, BData ) )
+        return false;
+
+    A.Empty();
+    A.grid_ = B.grid_;
+    A.height_ = B.Height();
+    A.width_ = B.Width();
+    A.colAlignment_ = B.ColAlignment();
+    A.rowAlignment_ = B.RowAlignment();
+    A.viewing_ = true;
+    if( A.Participating() )
+    {
+        A.colShift_ = B.ColShift();
+        A.rowShift_ = B.RowShift();
+        View( A.Matrix(), B.Matrix() );
+    }
+    else
+    {
+        A.colShift_ = 0;
+        A.rowShift_ = 0;
+    }
+    return true;
+}
+
+template<typename T,Distribution U,Distribution V,
+                    Distribution W,Distribution Z,typename Int>
+inline bool
+LockedAliasView( DistMatrix<T,U,V,Int>& A, const DistMatrix<T,W,Z,Int>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LockedAliasView");
+#endif
+    const DistData<Int> BData = B.DistData();
+    DistData<Int> AData = BData;
+    AData.colDist = U;
+    AData.rowDist = V;
+    if( !DistributionsCoincide( AData, BData ) )
+        return false;
+
+    A.Empty();
+    A.grid_ = B.grid_;
+    A.height_ = B.Height();
+    A.width_ = B.Width();
+    A.colAlignment_ = B.ColAlignment();
+    A.rowAlignment_ = B.RowAlignment();
+    A.viewing_ = true;
+    A.locked_ = true;
+    if( A.Participating() )
+    {
+        A.colShift_ = B.ColShift();
+        A.rowShift_ = B.RowShift();
+        LockedView( A.Matrix(), B.LockedMatrix() );
+    }
+    else
+    {
+        A.colShift_ = 0;
+        A.rowShift_ = 0;
+    }
+    return true;
+}
+
 template<typename T,typename Int>
 inline void View
 ( Matrix<T,Int>& A, Matrix<T,Int>& B,
@@ -20,6 +20,9 @@ void LocalCholesky( UpperOrLower uplo, DistMatrix<F,STAR,STAR>& A );
 #include "./Cholesky/LVar3Square.hpp"
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Square.hpp"
+#include "./Cholesky/Packed.hpp"
+#include "./Cholesky/Recursive.hpp"
+#include "./Cholesky/Tiled.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 namespace elem {
@@ -43,10 +46,21 @@ Cholesky( UpperOrLower uplo, Matrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error("A must be square");
 #endif
+    const bool tiled = UseTaskGraph( A.Height() );
     if( uplo == LOWER )
-        cholesky::LVar3( A );
+    {
+        if( tiled )
+            cholesky::LTiled( A );
+        else
+            cholesky::LRecursive( A );
+    }
     else
-        cholesky::UVar3( A );
+    {
+        if( tiled )
+            cholesky::UTiled( A );
+        else
+            cholesky::URecursive( A );
+    }
 }
 
 template<typename F> 
@@ -74,6 +88,20 @@ Cholesky( UpperOrLower uplo, DistMatrix<F>& A )
     }
 }
 
+// Overwrite the stored triangle of A with its Cholesky factor
+template<typename F>
+inline void
+Cholesky( PackedDistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Cholesky");
+#endif
+    if( A.Uplo() == LOWER )
+        cholesky::LVar3Packed( A );
+    else
+        cholesky::UVar3Packed( A );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_CHOLESKY_HPP
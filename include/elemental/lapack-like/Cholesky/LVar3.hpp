@@ -39,12 +39,18 @@ LVar3Unb( Matrix<F>& A )
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
 
+        const R alphaInv = R(1)/alpha;
+        F* RESTRICT a21 = &ABuffer[j*lda];
         for( int k=j+1; k<n; ++k )
-            ABuffer[k+j*lda] /= alpha;
+            a21[k] *= alphaInv;
 
         for( int k=j+1; k<n; ++k )
+        {
+            const F beta = Conj(a21[k]);
+            F* RESTRICT ACol = &ABuffer[k*lda];
             for( int i=k; i<n; ++i )
-                ABuffer[i+k*lda] -= ABuffer[i+j*lda]*Conj(ABuffer[k+j*lda]);
+                ACol[i] -= a21[i]*beta;
+        }
     }
 }
 
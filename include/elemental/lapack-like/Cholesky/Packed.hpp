@@ -0,0 +1,147 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_PACKED_HPP
+#define LAPACK_CHOLESKY_PACKED_HPP
+
+#include "elemental/blas-like/level3/PackedTrrk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+
+// Right-looking Cholesky factorizations of packed matrices which follow
+// LVar3 and UVar3, but which only store (and only update) the referenced
+// triangle. The panel is extracted into full storage with GetBlock, and the
+// trailing update is performed in place on a view of the packed matrix.
+
+namespace elem {
+namespace cholesky {
+
+template<typename F>
+inline void
+LVar3Packed( PackedDistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LVar3Packed");
+    if( A.Uplo() != LOWER )
+        throw std::logic_error("A must store its lower triangle");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    PackedDistMatrix<F> A22(g);
+
+    // Temporary matrices
+    DistMatrix<F> A11(g), A21(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    DistMatrix<F,STAR,MC  > A21Trans_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A21Adj_STAR_MR(g);
+
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        const int nRest = n-k-nb;
+        A22.AttachDiagonalBlock( A, k+nb, nRest );
+        A.GetBlock( k, k, nb, nb, A11 );
+        A.GetBlock( k+nb, k, nRest, nb, A21 );
+
+        A21_VR_STAR.AlignWith( A22.DistData() );
+        A21_VC_STAR.AlignWith( A22.DistData() );
+        A21Trans_STAR_MC.AlignWith( A22.DistData() );
+        A21Adj_STAR_MR.AlignWith( A22.DistData() );
+        //--------------------------------------------------------------------//
+        A11_STAR_STAR = A11;
+        LocalCholesky( LOWER, A11_STAR_STAR );
+        A.SetBlock( k, k, A11_STAR_STAR );
+
+        A21_VC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+        A21_VR_STAR = A21_VC_STAR;
+        A21Trans_STAR_MC.TransposeFrom( A21_VC_STAR );
+        A21Adj_STAR_MR.AdjointFrom( A21_VR_STAR );
+
+        // (A21^T[* ,MC])^T A21^H[* ,MR] = (A21 A21^H)[MC,MR]
+        LocalTrrk
+        ( TRANSPOSE, F(-1), A21Trans_STAR_MC, A21Adj_STAR_MR, F(1), A22 );
+
+        A21.TransposeFrom( A21Trans_STAR_MC );
+        A.SetBlock( k+nb, k, A21 );
+        //--------------------------------------------------------------------//
+        A21_VR_STAR.FreeAlignments();
+        A21_VC_STAR.FreeAlignments();
+        A21Trans_STAR_MC.FreeAlignments();
+        A21Adj_STAR_MR.FreeAlignments();
+    }
+}
+
+template<typename F>
+inline void
+UVar3Packed( PackedDistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::UVar3Packed");
+    if( A.Uplo() != UPPER )
+        throw std::logic_error("A must store its upper triangle");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const int bsize = Blocksize();
+
+    // Matrix views
+    PackedDistMatrix<F> A22(g);
+
+    // Temporary matrices
+    DistMatrix<F> A11(g), A12(g);
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MC  > A12_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+
+    for( int k=0; k<n; k+=bsize )
+    {
+        const int nb = std::min(bsize,n-k);
+        const int nRest = n-k-nb;
+        A22.AttachDiagonalBlock( A, k+nb, nRest );
+        A.GetBlock( k, k, nb, nb, A11 );
+        A.GetBlock( k, k+nb, nb, nRest, A12 );
+
+        A12_STAR_MC.AlignWith( A22.DistData() );
+        A12_STAR_MR.AlignWith( A22.DistData() );
+        A12_STAR_VR.AlignWith( A22.DistData() );
+        //--------------------------------------------------------------------//
+        A11_STAR_STAR = A11;
+        LocalCholesky( UPPER, A11_STAR_STAR );
+        A.SetBlock( k, k, A11_STAR_STAR );
+
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MC = A12_STAR_VR;
+        A12_STAR_MR = A12_STAR_VR;
+        LocalTrrk
+        ( ADJOINT, F(-1), A12_STAR_MC, A12_STAR_MR, F(1), A22 );
+
+        A12 = A12_STAR_MR;
+        A.SetBlock( k, k+nb, A12 );
+        //--------------------------------------------------------------------//
+        A12_STAR_MC.FreeAlignments();
+        A12_STAR_MR.FreeAlignments();
+        A12_STAR_VR.FreeAlignments();
+    }
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_PACKED_HPP
@@ -0,0 +1,96 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_RECURSIVE_HPP
+#define LAPACK_CHOLESKY_RECURSIVE_HPP
+
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/Cholesky/LVar3.hpp"
+#include "elemental/lapack-like/Cholesky/UVar3.hpp"
+
+//
+// Cache-oblivious Cholesky factorizations which split the matrix in half,
+//
+//     A = | A11 A12 |,  where A11 is floor(n/2) x floor(n/2),
+//         | A21 A22 |
+//
+// factor A11 recursively, update the off-diagonal block and the trailing
+// matrix with a single Trsm and Herk, and then recurse on A22. Unlike the
+// blocked variants, nearly all of the work is within large level 3 BLAS
+// calls, regardless of Blocksize(), and the unblocked kernel is only used on
+// blocks small enough to fit in the L1 cache.
+//
+
+namespace elem {
+namespace cholesky {
+
+// The largest matrix which is directly factored with the unblocked kernel
+const int RECURSIVE_CUTOFF = 32;
+
+template<typename F>
+inline void
+LRecursive( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LRecursive");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    const int n = A.Height();
+    if( n <= RECURSIVE_CUTOFF )
+    {
+        LVar3Unb( A );
+        return;
+    }
+    const int n1 = n/2;
+    Matrix<F> A11, A21, A22;
+    View( A11, A, 0,  0,  n1,   n1   );
+    View( A21, A, n1, 0,  n-n1, n1   );
+    View( A22, A, n1, n1, n-n1, n-n1 );
+
+    LRecursive( A11 );
+    Trsm( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11, A21 );
+    Herk( LOWER, NORMAL, F(-1), A21, F(1), A22 );
+    LRecursive( A22 );
+}
+
+template<typename F>
+inline void
+URecursive( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::URecursive");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    const int n = A.Height();
+    if( n <= RECURSIVE_CUTOFF )
+    {
+        UVar3Unb( A );
+        return;
+    }
+    const int n1 = n/2;
+    Matrix<F> A11, A12, A22;
+    View( A11, A, 0,  0,  n1,   n1   );
+    View( A12, A, 0,  n1, n1,   n-n1 );
+    View( A22, A, n1, n1, n-n1, n-n1 );
+
+    URecursive( A11 );
+    Trsm( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11, A12 );
+    Herk( UPPER, ADJOINT, F(-1), A12, F(1), A22 );
+    URecursive( A22 );
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_RECURSIVE_HPP
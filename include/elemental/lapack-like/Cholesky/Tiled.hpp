@@ -0,0 +1,180 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CHOLESKY_TILED_HPP
+#define LAPACK_CHOLESKY_TILED_HPP
+
+#include "elemental/blas-like/level3/Tasks.hpp"
+#include "elemental/lapack-like/Cholesky/Recursive.hpp"
+
+//
+// Tiled Cholesky factorizations which express the right-looking algorithm
+// over TileSize() x TileSize() tiles as a TaskGraph, so that the
+// factorization of each diagonal tile overlaps with the trailing updates of
+// the previous steps rather than leaving all but one thread idle.
+//
+
+namespace elem {
+namespace cholesky {
+
+template<typename F>
+class RecursiveTask : public Task
+{
+public:
+    RecursiveTask( UpperOrLower uplo, Matrix<F>& A )
+    : uplo_(uplo)
+    { View( A_, A ); }
+
+    void Run()
+    {
+        if( uplo_ == LOWER )
+            LRecursive( A_ );
+        else
+            URecursive( A_ );
+    }
+
+private:
+    UpperOrLower uplo_;
+    Matrix<F> A_;
+};
+
+template<typename F>
+inline void
+LTiled( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::LTiled");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    std::vector<int> offsets;
+    TileOffsets( A.Height(), TileSize(), offsets );
+    const int numTiles = offsets.size()-1;
+
+    // Tasks from earlier steps, and those on the critical path within each
+    // step, take precedence
+    TaskGraph graph;
+    Matrix<F> Akk, Aik, Ajk, Aij;
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int priority = 3*(numTiles-k);
+        ViewTile( Akk, A, offsets, offsets, k, k );
+        graph.Add( new RecursiveTask<F>( LOWER, Akk ), priority+2 );
+        graph.Writes( k+k*numTiles );
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            ViewTile( Aik, A, offsets, offsets, i, k );
+            graph.Add
+            ( new TrsmTask<F>
+              ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), Akk, Aik ),
+              priority+1 );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( i+k*numTiles );
+        }
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            ViewTile( Ajk, A, offsets, offsets, j, k );
+            for( int i=j; i<numTiles; ++i )
+            {
+                ViewTile( Aij, A, offsets, offsets, i, j );
+                const int updatePriority = ( j == k+1 ? priority+1 : priority );
+                if( i == j )
+                {
+                    graph.Add
+                    ( new HerkTask<F>( LOWER, NORMAL, F(-1), Ajk, F(1), Aij ),
+                      updatePriority );
+                }
+                else
+                {
+                    ViewTile( Aik, A, offsets, offsets, i, k );
+                    graph.Add
+                    ( new GemmTask<F>
+                      ( NORMAL, ADJOINT, F(-1), Aik, Ajk, F(1), Aij ),
+                      updatePriority );
+                    graph.Reads( i+k*numTiles );
+                }
+                graph.Reads( j+k*numTiles );
+                graph.Writes( i+j*numTiles );
+            }
+        }
+    }
+    graph.Execute();
+}
+
+template<typename F>
+inline void
+UTiled( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cholesky::UTiled");
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Can only compute Cholesky factor of square matrices");
+#endif
+    std::vector<int> offsets;
+    TileOffsets( A.Height(), TileSize(), offsets );
+    const int numTiles = offsets.size()-1;
+
+    TaskGraph graph;
+    Matrix<F> Akk, Aki, Akj, Aij;
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int priority = 3*(numTiles-k);
+        ViewTile( Akk, A, offsets, offsets, k, k );
+        graph.Add( new RecursiveTask<F>( UPPER, Akk ), priority+2 );
+        graph.Writes( k+k*numTiles );
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            ViewTile( Akj, A, offsets, offsets, k, j );
+            graph.Add
+            ( new TrsmTask<F>
+              ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), Akk, Akj ),
+              priority+1 );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( k+j*numTiles );
+        }
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            ViewTile( Aki, A, offsets, offsets, k, i );
+            for( int j=i; j<numTiles; ++j )
+            {
+                ViewTile( Aij, A, offsets, offsets, i, j );
+                const int updatePriority = ( i == k+1 ? priority+1 : priority );
+                if( i == j )
+                {
+                    graph.Add
+                    ( new HerkTask<F>( UPPER, ADJOINT, F(-1), Aki, F(1), Aij ),
+                      updatePriority );
+                }
+                else
+                {
+                    ViewTile( Akj, A, offsets, offsets, k, j );
+                    graph.Add
+                    ( new GemmTask<F>
+                      ( ADJOINT, NORMAL, F(-1), Aki, Akj, F(1), Aij ),
+                      updatePriority );
+                    graph.Reads( k+j*numTiles );
+                }
+                graph.Reads( k+i*numTiles );
+                graph.Writes( i+j*numTiles );
+            }
+        }
+    }
+    graph.Execute();
+}
+
+} // namespace cholesky
+} // namespace elem
+
+#endif // ifndef LAPACK_CHOLESKY_TILED_HPP
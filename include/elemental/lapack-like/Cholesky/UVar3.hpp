@@ -31,6 +31,9 @@ UVar3Unb( Matrix<F>& A )
     const int n = A.Height();
     const int lda = A.LDim();
     F* ABuffer = A.Buffer();
+    // The conjugated row of U is kept contiguous so that the trailing 
+    // update runs down the columns of A
+    std::vector<F> a12Conj( n );
     for( int j=0; j<n; ++j )
     {
         R alpha = RealPart(ABuffer[j+j*lda]);
@@ -39,12 +42,21 @@ UVar3Unb( Matrix<F>& A )
         alpha = Sqrt( alpha );
         ABuffer[j+j*lda] = alpha;
         
+        const R alphaInv = R(1)/alpha;
         for( int k=j+1; k<n; ++k )
-            ABuffer[j+k*lda] /= alpha;
+        {
+            ABuffer[j+k*lda] *= alphaInv;
+            a12Conj[k] = Conj(ABuffer[j+k*lda]);
+        }
 
         for( int k=j+1; k<n; ++k )
+        {
+            const F beta = ABuffer[j+k*lda];
+            F* RESTRICT ACol = &ABuffer[k*lda];
+            const F* RESTRICT w = &a12Conj[0];
             for( int i=j+1; i<=k; ++i )
-                ABuffer[i+k*lda] -= Conj(ABuffer[j+i*lda])*ABuffer[j+k*lda];
+                ACol[i] -= w[i]*beta;
+        }
     }
 }
 
@@ -0,0 +1,278 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_CONDITIONESTIMATE_HPP
+#define LAPACK_CONDITIONESTIMATE_HPP
+
+#include "elemental/lapack-like/Cholesky/SolveAfter.hpp"
+#include "elemental/lapack-like/LU/SolveAfter.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/lapack-like/Norm/TwoEstimate.hpp"
+
+//
+// One-norm condition number estimates, kappa_1(A) = ||A||_1 ||inv(A)||_1,
+// which reuse an existing LU or Cholesky factorization of A, so that
+// ||inv(A)||_1 is estimated with a handful of triangular solves against
+// single vectors instead of forming the inverse or computing an SVD.
+//
+// ||inv(A)||_1 is estimated with Hager's method, as refined by Higham
+// ("FORTRAN codes for estimating the one-norm of a real or complex matrix,
+// with applications to condition estimation", which is the basis of LAPACK's
+// xLACON): a convex function is maximized over the unit one-norm ball by
+// alternating solves with A and A^H, which usually converges in two or three
+// steps. The result is a lower bound on ||inv(A)||_1 which is almost always
+// within a factor of three of it.
+//
+// Since the solves only involve single vectors, they are performed on
+// vectors which are replicated over the process grid.
+//
+
+namespace elem {
+namespace cond_est {
+
+template<typename F>
+inline void
+LUSolve
+( Orientation orientation, const Matrix<F>& A, const Matrix<int>& p,
+  Matrix<F>& x )
+{ lu::SolveAfter( orientation, A, p, x ); }
+
+template<typename F>
+inline void
+LUSolve
+( Orientation orientation, const DistMatrix<F>& A,
+  const DistMatrix<int,VC,STAR>& p, Matrix<F>& x )
+{
+    DistMatrix<F,STAR,STAR> x_STAR_STAR( x.Height(), 1, A.Grid() );
+    x_STAR_STAR.Matrix() = x;
+    DistMatrix<F> X( A.Grid() );
+    X = x_STAR_STAR;
+    lu::SolveAfter( orientation, A, p, X );
+    x_STAR_STAR = X;
+    x = x_STAR_STAR.LockedMatrix();
+}
+
+template<typename F>
+inline void
+CholeskySolve( UpperOrLower uplo, const Matrix<F>& A, Matrix<F>& x )
+{ cholesky::SolveAfter( uplo, NORMAL, A, x ); }
+
+template<typename F>
+inline void
+CholeskySolve( UpperOrLower uplo, const DistMatrix<F>& A, Matrix<F>& x )
+{
+    DistMatrix<F,STAR,STAR> x_STAR_STAR( x.Height(), 1, A.Grid() );
+    x_STAR_STAR.Matrix() = x;
+    DistMatrix<F> X( A.Grid() );
+    X = x_STAR_STAR;
+    cholesky::SolveAfter( uplo, NORMAL, A, X );
+    x_STAR_STAR = X;
+    x = x_STAR_STAR.LockedMatrix();
+}
+
+// Applies inv(A) or inv(A)^H using the LU factorization PA = LU
+template<typename FactorType,typename PivotType>
+class LUSolver
+{
+public:
+    LUSolver( const FactorType& A, const PivotType& p ) : A_(A), p_(p) { }
+
+    template<typename F>
+    void operator()( Orientation orientation, Matrix<F>& x ) const
+    { LUSolve( orientation, A_, p_, x ); }
+
+private:
+    const FactorType& A_;
+    const PivotType& p_;
+};
+
+// Applies inv(A) = inv(A)^H using the Cholesky factorization of A
+template<typename FactorType>
+class CholeskySolver
+{
+public:
+    CholeskySolver( UpperOrLower uplo, const FactorType& A )
+    : uplo_(uplo), A_(A)
+    { }
+
+    template<typename F>
+    void operator()( Orientation orientation, Matrix<F>& x ) const
+    { CholeskySolve( uplo_, A_, x ); }
+
+private:
+    UpperOrLower uplo_;
+    const FactorType& A_;
+};
+
+template<typename F>
+inline BASE(F)
+VectorOneNorm( const Matrix<F>& x )
+{
+    BASE(F) norm = 0;
+    const int n = x.Height();
+    for( int i=0; i<n; ++i )
+        norm += Abs(x.Get(i,0));
+    return norm;
+}
+
+template<typename F>
+inline int
+VectorMaxAbsIndex( const Matrix<F>& x )
+{
+    typedef BASE(F) R;
+    const int n = x.Height();
+    int index = 0;
+    R maxAbs = -1;
+    for( int i=0; i<n; ++i )
+    {
+        const R alphaAbs = Abs(x.Get(i,0));
+        if( alphaAbs > maxAbs )
+        {
+            maxAbs = alphaAbs;
+            index = i;
+        }
+    }
+    return index;
+}
+
+// x := sign(x), where sign(alpha) = alpha/|alpha| and sign(0) = 1
+template<typename F>
+inline void
+MakeSigns( Matrix<F>& x )
+{
+    typedef BASE(F) R;
+    const int n = x.Height();
+    for( int i=0; i<n; ++i )
+    {
+        const F alpha = x.Get(i,0);
+        const R alphaAbs = Abs(alpha);
+        x.Set( i, 0, ( alphaAbs == R(0) ? F(1) : alpha/alphaAbs ) );
+    }
+}
+
+// Estimate ||inv(A)||_1 given a functor which overwrites the vector x with
+// inv(A) x or inv(A)^H x
+template<typename F,class Solver>
+inline BASE(F)
+HagerHigham( const Solver& solve, int n, int maxIts=5 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("cond_est::HagerHigham");
+#endif
+    typedef BASE(F) R;
+    if( n == 0 )
+        return R(0);
+
+    // Start with the vector which has equal entries and unit one-norm
+    Matrix<F> x( n, 1 ), z;
+    for( int i=0; i<n; ++i )
+        x.Set( i, 0, F(1)/F(n) );
+    solve( NORMAL, x );
+    R estimate = VectorOneNorm( x );
+    if( n > 1 )
+    {
+        z = x;
+        MakeSigns( z );
+        solve( ADJOINT, z );
+        int j = VectorMaxAbsIndex( z );
+        for( int it=0; it<maxIts; ++it )
+        {
+            // Move to the vertex e_j of the unit ball
+            Zeros( x, n, 1 );
+            x.Set( j, 0, F(1) );
+            solve( NORMAL, x );
+            const R lastEstimate = estimate;
+            estimate = std::max( estimate, VectorOneNorm(x) );
+            if( estimate <= lastEstimate )
+                break;
+
+            z = x;
+            MakeSigns( z );
+            solve( ADJOINT, z );
+            const int lastj = j;
+            j = VectorMaxAbsIndex( z );
+            if( Abs(z.Get(j,0)) <= Abs(z.Get(lastj,0)) )
+                break;
+        }
+    }
+
+    // Higham's alternative estimate guards against the rare cases where the
+    // above is a severe underestimate
+    for( int i=0; i<n; ++i )
+    {
+        const R sign = ( i % 2 == 0 ? R(1) : R(-1) );
+        const R ratio = ( n > 1 ? R(i)/R(n-1) : R(0) );
+        x.Set( i, 0, sign*(1+ratio) );
+    }
+    solve( NORMAL, x );
+    estimate = std::max( estimate, 2*VectorOneNorm(x)/(3*n) );
+    return estimate;
+}
+
+} // namespace cond_est
+
+// Estimate kappa_1(A) given the original matrix A and its LU factorization
+// with partial pivoting (as computed by LU( A, p ))
+template<typename F>
+inline BASE(F)
+LUConditionEstimate
+( const Matrix<F>& A, const Matrix<F>& LUFactors, const Matrix<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUConditionEstimate");
+#endif
+    cond_est::LUSolver<Matrix<F>,Matrix<int> > solve( LUFactors, p );
+    return OneNorm( A )*cond_est::HagerHigham<F>( solve, A.Height() );
+}
+
+template<typename F>
+inline BASE(F)
+LUConditionEstimate
+( const DistMatrix<F>& A, const DistMatrix<F>& LUFactors,
+  const DistMatrix<int,VC,STAR>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("LUConditionEstimate");
+#endif
+    cond_est::LUSolver<DistMatrix<F>,DistMatrix<int,VC,STAR> >
+        solve( LUFactors, p );
+    return OneNorm( A )*cond_est::HagerHigham<F>( solve, A.Height() );
+}
+
+// Estimate kappa_1(A) given the original HPD matrix A (with the 'uplo'
+// triangle referenced) and its Cholesky factor (as computed by Cholesky)
+template<typename F>
+inline BASE(F)
+HPDConditionEstimate
+( UpperOrLower uplo, const Matrix<F>& A, const Matrix<F>& cholFactor )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HPDConditionEstimate");
+#endif
+    cond_est::CholeskySolver<Matrix<F> > solve( uplo, cholFactor );
+    return HermitianOneNorm( uplo, A )*
+           cond_est::HagerHigham<F>( solve, A.Height() );
+}
+
+template<typename F>
+inline BASE(F)
+HPDConditionEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A, const DistMatrix<F>& cholFactor )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HPDConditionEstimate");
+#endif
+    cond_est::CholeskySolver<DistMatrix<F> > solve( uplo, cholFactor );
+    return HermitianOneNorm( uplo, A )*
+           cond_est::HagerHigham<F>( solve, A.Height() );
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_CONDITIONESTIMATE_HPP
@@ -15,35 +15,78 @@
 namespace elem {
 namespace hpd_determinant {
 
+// The determinant of an HPD matrix whose Cholesky factor is stored in the
+// 'uplo' triangle of A
 template<typename F>
 inline SafeProduct<F> 
-Cholesky( UpperOrLower uplo, Matrix<F>& A )
+AfterCholesky( UpperOrLower uplo, const Matrix<F>& A )
 {
 #ifndef RELEASE
-    CallStackEntry entry("hpd_determinant::Cholesky");
+    CallStackEntry entry("hpd_determinant::AfterCholesky");
 #endif
-    if( A.Height() != A.Width() )
-        throw std::logic_error
-        ("Cannot compute determinant of nonsquare matrix");
     typedef BASE(F) R;
     const int n = A.Height();
     const R scale = R(n)/R(2);
     SafeProduct<F> det( n );
 
-    try
+    Matrix<F> d;
+    A.GetDiagonal( d );
+    det.rho = F(1);
+
+    for( int i=0; i<n; ++i )
     {
-        elem::Cholesky( uplo, A );
-        
-        Matrix<F> d;
-        A.GetDiagonal( d );
-        det.rho = F(1);
+        const R delta = RealPart(d.Get(i,0));
+        det.kappa += Log(delta)/scale;
+    }
+    return det;
+}
 
-        for( int i=0; i<n; ++i )
+template<typename F> 
+inline SafeProduct<F> 
+AfterCholesky( UpperOrLower uplo, const DistMatrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpd_determinant::AfterCholesky");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R scale = R(n)/R(2);
+    SafeProduct<F> det( n );
+    const Grid& g = A.Grid();
+
+    DistMatrix<F,MD,STAR> d(g);
+    A.GetDiagonal( d );
+    R localKappa = 0; 
+    if( d.Participating() )
+    {
+        const int nLocalDiag = d.LocalHeight();
+        for( int iLocal=0; iLocal<nLocalDiag; ++iLocal )
         {
-            const R delta = RealPart(d.Get(i,0));
-            det.kappa += Log(delta)/scale;
+            const R delta = RealPart(d.GetLocal(iLocal,0));
+            localKappa += Log(delta)/scale;
         }
     }
+    mpi::AllReduce( &localKappa, &det.kappa, 1, mpi::SUM, g.VCComm() );
+    det.rho = F(1);
+    return det;
+}
+
+template<typename F>
+inline SafeProduct<F> 
+Cholesky( UpperOrLower uplo, Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpd_determinant::Cholesky");
+#endif
+    if( A.Height() != A.Width() )
+        throw std::logic_error
+        ("Cannot compute determinant of nonsquare matrix");
+    SafeProduct<F> det( A.Height() );
+    try
+    {
+        elem::Cholesky( uplo, A );
+        det = AfterCholesky( uplo, A );
+    }
     catch( NonHPDMatrixException& e )
     {
         det.rho = 0;
@@ -62,30 +105,11 @@ Cholesky( UpperOrLower uplo, DistMatrix<F>& A )
     if( A.Height() != A.Width() )
         throw std::logic_error
         ("Cannot compute determinant of nonsquare matrix");
-    typedef BASE(F) R;
-    const int n = A.Height();
-    const R scale = R(n)/R(2);
-    SafeProduct<F> det( n );
-    const Grid& g = A.Grid();
-
+    SafeProduct<F> det( A.Height() );
     try
     {
         elem::Cholesky( uplo, A );
-
-        DistMatrix<F,MD,STAR> d(g);
-        A.GetDiagonal( d );
-        R localKappa = 0; 
-        if( d.Participating() )
-        {
-            const int nLocalDiag = d.LocalHeight();
-            for( int iLocal=0; iLocal<nLocalDiag; ++iLocal )
-            {
-                const R delta = RealPart(d.GetLocal(iLocal,0));
-                localKappa += Log(delta)/scale;
-            }
-        }
-        mpi::AllReduce( &localKappa, &det.kappa, 1, mpi::SUM, g.VCComm() );
-        det.rho = F(1);
+        det = AfterCholesky( uplo, A );
     }
     catch( NonHPDMatrixException& e )
     {
@@ -0,0 +1,976 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HODLR_HPP
+#define LAPACK_HODLR_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Conjugate.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/ApplyColumnPivots.hpp"
+#include "elemental/lapack-like/ID.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/LU.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Hierarchically Off-Diagonal Low-Rank (HODLR) matrices: the index set is
+// recursively bisected until each diagonal block has at most 'leafSize'
+// rows, and, at each node of the resulting tree with children c1 and c2,
+// the off-diagonal blocks are compressed with interpolative decompositions,
+//
+//     A(c1,c2) ~= U1 V1^H and A(c2,c1) ~= U2 V2^H,
+//
+// where the columns of U1 and U2 are columns of A chosen by a rank-revealing
+// QR factorization (see ID) and the ranks are chosen so that each block is
+// reproduced to the relative tolerance 'tol' (with at most 'maxRank' columns).
+// When the off-diagonal ranks are bounded by k, storage and multiplication
+// require O(k n log n) work, rather than O(n^2).
+//
+// Factor() forms the recursive Sherman-Morrison-Woodbury representation of
+// the inverse: if D = diag(A(c1,c1),A(c2,c2)), then
+//
+//     A = D + diag(U1,U2) [0, V1^H; V2^H, 0] = D + U Vh,
+//     inv(A) = (I - Y inv(K) Vh) inv(D),
+//
+// where Y = inv(D) U and K = I + Vh Y is a small (k1+k2) x (k1+k2) matrix,
+// so that inv(A) is the product of one block-diagonal correction per level
+// of the tree with the inverses of the leaf blocks. Factorization requires
+// O(k^2 n log^2 n) work and each solve O(k n log n).
+//
+// The low-rank factors are stored in [VC,* ] matrices of height n, so that
+// each process owns the same rows of each factor and of the vectors they are
+// applied to, and only the rank-sized coefficient blocks need to be summed;
+// the small coupling matrices are replicated. Each leaf block is instead
+// stored whole on a single process, so that the rows of each leaf of the
+// input are sent to, and the result returned from, its owner with a pair of
+// AllToAlls. A multiplication thus requires two AllToAlls and a single
+// AllReduce of all of the coupling coefficients, while a solve requires two
+// AllToAlls and one AllReduce per level of the tree.
+//
+// Unlike HSS matrices, the bases of the different levels are not nested.
+//
+
+namespace elem {
+
+template<typename F>
+class HODLR
+{
+public:
+    typedef BASE(F) R;
+
+    HODLR
+    ( const DistMatrix<F>& A, R tol, int maxRank=100, int leafSize=64,
+      RRQRMethod method=RRQR_BUSINGER_GOLUB );
+
+    int Height() const;
+    int NumLevels() const;
+    int NumLeaves() const;
+    int MaxRank() const;
+    // The number of entries required to represent the matrix
+    double NumEntries() const;
+    const elem::Grid& Grid() const;
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      F alpha, const DistMatrix<F>& X, F beta, DistMatrix<F>& Y ) const;
+
+    // Form the recursive Sherman-Morrison-Woodbury factorization
+    void Factor();
+    bool Factored() const;
+
+    // B := inv(A) B
+    void Solve( DistMatrix<F>& B ) const;
+
+private:
+    struct Node
+    {
+        int offset1, size1, offset2, size2;
+        int rank1, rank2;
+        Matrix<F> K;
+        Matrix<int> pK;
+    };
+    struct Leaf
+    {
+        int offset, size;
+        // The VC rank of the process which stores the leaf block and the
+        // first row of the block within its local packing
+        int owner, localOffset;
+    };
+
+    const elem::Grid* grid_;
+    int height_, leafSize_, maxLeafSize_;
+    bool factored_;
+
+    // levels_[l] holds the nodes at depth l, whose factors are stored in
+    // columns [rankOffsets_[l],rankOffsets_[l]+rankWidths_[l]) of U_, V_,
+    // and Y_; the leaf blocks (and their inverses) owned by this process are
+    // stacked into the local matrix D_ (DInv_)
+    std::vector<std::vector<Node> > levels_;
+    std::vector<Leaf> leaves_;
+    std::vector<int> rankOffsets_, rankWidths_;
+    Matrix<F> D_, DInv_;
+    DistMatrix<F,VC,STAR> U_, V_, Y_;
+
+    // Disallow copies, since the nodes are not cheap to copy
+    HODLR( const HODLR<F>& A );
+    const HODLR<F>& operator=( const HODLR<F>& A );
+
+    void BuildTree( int offset, int size, int level );
+
+    static int Compress
+    ( const DistMatrix<F>& A, int rowOffset, int height,
+      int colOffset, int width, int maxRank, R tol, RRQRMethod method,
+      DistMatrix<F,VC,STAR>& U, DistMatrix<F,VC,STAR>& V, int colStart );
+
+    // Send the rows of each leaf of X to the owner of the leaf, which stacks
+    // them in the same manner as D_, and the reverse
+    void LeafCounts
+    ( int colAlignment, int width,
+      std::vector<int>& rowCounts, std::vector<int>& leafCounts ) const;
+    void GatherLeaves
+    ( const DistMatrix<F,VC,STAR>& X, Matrix<F>& XLeaves ) const;
+    void ScatterLeaves
+    ( const Matrix<F>& XLeaves, DistMatrix<F,VC,STAR>& X ) const;
+
+    void ApplyInverse( DistMatrix<F,VC,STAR>& X, int stopLevel ) const;
+};
+
+template<typename F>
+inline
+HODLR<F>::HODLR
+( const DistMatrix<F>& A, R tol, int maxRank, int leafSize, RRQRMethod method )
+: grid_(&A.Grid()), height_(A.Height()), leafSize_(leafSize),
+  maxLeafSize_(0), factored_(false),
+  U_(A.Grid()), V_(A.Grid()), Y_(A.Grid())
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::HODLR");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("HODLR matrices must be square");
+    if( leafSize < 1 )
+        throw std::logic_error("Leaves must have at least one row");
+    if( maxRank < 0 )
+        throw std::logic_error("Maximum rank must be non-negative");
+#endif
+    const elem::Grid& g = A.Grid();
+    const int n = height_;
+    if( n > 0 )
+        BuildTree( 0, n, 0 );
+    const int numLevels = levels_.size();
+    const int numLeaves = leaves_.size();
+
+    // Deal the leaf blocks out to the processes and pack them onto their
+    // owners
+    const int p = g.Size();
+    const int rank = g.VCRank();
+    int localLeafHeight = 0;
+    for( int j=0; j<numLeaves; ++j )
+    {
+        Leaf& leaf = leaves_[j];
+        maxLeafSize_ = std::max( maxLeafSize_, leaf.size );
+        leaf.owner = j % p;
+        leaf.localOffset = localLeafHeight;
+        if( leaf.owner == rank )
+            localLeafHeight += leaf.size;
+    }
+    {
+        DistMatrix<F,VC,STAR> D_VC_STAR(g);
+        Zeros( D_VC_STAR, n, maxLeafSize_ );
+        for( int j=0; j<numLeaves; ++j )
+        {
+            const int offset = leaves_[j].offset;
+            const int size = leaves_[j].size;
+            DistMatrix<F> ALeaf(g);
+            DistMatrix<F,VC,STAR> DLeaf(g);
+            LockedView( ALeaf, A, offset, offset, size, size );
+            View( DLeaf, D_VC_STAR, offset, 0, size, size );
+            DLeaf = ALeaf;
+        }
+        GatherLeaves( D_VC_STAR, D_ );
+    }
+
+    // Compress the off-diagonal blocks into generously-sized factors...
+    std::vector<int> maxRanks( numLevels );
+    int totalMaxRank = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        maxRanks[l] = 0;
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = levels_[l][j];
+            maxRanks[l] =
+                std::max
+                ( maxRanks[l],
+                  std::min(maxRank,std::min(node.size1,node.size2)) );
+        }
+        totalMaxRank += maxRanks[l];
+    }
+    DistMatrix<F,VC,STAR> UFull(g), VFull(g);
+    Zeros( UFull, n, totalMaxRank );
+    Zeros( VFull, n, totalMaxRank );
+    rankOffsets_.resize( numLevels );
+    rankWidths_.resize( numLevels );
+    int colStart = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        rankWidths_[l] = 0;
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+        {
+            Node& node = levels_[l][j];
+            node.rank1 =
+                Compress
+                ( A, node.offset1, node.size1, node.offset2, node.size2,
+                  maxRank, tol, method, UFull, VFull, colStart );
+            node.rank2 =
+                Compress
+                ( A, node.offset2, node.size2, node.offset1, node.size1,
+                  maxRank, tol, method, UFull, VFull, colStart );
+            rankWidths_[l] =
+                std::max( rankWidths_[l], std::max(node.rank1,node.rank2) );
+        }
+        colStart += maxRanks[l];
+    }
+
+    // ...and then pack them as tightly as the ranks allow
+    int totalRank = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        rankOffsets_[l] = totalRank;
+        totalRank += rankWidths_[l];
+    }
+    Zeros( U_, n, totalRank );
+    Zeros( V_, n, totalRank );
+    colStart = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        const int width = rankWidths_[l];
+        DistMatrix<F,VC,STAR> UOld(g), UNew(g), VOld(g), VNew(g);
+        LockedView( UOld, UFull, 0, colStart, n, width );
+        LockedView( VOld, VFull, 0, colStart, n, width );
+        View( UNew, U_, 0, rankOffsets_[l], n, width );
+        View( VNew, V_, 0, rankOffsets_[l], n, width );
+        UNew.Matrix() = UOld.LockedMatrix();
+        VNew.Matrix() = VOld.LockedMatrix();
+        colStart += maxRanks[l];
+    }
+}
+
+template<typename F>
+inline void
+HODLR<F>::BuildTree( int offset, int size, int level )
+{
+    if( size <= leafSize_ )
+    {
+        Leaf leaf;
+        leaf.offset = offset;
+        leaf.size = size;
+        leaves_.push_back( leaf );
+        return;
+    }
+    if( (int)levels_.size() <= level )
+        levels_.resize( level+1 );
+    Node node;
+    node.offset1 = offset;
+    node.size1 = size/2;
+    node.offset2 = offset + size/2;
+    node.size2 = size - size/2;
+    node.rank1 = node.rank2 = 0;
+    levels_[level].push_back( node );
+    BuildTree( node.offset1, node.size1, level+1 );
+    BuildTree( node.offset2, node.size2, level+1 );
+}
+
+// Compress A(rowOffset:rowOffset+height,colOffset:colOffset+width) into
+// U(rows,colStart:colStart+k) V(cols,colStart:colStart+k)^H, where the columns
+// of U are a subset of the columns of the block
+template<typename F>
+inline int
+HODLR<F>::Compress
+( const DistMatrix<F>& A, int rowOffset, int height,
+  int colOffset, int width, int maxRank, R tol, RRQRMethod method,
+  DistMatrix<F,VC,STAR>& U, DistMatrix<F,VC,STAR>& V, int colStart )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::Compress");
+#endif
+    const elem::Grid& g = A.Grid();
+    DistMatrix<F> ABlock(g);
+    LockedView( ABlock, A, rowOffset, colOffset, height, width );
+    DistMatrix<int,VR,STAR> p(g);
+    DistMatrix<F,STAR,VR> Z(g);
+    ID( ABlock, p, Z, std::min(maxRank,std::min(height,width)), tol, method );
+    const int rank = p.Height();
+    if( rank == 0 )
+        return 0;
+
+    // A P ~= A P(:,0:k) [I, Z], so that U := A P(:,0:k)...
+    DistMatrix<F> B(g), BL(g);
+    B = ABlock;
+    ApplyColumnPivots( B, p );
+    LockedView( BL, B, 0, 0, height, rank );
+    DistMatrix<F,VC,STAR> UBlock(g);
+    View( UBlock, U, rowOffset, colStart, height, rank );
+    UBlock = BL;
+
+    // ...and V^H := [I, Z] P^T
+    DistMatrix<F> W(g), WL(g), WR(g);
+    Zeros( W, rank, width );
+    PartitionRight( W, WL, WR, rank );
+    MakeIdentity( WL );
+    WR = Z;
+    ApplyInverseColumnPivots( W, p );
+    DistMatrix<F,VC,STAR> VBlock(g);
+    View( VBlock, V, colOffset, colStart, width, rank );
+    Adjoint( W, VBlock );
+    return rank;
+}
+
+// Count the number of entries of the rows of the leaves of a [VC,* ] matrix
+// with the given column alignment and width which this process sends to each
+// owner (rowCounts) and which this process receives, as the owner of some of
+// the leaves, from each process (leafCounts)
+template<typename F>
+inline void
+HODLR<F>::LeafCounts
+( int colAlignment, int width,
+  std::vector<int>& rowCounts, std::vector<int>& leafCounts ) const
+{
+    const int p = grid_->Size();
+    const int rank = grid_->VCRank();
+    const int numLeaves = leaves_.size();
+    rowCounts.assign( p, 0 );
+    leafCounts.assign( p, 0 );
+    for( int j=0; j<numLeaves; ++j )
+    {
+        const Leaf& leaf = leaves_[j];
+        const int leafAlignment = (leaf.offset+colAlignment) % p;
+        rowCounts[leaf.owner] +=
+            Length( leaf.size, Shift(rank,leafAlignment,p), p )*width;
+        if( leaf.owner == rank )
+            for( int q=0; q<p; ++q )
+                leafCounts[q] +=
+                    Length( leaf.size, Shift(q,leafAlignment,p), p )*width;
+    }
+}
+
+template<typename F>
+inline void
+HODLR<F>::GatherLeaves
+( const DistMatrix<F,VC,STAR>& X, Matrix<F>& XLeaves ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::GatherLeaves");
+    if( X.Height() != height_ )
+        throw std::logic_error("X is the wrong height");
+#endif
+    const int p = grid_->Size();
+    const int rank = grid_->VCRank();
+    const int width = X.Width();
+    const int colAlignment = X.ColAlignment();
+    const int colShift = X.ColShift();
+    const int numLeaves = leaves_.size();
+
+    std::vector<int> sendCounts, recvCounts;
+    LeafCounts( colAlignment, width, sendCounts, recvCounts );
+    std::vector<int> sendDispls( p ), recvDispls( p );
+    int sendSize=0, recvSize=0;
+    for( int q=0; q<p; ++q )
+    {
+        sendDispls[q] = sendSize;
+        recvDispls[q] = recvSize;
+        sendSize += sendCounts[q];
+        recvSize += recvCounts[q];
+    }
+
+    // Pack our rows of each leaf for its owner
+    std::vector<F> sendBuffer( std::max(sendSize,1) );
+    std::vector<int> offsets = sendDispls;
+    for( int j=0; j<numLeaves; ++j )
+    {
+        const Leaf& leaf = leaves_[j];
+        const int leafAlignment = (leaf.offset+colAlignment) % p;
+        const int localHeight =
+            Length( leaf.size, Shift(rank,leafAlignment,p), p );
+        const int iLocalOffset = Length( leaf.offset, colShift, p );
+        F* sendBuf = &sendBuffer[offsets[leaf.owner]];
+        for( int jLocal=0; jLocal<width; ++jLocal )
+            MemCopy
+            ( &sendBuf[jLocal*localHeight],
+              X.LockedBuffer(iLocalOffset,jLocal), localHeight );
+        offsets[leaf.owner] += localHeight*width;
+    }
+
+    std::vector<F> recvBuffer( std::max(recvSize,1) );
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], grid_->VCComm() );
+
+    // Unpack the rows of the leaves we own
+    int localLeafHeight = 0;
+    for( int j=0; j<numLeaves; ++j )
+        if( leaves_[j].owner == rank )
+            localLeafHeight += leaves_[j].size;
+    XLeaves.ResizeTo( localLeafHeight, width );
+    offsets = recvDispls;
+    for( int j=0; j<numLeaves; ++j )
+    {
+        const Leaf& leaf = leaves_[j];
+        if( leaf.owner != rank )
+            continue;
+        const int leafAlignment = (leaf.offset+colAlignment) % p;
+        for( int q=0; q<p; ++q )
+        {
+            const int leafShift = Shift( q, leafAlignment, p );
+            const int localHeight = Length( leaf.size, leafShift, p );
+            const F* recvBuf = &recvBuffer[offsets[q]];
+            for( int jLocal=0; jLocal<width; ++jLocal )
+                for( int k=0; k<localHeight; ++k )
+                    XLeaves.Set
+                    ( leaf.localOffset+leafShift+k*p, jLocal,
+                      recvBuf[k+jLocal*localHeight] );
+            offsets[q] += localHeight*width;
+        }
+    }
+}
+
+template<typename F>
+inline void
+HODLR<F>::ScatterLeaves
+( const Matrix<F>& XLeaves, DistMatrix<F,VC,STAR>& X ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::ScatterLeaves");
+    if( X.Height() != height_ || X.Width() != XLeaves.Width() )
+        throw std::logic_error("X is the wrong size");
+    if( XLeaves.Height() != D_.Height() )
+        throw std::logic_error("XLeaves is the wrong height");
+#endif
+    const int p = grid_->Size();
+    const int rank = grid_->VCRank();
+    const int width = X.Width();
+    const int colAlignment = X.ColAlignment();
+    const int colShift = X.ColShift();
+    const int numLeaves = leaves_.size();
+
+    std::vector<int> sendCounts, recvCounts;
+    LeafCounts( colAlignment, width, recvCounts, sendCounts );
+    std::vector<int> sendDispls( p ), recvDispls( p );
+    int sendSize=0, recvSize=0;
+    for( int q=0; q<p; ++q )
+    {
+        sendDispls[q] = sendSize;
+        recvDispls[q] = recvSize;
+        sendSize += sendCounts[q];
+        recvSize += recvCounts[q];
+    }
+
+    // Pack the rows of the leaves we own for the processes which own them
+    std::vector<F> sendBuffer( std::max(sendSize,1) );
+    std::vector<int> offsets = sendDispls;
+    for( int j=0; j<numLeaves; ++j )
+    {
+        const Leaf& leaf = leaves_[j];
+        if( leaf.owner != rank )
+            continue;
+        const int leafAlignment = (leaf.offset+colAlignment) % p;
+        for( int q=0; q<p; ++q )
+        {
+            const int leafShift = Shift( q, leafAlignment, p );
+            const int localHeight = Length( leaf.size, leafShift, p );
+            F* sendBuf = &sendBuffer[offsets[q]];
+            for( int jLocal=0; jLocal<width; ++jLocal )
+                for( int k=0; k<localHeight; ++k )
+                    sendBuf[k+jLocal*localHeight] =
+                        XLeaves.Get( leaf.localOffset+leafShift+k*p, jLocal );
+            offsets[q] += localHeight*width;
+        }
+    }
+
+    std::vector<F> recvBuffer( std::max(recvSize,1) );
+    mpi::AllToAll
+    ( &sendBuffer[0], &sendCounts[0], &sendDispls[0],
+      &recvBuffer[0], &recvCounts[0], &recvDispls[0], grid_->VCComm() );
+
+    // Unpack our rows of each leaf
+    offsets = recvDispls;
+    for( int j=0; j<numLeaves; ++j )
+    {
+        const Leaf& leaf = leaves_[j];
+        const int leafAlignment = (leaf.offset+colAlignment) % p;
+        const int localHeight =
+            Length( leaf.size, Shift(rank,leafAlignment,p), p );
+        const int iLocalOffset = Length( leaf.offset, colShift, p );
+        const F* recvBuf = &recvBuffer[offsets[leaf.owner]];
+        for( int jLocal=0; jLocal<width; ++jLocal )
+            MemCopy
+            ( X.Buffer(iLocalOffset,jLocal),
+              &recvBuf[jLocal*localHeight], localHeight );
+        offsets[leaf.owner] += localHeight*width;
+    }
+}
+
+template<typename F>
+inline int
+HODLR<F>::Height() const
+{ return height_; }
+
+template<typename F>
+inline int
+HODLR<F>::NumLevels() const
+{ return levels_.size(); }
+
+template<typename F>
+inline int
+HODLR<F>::NumLeaves() const
+{ return leaves_.size(); }
+
+template<typename F>
+inline int
+HODLR<F>::MaxRank() const
+{
+    const int numLevels = levels_.size();
+    int maxRank = 0;
+    for( int l=0; l<numLevels; ++l )
+        maxRank = std::max( maxRank, rankWidths_[l] );
+    return maxRank;
+}
+
+template<typename F>
+inline double
+HODLR<F>::NumEntries() const
+{
+    const int numLevels = levels_.size();
+    const int numLeaves = leaves_.size();
+    double numEntries = 0;
+    for( int j=0; j<numLeaves; ++j )
+        numEntries += double(leaves_[j].size)*leaves_[j].size;
+    for( int l=0; l<numLevels; ++l )
+    {
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = levels_[l][j];
+            numEntries += double(node.size1+node.size2)*node.rank1;
+            numEntries += double(node.size1+node.size2)*node.rank2;
+        }
+    }
+    return numEntries;
+}
+
+template<typename F>
+inline const elem::Grid&
+HODLR<F>::Grid() const
+{ return *grid_; }
+
+template<typename F>
+inline bool
+HODLR<F>::Factored() const
+{ return factored_; }
+
+template<typename F>
+inline void
+HODLR<F>::Multiply
+( Orientation orientation,
+  F alpha, const DistMatrix<F>& X, F beta, DistMatrix<F>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::Multiply");
+    if( X.Height() != height_ )
+        throw std::logic_error("X is the wrong height");
+    if( Y.Height() != height_ || Y.Width() != X.Width() )
+        throw std::logic_error("Y is the wrong size");
+#endif
+    if( orientation == TRANSPOSE )
+    {
+        // A^T X = conj(A^H conj(X))
+        DistMatrix<F> XConj( *grid_ );
+        XConj = X;
+        Conjugate( XConj );
+        Conjugate( Y );
+        Multiply( ADJOINT, Conj(alpha), XConj, Conj(beta), Y );
+        Conjugate( Y );
+        return;
+    }
+    const elem::Grid& g = *grid_;
+    const int n = height_;
+    const int width = X.Width();
+    const bool adjoint = ( orientation == ADJOINT );
+    const int numLevels = levels_.size();
+    const int numLeaves = leaves_.size();
+
+    DistMatrix<F,VC,STAR> X_VC_STAR(g), Z_VC_STAR(g);
+    X_VC_STAR.AlignWith( U_ );
+    Z_VC_STAR.AlignWith( U_ );
+    X_VC_STAR = X;
+    Zeros( Z_VC_STAR, n, width );
+
+    // Apply the leaf blocks on the processes which own them
+    {
+        const int rank = g.VCRank();
+        Matrix<F> XLeaves, ZLeaves, DLeaf, XLeaf, ZLeaf;
+        GatherLeaves( X_VC_STAR, XLeaves );
+        Zeros( ZLeaves, XLeaves.Height(), width );
+        for( int j=0; j<numLeaves; ++j )
+        {
+            const Leaf& leaf = leaves_[j];
+            if( leaf.owner != rank )
+                continue;
+            LockedView( DLeaf, D_, leaf.localOffset, 0, leaf.size, leaf.size );
+            LockedView
+            ( XLeaf, XLeaves, leaf.localOffset, 0, leaf.size, width );
+            View( ZLeaf, ZLeaves, leaf.localOffset, 0, leaf.size, width );
+            Gemm( orientation, NORMAL, F(1), DLeaf, XLeaf, F(0), ZLeaf );
+        }
+        ScatterLeaves( ZLeaves, Z_VC_STAR );
+    }
+
+    // Compute the coefficients of all of the off-diagonal blocks at once.
+    // For A(c1,c2) ~= U1 V1^H, the coefficients are V1^H X(c2) (or, in the
+    // adjoint case, U1^H X(c1)).
+    const DistMatrix<F,VC,STAR>& Left = ( adjoint ? V_ : U_ );
+    const DistMatrix<F,VC,STAR>& Right = ( adjoint ? U_ : V_ );
+    int bufferSize = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+            bufferSize +=
+                (levels_[l][j].rank1+levels_[l][j].rank2)*width;
+    }
+    std::vector<F> buffer( std::max(bufferSize,1), F(0) );
+    DistMatrix<F,VC,STAR> LeftBlock(g), RightBlock(g), XBlock(g), ZBlock(g);
+    Matrix<F> W;
+    int offset = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = levels_[l][j];
+            const int rank1 = node.rank1;
+            const int rank2 = node.rank2;
+            // The first coupling maps c2 to c1 (or c1 to c2 if adjoint)
+            const int in1 = ( adjoint ? node.offset1 : node.offset2 );
+            const int inSize1 = ( adjoint ? node.size1 : node.size2 );
+            const int in2 = ( adjoint ? node.offset2 : node.offset1 );
+            const int inSize2 = ( adjoint ? node.size2 : node.size1 );
+
+            W.Attach( rank1, width, &buffer[0]+offset, std::max(rank1,1) );
+            LockedView
+            ( RightBlock, Right, in1, rankOffsets_[l], inSize1, rank1 );
+            LockedView( XBlock, X_VC_STAR, in1, 0, inSize1, width );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), RightBlock.LockedMatrix(), XBlock.LockedMatrix(), F(0), W );
+            offset += rank1*width;
+
+            W.Attach( rank2, width, &buffer[0]+offset, std::max(rank2,1) );
+            LockedView
+            ( RightBlock, Right, in2, rankOffsets_[l], inSize2, rank2 );
+            LockedView( XBlock, X_VC_STAR, in2, 0, inSize2, width );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), RightBlock.LockedMatrix(), XBlock.LockedMatrix(), F(0), W );
+            offset += rank2*width;
+        }
+    }
+    if( bufferSize > 0 )
+        mpi::AllReduce( &buffer[0], bufferSize, mpi::SUM, g.VCComm() );
+
+    // Apply the off-diagonal blocks
+    offset = 0;
+    for( int l=0; l<numLevels; ++l )
+    {
+        const int numNodes = levels_[l].size();
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = levels_[l][j];
+            const int rank1 = node.rank1;
+            const int rank2 = node.rank2;
+            const int out1 = ( adjoint ? node.offset2 : node.offset1 );
+            const int outSize1 = ( adjoint ? node.size2 : node.size1 );
+            const int out2 = ( adjoint ? node.offset1 : node.offset2 );
+            const int outSize2 = ( adjoint ? node.size1 : node.size2 );
+
+            W.LockedAttach
+            ( rank1, width, &buffer[0]+offset, std::max(rank1,1) );
+            LockedView
+            ( LeftBlock, Left, out1, rankOffsets_[l], outSize1, rank1 );
+            View( ZBlock, Z_VC_STAR, out1, 0, outSize1, width );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(1), LeftBlock.LockedMatrix(), W, F(1), ZBlock.Matrix() );
+            offset += rank1*width;
+
+            W.LockedAttach
+            ( rank2, width, &buffer[0]+offset, std::max(rank2,1) );
+            LockedView
+            ( LeftBlock, Left, out2, rankOffsets_[l], outSize2, rank2 );
+            View( ZBlock, Z_VC_STAR, out2, 0, outSize2, width );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(1), LeftBlock.LockedMatrix(), W, F(1), ZBlock.Matrix() );
+            offset += rank2*width;
+        }
+    }
+
+    // Y := alpha Z + beta Y
+    DistMatrix<F> Z(g);
+    Z.AlignWith( Y );
+    Z = Z_VC_STAR;
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+// X := (I - Y_s inv(K_s) Vh_s) ... (I - Y_{L-1} inv(K_{L-1}) Vh_{L-1}) inv(D) X
+// for s = 'stopLevel', i.e., apply the inverses of the diagonal blocks of the
+// nodes at depth s (or deeper)
+template<typename F>
+inline void
+HODLR<F>::ApplyInverse( DistMatrix<F,VC,STAR>& X, int stopLevel ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::ApplyInverse");
+    if( X.ColAlignment() != U_.ColAlignment() )
+        throw std::logic_error("X is not aligned with the factors");
+#endif
+    const elem::Grid& g = *grid_;
+    const int width = X.Width();
+    const int numLevels = levels_.size();
+    const int numLeaves = leaves_.size();
+
+    // Apply the inverses of the leaf blocks on the processes which own them
+    {
+        const int rank = g.VCRank();
+        Matrix<F> XLeaves, ZLeaves, DInvLeaf, XLeaf, ZLeaf;
+        GatherLeaves( X, XLeaves );
+        Zeros( ZLeaves, XLeaves.Height(), width );
+        for( int j=0; j<numLeaves; ++j )
+        {
+            const Leaf& leaf = leaves_[j];
+            if( leaf.owner != rank )
+                continue;
+            LockedView
+            ( DInvLeaf, DInv_, leaf.localOffset, 0, leaf.size, leaf.size );
+            LockedView
+            ( XLeaf, XLeaves, leaf.localOffset, 0, leaf.size, width );
+            View( ZLeaf, ZLeaves, leaf.localOffset, 0, leaf.size, width );
+            Gemm( NORMAL, NORMAL, F(1), DInvLeaf, XLeaf, F(0), ZLeaf );
+        }
+        ScatterLeaves( ZLeaves, X );
+    }
+
+    // Apply the corrections from the bottom of the tree up
+    DistMatrix<F,VC,STAR> VBlock(g), YBlock(g), XBlock(g);
+    Matrix<F> W, W1, W2;
+    std::vector<F> buffer;
+    for( int l=numLevels-1; l>=stopLevel; --l )
+    {
+        const std::vector<Node>& nodes = levels_[l];
+        const int numNodes = nodes.size();
+        int bufferSize = 0;
+        for( int j=0; j<numNodes; ++j )
+            bufferSize += (nodes[j].rank1+nodes[j].rank2)*width;
+        if( bufferSize == 0 )
+            continue;
+        buffer.assign( std::max(bufferSize,1), F(0) );
+
+        // [W1; W2] := [V1^H X(c2); V2^H X(c1)] for each node
+        int offset = 0;
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = nodes[j];
+            const int rank = node.rank1 + node.rank2;
+            W1.Attach( node.rank1, width, &buffer[0]+offset, std::max(rank,1) );
+            W2.Attach
+            ( node.rank2, width,
+              &buffer[0]+offset+node.rank1, std::max(rank,1) );
+            LockedView
+            ( VBlock, V_, node.offset2, rankOffsets_[l], node.size2,
+              node.rank1 );
+            LockedView
+            ( XBlock, X, node.offset2, 0, node.size2, width );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), VBlock.LockedMatrix(), XBlock.LockedMatrix(), F(0), W1 );
+            LockedView
+            ( VBlock, V_, node.offset1, rankOffsets_[l], node.size1,
+              node.rank2 );
+            LockedView
+            ( XBlock, X, node.offset1, 0, node.size1, width );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), VBlock.LockedMatrix(), XBlock.LockedMatrix(), F(0), W2 );
+            offset += rank*width;
+        }
+        mpi::AllReduce( &buffer[0], bufferSize, mpi::SUM, g.VCComm() );
+
+        // [X(c1); X(c2)] -= [Y1 0; 0 Y2] inv(K) [W1; W2] for each node
+        offset = 0;
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = nodes[j];
+            const int rank = node.rank1 + node.rank2;
+            if( rank == 0 )
+                continue;
+            W.Attach( rank, width, &buffer[0]+offset, std::max(rank,1) );
+            lu::SolveAfter( NORMAL, node.K, node.pK, W );
+            W1.LockedAttach
+            ( node.rank1, width, &buffer[0]+offset, std::max(rank,1) );
+            W2.LockedAttach
+            ( node.rank2, width,
+              &buffer[0]+offset+node.rank1, std::max(rank,1) );
+            LockedView
+            ( YBlock, Y_, node.offset1, rankOffsets_[l], node.size1,
+              node.rank1 );
+            View( XBlock, X, node.offset1, 0, node.size1, width );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(-1), YBlock.LockedMatrix(), W1, F(1), XBlock.Matrix() );
+            LockedView
+            ( YBlock, Y_, node.offset2, rankOffsets_[l], node.size2,
+              node.rank2 );
+            View( XBlock, X, node.offset2, 0, node.size2, width );
+            Gemm
+            ( NORMAL, NORMAL,
+              F(-1), YBlock.LockedMatrix(), W2, F(1), XBlock.Matrix() );
+            offset += rank*width;
+        }
+    }
+}
+
+template<typename F>
+inline void
+HODLR<F>::Factor()
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::Factor");
+#endif
+    const elem::Grid& g = *grid_;
+    const int n = height_;
+    const int numLevels = levels_.size();
+    const int numLeaves = leaves_.size();
+
+    // Invert the leaf blocks on the processes which own them
+    DInv_ = D_;
+    {
+        const int rank = g.VCRank();
+        Matrix<F> DInvLeaf;
+        for( int j=0; j<numLeaves; ++j )
+        {
+            const Leaf& leaf = leaves_[j];
+            if( leaf.owner != rank )
+                continue;
+            View( DInvLeaf, DInv_, leaf.localOffset, 0, leaf.size, leaf.size );
+            Inverse( DInvLeaf );
+        }
+    }
+
+    // Form Y := inv(D) U and K := I + Vh Y from the bottom of the tree up,
+    // since inv(D) at depth l is built from the factorizations at depth l+1
+    Y_ = U_;
+    DistMatrix<F,VC,STAR> YLevel(g), VBlock(g), YBlock(g);
+    std::vector<F> buffer;
+    Matrix<F> K12, K21, KBlock;
+    for( int l=numLevels-1; l>=0; --l )
+    {
+        std::vector<Node>& nodes = levels_[l];
+        const int numNodes = nodes.size();
+        View( YLevel, Y_, 0, rankOffsets_[l], n, rankWidths_[l] );
+        ApplyInverse( YLevel, l+1 );
+
+        int bufferSize = 0;
+        for( int j=0; j<numNodes; ++j )
+            bufferSize += 2*nodes[j].rank1*nodes[j].rank2;
+        buffer.assign( std::max(bufferSize,1), F(0) );
+        int offset = 0;
+        for( int j=0; j<numNodes; ++j )
+        {
+            const Node& node = nodes[j];
+            const int rank1 = node.rank1;
+            const int rank2 = node.rank2;
+
+            // K12 := V1^H Y2
+            K12.Attach( rank1, rank2, &buffer[0]+offset, std::max(rank1,1) );
+            LockedView
+            ( VBlock, V_, node.offset2, rankOffsets_[l], node.size2, rank1 );
+            LockedView
+            ( YBlock, Y_, node.offset2, rankOffsets_[l], node.size2, rank2 );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), VBlock.LockedMatrix(), YBlock.LockedMatrix(), F(0), K12 );
+            offset += rank1*rank2;
+
+            // K21 := V2^H Y1
+            K21.Attach( rank2, rank1, &buffer[0]+offset, std::max(rank2,1) );
+            LockedView
+            ( VBlock, V_, node.offset1, rankOffsets_[l], node.size1, rank2 );
+            LockedView
+            ( YBlock, Y_, node.offset1, rankOffsets_[l], node.size1, rank1 );
+            Gemm
+            ( ADJOINT, NORMAL,
+              F(1), VBlock.LockedMatrix(), YBlock.LockedMatrix(), F(0), K21 );
+            offset += rank1*rank2;
+        }
+        if( bufferSize > 0 )
+            mpi::AllReduce( &buffer[0], bufferSize, mpi::SUM, g.VCComm() );
+
+        // Form and factor K = [I, K12; K21, I] on every process
+        offset = 0;
+        for( int j=0; j<numNodes; ++j )
+        {
+            Node& node = nodes[j];
+            const int rank1 = node.rank1;
+            const int rank2 = node.rank2;
+            Identity( node.K, rank1+rank2, rank1+rank2 );
+            K12.LockedAttach
+            ( rank1, rank2, &buffer[0]+offset, std::max(rank1,1) );
+            View( KBlock, node.K, 0, rank1, rank1, rank2 );
+            KBlock = K12;
+            offset += rank1*rank2;
+            K21.LockedAttach
+            ( rank2, rank1, &buffer[0]+offset, std::max(rank2,1) );
+            View( KBlock, node.K, rank1, 0, rank2, rank1 );
+            KBlock = K21;
+            offset += rank1*rank2;
+            if( rank1+rank2 > 0 )
+                LU( node.K, node.pK );
+        }
+    }
+    factored_ = true;
+}
+
+template<typename F>
+inline void
+HODLR<F>::Solve( DistMatrix<F>& B ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("HODLR::Solve");
+    if( !factored_ )
+        throw std::logic_error("Must call Factor before Solve");
+    if( B.Height() != height_ )
+        throw std::logic_error("B is the wrong height");
+#endif
+    DistMatrix<F,VC,STAR> B_VC_STAR( *grid_ );
+    B_VC_STAR.AlignWith( U_ );
+    B_VC_STAR = B;
+    ApplyInverse( B_VC_STAR, 0 );
+    B = B_VC_STAR;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_HODLR_HPP
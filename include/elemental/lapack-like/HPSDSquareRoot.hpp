@@ -11,8 +11,12 @@
 #define LAPACK_HPSDSQUAREROOT_HPP
 
 #include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/lapack-like/Norm/Max.hpp"
 
+#include "elemental/lapack-like/HPSDSquareRoot/Newton.hpp"
+#include "elemental/lapack-like/HPSDSquareRoot/NewtonSchulz.hpp"
+
 namespace elem {
 
 //
@@ -122,6 +126,59 @@ HPSDSquareRoot( UpperOrLower uplo, DistMatrix<F>& A )
 }
 #endif // ifdef HAVE_PMRRR
 
+//
+// Compute the square root of A using the selected method and return the 
+// number of iterations (or zero for SQRT_EIG). Unlike SQRT_EIG, which allows 
+// for (numerically) singular matrices, the iterative methods require A to be
+// positive-definite, and they overwrite both triangles of A.
+//
+
+template<typename F>
+inline int
+HPSDSquareRoot
+( UpperOrLower uplo, Matrix<F>& A, SquareRootMethod method,
+  int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HPSDSquareRoot");
+#endif
+    if( method == SQRT_EIG )
+    {
+        HPSDSquareRoot( uplo, A );
+        return 0;
+    }
+    MakeHermitian( uplo, A );
+    if( method == SQRT_NEWTON )
+        return hpsd_square_root::Newton( A, maxIts, progress );
+    else
+        return hpsd_square_root::NewtonSchulz( A, maxIts, progress );
+}
+
+template<typename F>
+inline int
+HPSDSquareRoot
+( UpperOrLower uplo, DistMatrix<F>& A, SquareRootMethod method,
+  int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HPSDSquareRoot");
+#endif
+    if( method == SQRT_EIG )
+    {
+#ifdef HAVE_PMRRR
+        HPSDSquareRoot( uplo, A );
+        return 0;
+#else
+        throw std::logic_error("SQRT_EIG requires PMRRR");
+#endif
+    }
+    MakeHermitian( uplo, A );
+    if( method == SQRT_NEWTON )
+        return hpsd_square_root::Newton( A, maxIts, progress );
+    else
+        return hpsd_square_root::NewtonSchulz( A, maxIts, progress );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_HPSDSQUAREROOT_HPP
@@ -0,0 +1,169 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HPSDSQUAREROOT_NEWTON_HPP
+#define LAPACK_HPSDSQUAREROOT_NEWTON_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trtrmm.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Determinant.hpp"
+#include "elemental/lapack-like/TriangularInverse.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+//
+// The product form of the Denman-Beavers (Newton) iteration for the square
+// root, with determinantal scaling, from Chapter 6 of Higham's "Functions of
+// Matrices":
+//     mu_k    := |det(M_k)|^{-1/(2n)},
+//     Y_{k+1} := mu_k Y_k (I + inv(M_k)/mu_k^2)/2,
+//     M_{k+1} := (I + (mu_k^2 M_k + inv(M_k)/mu_k^2)/2)/2,
+// where M_0 = Y_0 = A, so that Y_k converges quadratically to sqrt(A) and
+// M_k to the identity. Since each M_k is a positive-definite function of A,
+// a single Cholesky factorization M_k = L L^H per step yields both its
+// determinant, from the diagonal of L, and its inverse, inv(L)^H inv(L).
+// The scaling is disabled once the iteration enters its region of quadratic
+// convergence.
+//
+// The input must be Hermitian positive-definite with both triangles
+// explicitly stored, and the number of iterations is returned.
+//
+
+namespace elem {
+namespace hpsd_square_root {
+
+template<typename F>
+inline int
+Newton( Matrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpsd_square_root::Newton");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    Matrix<F> I, M( A ), MInv, Y;
+    Identity( I, n, n );
+    int numIts = 0;
+    bool scale = true;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Denman-Beavers square root iteration did not converge");
+        ++numIts;
+        MInv = M;
+        Cholesky( LOWER, MInv );
+        R mu = 1;
+        if( scale )
+        {
+            const SafeProduct<F> det =
+                hpd_determinant::AfterCholesky( LOWER, MInv );
+            mu = Exp( -det.kappa/2 );
+        }
+        TriangularInverse( LOWER, NON_UNIT, MInv );
+        Trtrmm( ADJOINT, LOWER, MInv );
+        MakeHermitian( LOWER, MInv );
+
+        // Y := (mu/2) A + (1/(2 mu)) A inv(M)
+        Gemm( NORMAL, NORMAL, F(1/(2*mu)), A, MInv, Y );
+        Axpy( mu/2, A, Y );
+
+        // M := I/2 + (mu^2/4) M + inv(M)/(4 mu^2)
+        Scale( mu*mu/4, M );
+        Axpy( 1/(4*mu*mu), MInv, M );
+        Axpy( R(1)/R(2), I, M );
+
+        Axpy( F(-1), Y, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( Y );
+        A = Y;
+        if( progress )
+            std::cout << "  Denman-Beavers iteration " << numIts
+                      << ": ||Y_k - Y_{k-1}||_F / ||Y_k||_F = " << relChange
+                      << std::endl;
+        if( relChange < R(1)/R(100) )
+            scale = false;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+Newton( DistMatrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpsd_square_root::Newton");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    DistMatrix<F> I( g ), M( A ), MInv( g ), Y( g );
+    Identity( I, n, n );
+    int numIts = 0;
+    bool scale = true;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Denman-Beavers square root iteration did not converge");
+        ++numIts;
+        MInv = M;
+        Cholesky( LOWER, MInv );
+        R mu = 1;
+        if( scale )
+        {
+            const SafeProduct<F> det =
+                hpd_determinant::AfterCholesky( LOWER, MInv );
+            mu = Exp( -det.kappa/2 );
+        }
+        TriangularInverse( LOWER, NON_UNIT, MInv );
+        Trtrmm( ADJOINT, LOWER, MInv );
+        MakeHermitian( LOWER, MInv );
+
+        // Y := (mu/2) A + (1/(2 mu)) A inv(M)
+        Gemm( NORMAL, NORMAL, F(1/(2*mu)), A, MInv, Y );
+        Axpy( mu/2, A, Y );
+
+        // M := I/2 + (mu^2/4) M + inv(M)/(4 mu^2)
+        Scale( mu*mu/4, M );
+        Axpy( 1/(4*mu*mu), MInv, M );
+        Axpy( R(1)/R(2), I, M );
+
+        Axpy( F(-1), Y, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( Y );
+        A = Y;
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Denman-Beavers iteration " << numIts
+                      << ": ||Y_k - Y_{k-1}||_F / ||Y_k||_F = " << relChange
+                      << std::endl;
+        if( relChange < R(1)/R(100) )
+            scale = false;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+} // namespace hpsd_square_root
+} // namespace elem
+
+#endif // ifndef LAPACK_HPSDSQUAREROOT_NEWTON_HPP
@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HPSDSQUAREROOT_NEWTONSCHULZ_HPP
+#define LAPACK_HPSDSQUAREROOT_NEWTONSCHULZ_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+#include "elemental/matrices/Identity.hpp"
+
+//
+// The inverse-free coupled Newton-Schulz iteration for the square root,
+//     T_k     := (3 I - Z_k Y_k)/2,
+//     Y_{k+1} := Y_k T_k,
+//     Z_{k+1} := T_k Z_k,
+// where Y_0 = A/c and Z_0 = I, so that Y_k converges to sqrt(A/c) and Z_k to
+// its inverse using three matrix-matrix multiplications per step. Choosing c
+// as an upper bound on the two-norm of A ensures convergence, but, as for the
+// Newton-Schulz sign iteration, an eigenvalue which is small relative to c
+// initially only grows by a factor of 3/2 per step.
+//
+// The input must be Hermitian positive-definite with both triangles
+// explicitly stored, and the number of iterations is returned.
+//
+
+namespace elem {
+namespace hpsd_square_root {
+
+template<typename F>
+inline int
+NewtonSchulz( Matrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpsd_square_root::NewtonSchulz");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    // Both norms are upper bounds on the two-norm
+    const R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        return 0;
+    Scale( 1/normBound, A );
+
+    Matrix<F> I, Z, T, YNew, ZNew;
+    Identity( I, n, n );
+    Identity( Z, n, n );
+    int numIts = 0;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Newton-Schulz square root iteration did not converge");
+        ++numIts;
+        T = I;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), Z, A, F(3)/F(2), T );
+        Gemm( NORMAL, NORMAL, F(1), A, T, YNew );
+        Gemm( NORMAL, NORMAL, F(1), T, Z, ZNew );
+        Z = ZNew;
+
+        Axpy( F(-1), YNew, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( YNew );
+        A = YNew;
+        if( progress )
+            std::cout << "  Newton-Schulz square root iteration " << numIts
+                      << ": ||Y_k - Y_{k-1}||_F / ||Y_k||_F = " << relChange
+                      << std::endl;
+        if( relChange <= tol )
+            break;
+    }
+    Scale( Sqrt(normBound), A );
+    return numIts;
+}
+
+template<typename F>
+inline int
+NewtonSchulz( DistMatrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hpsd_square_root::NewtonSchulz");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    // Both norms are upper bounds on the two-norm
+    const R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        return 0;
+    Scale( 1/normBound, A );
+
+    DistMatrix<F> I( g ), Z( g ), T( g ), YNew( g ), ZNew( g );
+    Identity( I, n, n );
+    Identity( Z, n, n );
+    int numIts = 0;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Newton-Schulz square root iteration did not converge");
+        ++numIts;
+        T = I;
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), Z, A, F(3)/F(2), T );
+        Gemm( NORMAL, NORMAL, F(1), A, T, YNew );
+        Gemm( NORMAL, NORMAL, F(1), T, Z, ZNew );
+        Z = ZNew;
+
+        Axpy( F(-1), YNew, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( YNew );
+        A = YNew;
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Newton-Schulz square root iteration " << numIts
+                      << ": ||Y_k - Y_{k-1}||_F / ||Y_k||_F = " << relChange
+                      << std::endl;
+        if( relChange <= tol )
+            break;
+    }
+    Scale( Sqrt(normBound), A );
+    return numIts;
+}
+
+} // namespace hpsd_square_root
+} // namespace elem
+
+#endif // ifndef LAPACK_HPSDSQUAREROOT_NEWTONSCHULZ_HPP
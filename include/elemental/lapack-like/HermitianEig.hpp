@@ -13,5 +13,54 @@
 // NOTE: HermitianEig declarations are in lapack-like_decl.hpp
 
 #include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/lapack-like/HermitianEig/LOBPCG.hpp"
+#include "elemental/lapack-like/HermitianEig/QDWH.hpp"
+
+namespace elem {
+
+//
+// Compute the full eigenvalue decomposition of a Hermitian matrix using the
+// selected method. For EIG_QDWH, subproblems of size at most 'cutoff' are
+// handed to the standard (sequential) eigensolver.
+//
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Z,
+  HermitianEigMethod method, int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianEig");
+#endif
+    if( method == EIG_QDWH )
+        hermitian_eig::QDWH( uplo, A, w, Z, cutoff );
+    else
+        HermitianEig( uplo, A, w, Z );
+}
+
+template<typename F>
+inline void
+HermitianEig
+( UpperOrLower uplo, DistMatrix<F>& A, 
+  DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& Z,
+  HermitianEigMethod method, int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianEig");
+#endif
+    if( method == EIG_QDWH )
+        hermitian_eig::QDWH( uplo, A, w, Z, cutoff );
+    else
+    {
+#ifdef HAVE_PMRRR
+        HermitianEig( uplo, A, w, Z );
+#else
+        throw std::logic_error("EIG_TRIDIAG requires PMRRR");
+#endif
+    }
+}
+
+} // namespace elem
 
 #endif // ifndef LAPACK_HERMITIANEIG_HPP
@@ -0,0 +1,394 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANEIG_LOBPCG_HPP
+#define LAPACK_HERMITIANEIG_LOBPCG_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Hemm.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Knyazev's Locally Optimal Block Preconditioned Conjugate Gradient method
+// (without a preconditioner) for the k smallest (or largest) eigenpairs of a
+// Hermitian operator. Each iteration performs a Rayleigh-Ritz projection onto
+// the span of the current eigenvector approximations X, the residuals W of
+// the unconverged approximations, and the previous search directions P, so
+// that only products with the operator, tall-skinny matrix-matrix
+// multiplications, and QR factorizations of n x 2k matrices are required.
+// This avoids the O(n^3) tridiagonal reduction when k is much smaller than n.
+//
+// The operator need only provide
+//
+//     void operator()( const DistMatrix<F>& X, DistMatrix<F>& Y ) const,
+//
+// which sets Y := A X (or the equivalent for Matrix<F>), and is applied to at
+// most 2k vectors per iteration. If X is n x k on entry, it is used as the
+// initial guess, otherwise a random guess is used. On exit, w contains the
+// eigenvalues in ascending order (descending if 'largest' is true), and X
+// the corresponding eigenvectors.
+//
+// An eigenpair is considered converged once || A x - theta x ||_2 is at most
+// tol times the largest Ritz value magnitude encountered, which is a lower
+// bound on || A ||_2. The number of iterations is returned.
+//
+
+namespace elem {
+namespace hermitian_eig {
+
+// Applies a Hermitian matrix, stored in the 'uplo' triangle, as an operator
+template<typename F,typename MatrixType>
+class HermitianOperator
+{
+public:
+    HermitianOperator( UpperOrLower uplo, const MatrixType& A )
+    : uplo_(uplo), A_(A)
+    { }
+
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, X.Height(), X.Width() );
+        Hemm( LEFT, uplo_, F(1), A_, X, F(0), Y );
+    }
+
+private:
+    UpperOrLower uplo_;
+    const MatrixType& A_;
+};
+
+template<typename R>
+inline R
+LOBPCGDefaultTolerance()
+{
+    const R eps = lapack::MachineEpsilon<R>();
+    return Pow( eps, R(2)/R(3) );
+}
+
+template<typename F,typename Operator>
+inline int
+LOBPCG
+( const Operator& A, int n, Matrix<BASE(F)>& w, Matrix<F>& X, int k,
+  bool largest=false, BASE(F) tol=0, int maxIts=1000, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::LOBPCG");
+#endif
+    typedef BASE(F) R;
+    if( k < 1 || 3*k > n )
+        throw std::logic_error("LOBPCG requires 1 <= k <= n/3");
+    if( tol == R(0) )
+        tol = LOBPCGDefaultTolerance<R>();
+
+    if( X.Height() != n || X.Width() != k )
+        Uniform( X, n, k );
+    Matrix<F> S( X ), AS;
+    qr::Explicit( S );
+    A( S, AS );
+
+    Matrix<F> AX, P, W, V, AV, G, C, SBot, CSel, CBot;
+    Matrix<R> theta;
+    std::vector<R> wVals( k );
+    std::vector<int> active;
+    R normEst = 0;
+    int numIts = 0;
+    while( true )
+    {
+        // Rayleigh-Ritz on the span of S
+        const int m = S.Width();
+        Gemm( ADJOINT, NORMAL, F(1), S, AS, G );
+        HermitianEig( LOWER, G, theta, C );
+        const int offset = ( largest ? m-k : 0 );
+        LockedView( CSel, C, 0, offset, m, k );
+        Gemm( NORMAL, NORMAL, F(1), S, CSel, X );
+        Gemm( NORMAL, NORMAL, F(1), AS, CSel, AX );
+        const bool haveP = ( m > k );
+        if( haveP )
+        {
+            // P := S2 C2, where S2 spans the non-X directions
+            LockedView( SBot, S, 0, k, n, m-k );
+            LockedView( CBot, CSel, k, 0, m-k, k );
+            Gemm( NORMAL, NORMAL, F(1), SBot, CBot, P );
+        }
+        for( int i=0; i<m; ++i )
+            normEst = std::max( normEst, Abs(theta.Get(i,0)) );
+
+        // W := A X - X diag(theta), and check for convergence
+        W = AX;
+        active.resize( 0 );
+        R maxRelResid = 0;
+        for( int j=0; j<k; ++j )
+        {
+            wVals[j] = theta.Get(offset+j,0);
+            R normSquared = 0;
+            for( int i=0; i<n; ++i )
+            {
+                const F rho = W.Get(i,j) - wVals[j]*X.Get(i,j);
+                W.Set( i, j, rho );
+                normSquared += RealPart(Conj(rho)*rho);
+            }
+            const R relResid = Sqrt(normSquared) / normEst;
+            maxRelResid = std::max( maxRelResid, relResid );
+            if( relResid > tol )
+                active.push_back( j );
+        }
+        if( progress )
+            std::cout << "  LOBPCG iteration " << numIts << ": "
+                      << k-active.size() << " of " << k
+                      << " converged, max relative residual = "
+                      << maxRelResid << std::endl;
+        if( active.empty() )
+            break;
+        if( numIts >= maxIts )
+            throw std::runtime_error("LOBPCG did not converge");
+        ++numIts;
+
+        // V := [W_active, P], made orthonormal and orthogonal to X
+        const int numActive = active.size();
+        const int numNew = numActive + ( haveP ? k : 0 );
+        Zeros( V, n, numNew );
+        for( int jj=0; jj<numActive; ++jj )
+            for( int i=0; i<n; ++i )
+                V.Set( i, jj, W.Get(i,active[jj]) );
+        if( haveP )
+            for( int j=0; j<k; ++j )
+                for( int i=0; i<n; ++i )
+                    V.Set( i, numActive+j, P.Get(i,j) );
+        Matrix<F> H;
+        for( int pass=0; pass<2; ++pass )
+        {
+            for( int proj=0; proj<2; ++proj )
+            {
+                Gemm( ADJOINT, NORMAL, F(1), X, V, H );
+                Gemm( NORMAL, NORMAL, F(-1), X, H, F(1), V );
+            }
+            // The QR factorization can amplify the remaining components in
+            // the span of X when [W,P] is ill-conditioned, so repeat once
+            qr::Explicit( V );
+        }
+        A( V, AV );
+
+        // S := [X, V] and AS := [AX, AV]
+        Zeros( S, n, k+numNew );
+        Zeros( AS, n, k+numNew );
+        Matrix<F> SL, SR, ASL, ASR;
+        View( SL, S, 0, 0, n, k );
+        View( SR, S, 0, k, n, numNew );
+        View( ASL, AS, 0, 0, n, k );
+        View( ASR, AS, 0, k, n, numNew );
+        SL = X;
+        SR = V;
+        ASL = AX;
+        ASR = AV;
+    }
+
+    w.ResizeTo( k, 1 );
+    for( int j=0; j<k; ++j )
+        w.Set( j, 0, wVals[j] );
+    Sort( w, X, !largest );
+    return numIts;
+}
+
+template<typename F,typename Operator>
+inline int
+LOBPCG
+( const Operator& A, int n, DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& X,
+  int k, bool largest=false, BASE(F) tol=0, int maxIts=1000,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::LOBPCG");
+#endif
+    typedef BASE(F) R;
+    if( k < 1 || 3*k > n )
+        throw std::logic_error("LOBPCG requires 1 <= k <= n/3");
+    if( tol == R(0) )
+        tol = LOBPCGDefaultTolerance<R>();
+    const Grid& g = X.Grid();
+
+    // The operator is applied to [MC,MR] matrices, while the tall-skinny
+    // products are performed locally on [VC,STAR] matrices with a single
+    // summation over the grid of each small result
+    if( X.Height() != n || X.Width() != k )
+        Uniform( X, n, k );
+    DistMatrix<F> V( X ), AV( g );
+    qr::Explicit( V );
+    A( V, AV );
+    DistMatrix<F,VC,STAR> S_VC( g ), AS_VC( g );
+    S_VC = V;
+    AS_VC = AV;
+
+    DistMatrix<F,VC,STAR> X_VC( g ), AX_VC( g ), P_VC( g ), W_VC( g ),
+                          V_VC( g ), AV_VC( g );
+    DistMatrix<F,STAR,STAR> G( g ), C( g ), H( g );
+    Matrix<R> theta;
+    std::vector<R> wVals( k ), normsSquared( k );
+    std::vector<int> active;
+    R normEst = 0;
+    int numIts = 0;
+    while( true )
+    {
+        // Rayleigh-Ritz on the span of S
+        const int m = S_VC.Width();
+        LocalGemm( ADJOINT, NORMAL, F(1), S_VC, AS_VC, G );
+        G.SumOverGrid();
+        Zeros( C, m, m );
+        HermitianEig( LOWER, G.Matrix(), theta, C.Matrix() );
+        const int offset = ( largest ? m-k : 0 );
+        DistMatrix<F,STAR,STAR> CSel( g );
+        LockedView( CSel, C, 0, offset, m, k );
+        LocalGemm( NORMAL, NORMAL, F(1), S_VC, CSel, X_VC );
+        LocalGemm( NORMAL, NORMAL, F(1), AS_VC, CSel, AX_VC );
+        const bool haveP = ( m > k );
+        if( haveP )
+        {
+            // P := S2 C2, where S2 spans the non-X directions
+            DistMatrix<F,VC,STAR> SBot_VC( g );
+            DistMatrix<F,STAR,STAR> CBot( g );
+            LockedView( SBot_VC, S_VC, 0, k, n, m-k );
+            LockedView( CBot, CSel, k, 0, m-k, k );
+            LocalGemm( NORMAL, NORMAL, F(1), SBot_VC, CBot, P_VC );
+        }
+        for( int i=0; i<m; ++i )
+            normEst = std::max( normEst, Abs(theta.Get(i,0)) );
+
+        // W := A X - X diag(theta), and check for convergence
+        W_VC = AX_VC;
+        const int localHeight = W_VC.LocalHeight();
+        for( int j=0; j<k; ++j )
+        {
+            wVals[j] = theta.Get(offset+j,0);
+            R localNormSquared = 0;
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const F rho =
+                    W_VC.GetLocal(iLocal,j) - wVals[j]*X_VC.GetLocal(iLocal,j);
+                W_VC.SetLocal( iLocal, j, rho );
+                localNormSquared += RealPart(Conj(rho)*rho);
+            }
+            normsSquared[j] = localNormSquared;
+        }
+        mpi::AllReduce( &normsSquared[0], k, mpi::SUM, g.VCComm() );
+        active.resize( 0 );
+        R maxRelResid = 0;
+        for( int j=0; j<k; ++j )
+        {
+            const R relResid = Sqrt(normsSquared[j]) / normEst;
+            maxRelResid = std::max( maxRelResid, relResid );
+            if( relResid > tol )
+                active.push_back( j );
+        }
+        if( progress && g.Rank() == 0 )
+            std::cout << "  LOBPCG iteration " << numIts << ": "
+                      << k-active.size() << " of " << k
+                      << " converged, max relative residual = "
+                      << maxRelResid << std::endl;
+        if( active.empty() )
+            break;
+        if( numIts >= maxIts )
+            throw std::runtime_error("LOBPCG did not converge");
+        ++numIts;
+
+        // V := [W_active, P], made orthonormal and orthogonal to X
+        const int numActive = active.size();
+        const int numNew = numActive + ( haveP ? k : 0 );
+        Zeros( V_VC, n, numNew );
+        for( int jj=0; jj<numActive; ++jj )
+            MemCopy
+            ( V_VC.Buffer(0,jj), W_VC.LockedBuffer(0,active[jj]),
+              localHeight );
+        if( haveP )
+            for( int j=0; j<k; ++j )
+                MemCopy
+                ( V_VC.Buffer(0,numActive+j), P_VC.LockedBuffer(0,j),
+                  localHeight );
+        for( int pass=0; pass<2; ++pass )
+        {
+            for( int proj=0; proj<2; ++proj )
+            {
+                LocalGemm( ADJOINT, NORMAL, F(1), X_VC, V_VC, H );
+                H.SumOverGrid();
+                LocalGemm( NORMAL, NORMAL, F(-1), X_VC, H, F(1), V_VC );
+            }
+            // The QR factorization can amplify the remaining components in
+            // the span of X when [W,P] is ill-conditioned, so repeat once
+            V = V_VC;
+            qr::Explicit( V );
+            V_VC = V;
+        }
+        A( V, AV );
+        AV_VC = AV;
+
+        // S := [X, V] and AS := [AX, AV]
+        Zeros( S_VC, n, k+numNew );
+        Zeros( AS_VC, n, k+numNew );
+        DistMatrix<F,VC,STAR> SL_VC( g ), SR_VC( g ), ASL_VC( g ), ASR_VC( g );
+        View( SL_VC, S_VC, 0, 0, n, k );
+        View( SR_VC, S_VC, 0, k, n, numNew );
+        View( ASL_VC, AS_VC, 0, 0, n, k );
+        View( ASR_VC, AS_VC, 0, k, n, numNew );
+        SL_VC = X_VC;
+        SR_VC = V_VC;
+        ASL_VC = AX_VC;
+        ASR_VC = AV_VC;
+    }
+
+    w.ResizeTo( k, 1 );
+    const int wLocalHeight = w.LocalHeight();
+    for( int iLocal=0; iLocal<wLocalHeight; ++iLocal )
+    {
+        const int i = w.ColShift() + iLocal*w.ColStride();
+        w.SetLocal( iLocal, 0, wVals[i] );
+    }
+    X = X_VC;
+    Sort( w, X, !largest );
+    return numIts;
+}
+
+template<typename F>
+inline int
+LOBPCG
+( UpperOrLower uplo, const Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& X,
+  int k, bool largest=false, BASE(F) tol=0, int maxIts=1000,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::LOBPCG");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    HermitianOperator<F,Matrix<F> > op( uplo, A );
+    return LOBPCG( op, A.Height(), w, X, k, largest, tol, maxIts, progress );
+}
+
+template<typename F>
+inline int
+LOBPCG
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& X,
+  int k, bool largest=false, BASE(F) tol=0, int maxIts=1000,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::LOBPCG");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( A.Grid() != X.Grid() )
+        throw std::logic_error("A and X must use the same grid");
+#endif
+    HermitianOperator<F,DistMatrix<F> > op( uplo, A );
+    return LOBPCG( op, A.Height(), w, X, k, largest, tol, maxIts, progress );
+}
+
+} // namespace hermitian_eig
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANEIG_LOBPCG_HPP
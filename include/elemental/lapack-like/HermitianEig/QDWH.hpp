@@ -0,0 +1,553 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANEIG_QDWH_HPP
+#define LAPACK_HERMITIANEIG_QDWH_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Trace.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
+#include "elemental/lapack-like/HermitianEig/Sort.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// The spectral divide-and-conquer Hermitian eigensolver of Nakatsukasa and
+// Higham, "Stable and efficient spectral divide and conquer algorithms for
+// the symmetric eigenvalue decomposition and the SVD". The polar factor of
+// A - sigma I, computed with QDWH, has eigenvalues of +-1, so that
+// (U_p + I)/2 is the orthogonal projector onto the invariant subspace for
+// the eigenvalues above sigma. An orthonormal basis [Q1,Q2] for the range of
+// the projector and its complement is then extracted from a QR factorization
+// of the projector applied to a random matrix, and the process recurses on
+// Q1^H A Q1 and Q2^H A Q2 until the subproblems fall below 'cutoff', where
+// a standard eigensolver is used.
+//
+// Every step consists of QR factorizations, Cholesky factorizations, and
+// matrix-matrix multiplications, so that there is no tridiagonal reduction
+// and its associated latency-bound level-2 operations, at the cost of
+// performing several times more flops.
+//
+// The shift, sigma, is the median of the diagonal of A, which is guaranteed
+// to lie within the spectrum. If the resulting split is not sufficiently
+// accurate, i.e., if || Q2^H A Q1 ||_F > n eps || A ||_F, it is retried
+// with slightly perturbed shifts before falling back to the standard
+// eigensolver for the subproblem.
+//
+
+namespace elem {
+namespace hermitian_eig {
+
+template<typename F>
+inline int
+QDWHSplit
+( const Matrix<F>& A, Matrix<F>& Q, Matrix<F>& ATL, Matrix<F>& ABR,
+  int numAttempts=3 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWHSplit");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    const R frobA = FrobeniusNorm( A );
+
+    Matrix<R> d;
+    A.GetRealPartOfDiagonal( d );
+    std::vector<R> diag( d.Buffer(), d.Buffer()+n );
+    std::sort( diag.begin(), diag.end() );
+    const R median = diag[n/2];
+
+    Matrix<F> I, B, P, AQ, E;
+    Identity( I, n, n );
+    for( int attempt=0; attempt<numAttempts; ++attempt )
+    {
+        // Perturb the shift on subsequent attempts in case it was a
+        // (nearly) repeated eigenvalue with a poorly-conditioned subspace
+        const R shift = median + attempt*Sqrt(eps)*frobA;
+        B = A;
+        Axpy( -shift, I, B );
+        const R upperBound = TwoNormUpperBound( B );
+        if( upperBound == R(0) )
+            return 0;
+        hermitian_polar::QDWH( LOWER, B, eps, upperBound );
+
+        // Form the projector, (U_p + I)/2, and its rank
+        P = I;
+        Axpy( F(1), B, P );
+        Scale( F(1)/F(2), P );
+        const int k = int( RealPart(Trace(P)) + R(1)/R(2) );
+        if( k == 0 || k == n )
+            continue;
+
+        // The first k columns of an orthogonalization of P Omega span the
+        // range of P, and the remaining columns span its complement
+        Matrix<F> Omega;
+        Uniform( Omega, n, n );
+        Gemm( NORMAL, NORMAL, F(1), P, Omega, Q );
+        qr::Explicit( Q );
+
+        Matrix<F> QL, QR, AQL, AQR;
+        Gemm( NORMAL, NORMAL, F(1), A, Q, AQ );
+        LockedView( QL, Q, 0, 0, n, k );
+        LockedView( QR, Q, 0, k, n, n-k );
+        LockedView( AQL, AQ, 0, 0, n, k );
+        LockedView( AQR, AQ, 0, k, n, n-k );
+        Gemm( ADJOINT, NORMAL, F(1), QR, AQL, E );
+        if( FrobeniusNorm( E ) > n*eps*frobA )
+            continue;
+        Gemm( ADJOINT, NORMAL, F(1), QL, AQL, ATL );
+        Gemm( ADJOINT, NORMAL, F(1), QR, AQR, ABR );
+        return k;
+    }
+    return 0;
+}
+
+template<typename F>
+inline int
+QDWHSplit
+( const DistMatrix<F>& A, DistMatrix<F>& Q,
+  DistMatrix<F>& ATL, DistMatrix<F>& ABR, int numAttempts=3 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWHSplit");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+    const R frobA = FrobeniusNorm( A );
+
+    DistMatrix<R,MD,STAR> d( g );
+    A.GetRealPartOfDiagonal( d );
+    DistMatrix<R,STAR,STAR> d_STAR_STAR( d );
+    std::vector<R> diag
+    ( d_STAR_STAR.LockedBuffer(), d_STAR_STAR.LockedBuffer()+n );
+    std::sort( diag.begin(), diag.end() );
+    const R median = diag[n/2];
+
+    DistMatrix<F> I( g ), B( g ), P( g ), AQ( g ), E( g );
+    Identity( I, n, n );
+    for( int attempt=0; attempt<numAttempts; ++attempt )
+    {
+        // Perturb the shift on subsequent attempts in case it was a
+        // (nearly) repeated eigenvalue with a poorly-conditioned subspace
+        const R shift = median + attempt*Sqrt(eps)*frobA;
+        B = A;
+        Axpy( -shift, I, B );
+        const R upperBound = TwoNormUpperBound( B );
+        if( upperBound == R(0) )
+            return 0;
+        hermitian_polar::QDWH( LOWER, B, eps, upperBound );
+
+        // Form the projector, (U_p + I)/2, and its rank
+        P = I;
+        Axpy( F(1), B, P );
+        Scale( F(1)/F(2), P );
+        const int k = int( RealPart(Trace(P)) + R(1)/R(2) );
+        if( k == 0 || k == n )
+            continue;
+
+        // The first k columns of an orthogonalization of P Omega span the
+        // range of P, and the remaining columns span its complement.
+        //
+        // Omega is drawn from a local random stream since the subproblems
+        // are solved on subgrids, and drawing from the distributed streams
+        // would leave the processes of different subgrids out of step.
+        // No entry of Omega is replicated, so the streams need not agree.
+        DistMatrix<F> Omega( n, n, g );
+        {
+            const RandomStream stream = NextLocalRandomStream();
+            const int colShift = Omega.ColShift();
+            const int rowShift = Omega.RowShift();
+            const int colStride = Omega.ColStride();
+            const int rowStride = Omega.RowStride();
+            const int localHeight = Omega.LocalHeight();
+            const int localWidth = Omega.LocalWidth();
+            for( int jLocal=0; jLocal<localWidth; ++jLocal )
+            {
+                const int j = rowShift + jLocal*rowStride;
+                for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                {
+                    const int i = colShift + iLocal*colStride;
+                    Omega.SetLocal
+                    ( iLocal, jLocal, stream.SampleUnitBall<F>(i,j) );
+                }
+            }
+        }
+        Gemm( NORMAL, NORMAL, F(1), P, Omega, Q );
+        qr::Explicit( Q );
+
+        DistMatrix<F> QL( g ), QR( g ), AQL( g ), AQR( g );
+        Gemm( NORMAL, NORMAL, F(1), A, Q, AQ );
+        LockedView( QL, Q, 0, 0, n, k );
+        LockedView( QR, Q, 0, k, n, n-k );
+        LockedView( AQL, AQ, 0, 0, n, k );
+        LockedView( AQR, AQ, 0, k, n, n-k );
+        Gemm( ADJOINT, NORMAL, F(1), QR, AQL, E );
+        if( FrobeniusNorm( E ) > n*eps*frobA )
+            continue;
+        Gemm( ADJOINT, NORMAL, F(1), QL, AQL, ATL );
+        Gemm( ADJOINT, NORMAL, F(1), QR, AQR, ABR );
+        return k;
+    }
+    return 0;
+}
+
+// A and w are overwritten with a full eigenvalue decomposition, A = Z W Z^H,
+// where both triangles of A must be stored and w is not sorted
+template<typename F>
+inline void
+QDWHRecursion( Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Z, int cutoff )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWHRecursion");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+
+    // Subproblems corresponding to repeated eigenvalues are (nearly)
+    // multiples of the identity and need not be split any further
+    const R mean = RealPart(Trace(A)) / n;
+    Matrix<F> B( A );
+    for( int j=0; j<n; ++j )
+        B.UpdateRealPart( j, j, -mean );
+    if( FrobeniusNorm( B ) <= n*eps*FrobeniusNorm( A ) )
+    {
+        w.ResizeTo( n, 1 );
+        for( int j=0; j<n; ++j )
+            w.Set( j, 0, mean );
+        Identity( Z, n, n );
+        return;
+    }
+    B.Empty();
+
+    Matrix<F> Q, ATL, ABR;
+    const int k = ( n > cutoff ? QDWHSplit( A, Q, ATL, ABR ) : 0 );
+    if( k == 0 )
+    {
+        HermitianEig( LOWER, A, w, Z );
+        return;
+    }
+    A.Empty();
+
+    Matrix<R> wT, wB;
+    Matrix<F> ZTL, ZBR;
+    QDWHRecursion( ATL, wT, ZTL, cutoff );
+    QDWHRecursion( ABR, wB, ZBR, cutoff );
+    w.ResizeTo( n, 1 );
+    MemCopy( w.Buffer(0,0), wT.LockedBuffer(), k );
+    MemCopy( w.Buffer(k,0), wB.LockedBuffer(), n-k );
+
+    // Z := [Q1 ZTL, Q2 ZBR]
+    Zeros( Z, n, n );
+    Matrix<F> QL, QR, ZL, ZR;
+    LockedView( QL, Q, 0, 0, n, k );
+    LockedView( QR, Q, 0, k, n, n-k );
+    View( ZL, Z, 0, 0, n, k );
+    View( ZR, Z, 0, k, n, n-k );
+    Gemm( NORMAL, NORMAL, F(1), QL, ZTL, F(0), ZL );
+    Gemm( NORMAL, NORMAL, F(1), QR, ZBR, F(0), ZR );
+}
+
+// Redundantly solve a small subproblem on each process
+template<typename F>
+inline void
+RedundantEig
+( DistMatrix<F>& A, DistMatrix<BASE(F),STAR,STAR>& w, DistMatrix<F>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::RedundantEig");
+#endif
+    const int n = A.Height();
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), Z_STAR_STAR( n, n, A.Grid() );
+    w.ResizeTo( n, 1 );
+    HermitianEig
+    ( LOWER, A_STAR_STAR.Matrix(), w.Matrix(), Z_STAR_STAR.Matrix() );
+    Z = Z_STAR_STAR;
+}
+
+// Subproblems above the cutoff which could not be split are handed to the
+// distributed (tridiagonal) eigensolver where one exists, and are otherwise
+// solved redundantly
+template<typename F>
+inline void
+DistributedEig
+( DistMatrix<F>& A, DistMatrix<BASE(F),STAR,STAR>& w, DistMatrix<F>& Z )
+{ RedundantEig( A, w, Z ); }
+
+#ifdef HAVE_PMRRR
+inline void
+DistributedEig
+( DistMatrix<double>& A, DistMatrix<double,STAR,STAR>& w, 
+  DistMatrix<double>& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::DistributedEig");
+#endif
+    DistMatrix<double,VR,STAR> w_VR_STAR( A.Grid() );
+    HermitianEig( LOWER, A, w_VR_STAR, Z );
+    w = w_VR_STAR;
+}
+
+inline void
+DistributedEig
+( DistMatrix<Complex<double> >& A, DistMatrix<double,STAR,STAR>& w, 
+  DistMatrix<Complex<double> >& Z )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::DistributedEig");
+#endif
+    DistMatrix<double,VR,STAR> w_VR_STAR( A.Grid() );
+    HermitianEig( LOWER, A, w_VR_STAR, Z );
+    w = w_VR_STAR;
+}
+#endif // ifdef HAVE_PMRRR
+
+template<typename F>
+inline void
+QDWHRecursion
+( DistMatrix<F>& A, DistMatrix<BASE(F),STAR,STAR>& w, DistMatrix<F>& Z,
+  int cutoff );
+
+// Solve the two decoupled subproblems, ATL and ABR, simultaneously on
+// disjoint subsets of the processes of their grid, which are sized in
+// proportion to the work required by each subproblem. Since redistributions
+// between different grids require the grids to share a viewing communicator,
+// the subgrids, as well as a 'bridge' grid which orders the processes
+// exactly as the original grid, are all viewed by the original grid's
+// processes; the bridge grid then simply views the local data of the
+// original grid.
+template<typename F>
+inline void
+QDWHSubgridRecursion
+( DistMatrix<F>& ATL, DistMatrix<F>& ABR, 
+  DistMatrix<BASE(F),STAR,STAR>& w, DistMatrix<F>& ZTL, DistMatrix<F>& ZBR,
+  int cutoff )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWHSubgridRecursion");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = ATL.Grid();
+    const int p = g.Size();
+    const int k = ATL.Height();
+    const int n = k + ABR.Height();
+
+    const double workTop = double(k)*double(k)*double(k);
+    const double workBottom = double(n-k)*double(n-k)*double(n-k);
+    int pTop = int( p*workTop/(workTop+workBottom) + 0.5 );
+    pTop = std::max( std::min( pTop, p-1 ), 1 );
+
+    mpi::Comm comm = g.Comm();
+    mpi::Group group, topGroup, bottomGroup;
+    mpi::CommGroup( comm, group );
+    std::vector<int> ranks( p );
+    for( int q=0; q<p; ++q )
+        ranks[q] = q;
+    mpi::GroupIncl( group, pTop, &ranks[0], topGroup );
+    mpi::GroupIncl( group, p-pTop, &ranks[pTop], bottomGroup );
+
+    ZTL.ResizeTo( k, k );
+    ZBR.ResizeTo( n-k, n-k );
+    std::vector<R> wBuffer( n, 0 );
+    {
+        const Grid bridgeGrid( comm, group, g.Height(), g.Width() );
+        const Grid topGrid( comm, topGroup );
+        const Grid bottomGrid( comm, bottomGroup );
+#ifndef RELEASE
+        if( bridgeGrid.VCRank() != g.VCRank() )
+            throw std::logic_error("Bridge grid was not ordered as expected");
+#endif
+
+        DistMatrix<F> ATL_Bridge( bridgeGrid ), ABR_Bridge( bridgeGrid ),
+                      ZTL_Bridge( bridgeGrid ), ZBR_Bridge( bridgeGrid );
+        ATL_Bridge.LockedAttach
+        ( k, k, ATL.ColAlignment(), ATL.RowAlignment(),
+          ATL.LockedBuffer(), ATL.LDim(), bridgeGrid );
+        ABR_Bridge.LockedAttach
+        ( n-k, n-k, ABR.ColAlignment(), ABR.RowAlignment(),
+          ABR.LockedBuffer(), ABR.LDim(), bridgeGrid );
+        ZTL_Bridge.Attach
+        ( k, k, ZTL.ColAlignment(), ZTL.RowAlignment(),
+          ZTL.Buffer(), ZTL.LDim(), bridgeGrid );
+        ZBR_Bridge.Attach
+        ( n-k, n-k, ZBR.ColAlignment(), ZBR.RowAlignment(),
+          ZBR.Buffer(), ZBR.LDim(), bridgeGrid );
+
+        DistMatrix<F> ATLSub( topGrid ), ZTLSub( k, k, topGrid ),
+                      ABRSub( bottomGrid ), ZBRSub( n-k, n-k, bottomGrid );
+        DistMatrix<R,STAR,STAR> wTSub( topGrid ), wBSub( bottomGrid );
+        ATLSub = ATL_Bridge;
+        ABRSub = ABR_Bridge;
+        ATL.Empty();
+        ABR.Empty();
+        if( topGrid.InGrid() )
+        {
+            QDWHRecursion( ATLSub, wTSub, ZTLSub, cutoff );
+            if( topGrid.Rank() == 0 )
+                MemCopy( &wBuffer[0], wTSub.LockedBuffer(), k );
+        }
+        else
+        {
+            QDWHRecursion( ABRSub, wBSub, ZBRSub, cutoff );
+            if( bottomGrid.Rank() == 0 )
+                MemCopy( &wBuffer[k], wBSub.LockedBuffer(), n-k );
+        }
+        ZTL_Bridge = ZTLSub;
+        ZBR_Bridge = ZBRSub;
+    }
+    mpi::GroupFree( bottomGroup );
+    mpi::GroupFree( topGroup );
+    mpi::GroupFree( group );
+
+    mpi::AllReduce( &wBuffer[0], n, mpi::SUM, comm );
+    w.ResizeTo( n, 1 );
+    MemCopy( w.Buffer(), &wBuffer[0], n );
+}
+
+template<typename F>
+inline void
+QDWHRecursion
+( DistMatrix<F>& A, DistMatrix<BASE(F),STAR,STAR>& w, DistMatrix<F>& Z,
+  int cutoff )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWHRecursion");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R eps = lapack::MachineEpsilon<R>();
+
+    // Subproblems corresponding to repeated eigenvalues are (nearly)
+    // multiples of the identity and need not be split any further
+    const R mean = RealPart(Trace(A)) / n;
+    DistMatrix<F> B( A ), I( g );
+    Identity( I, n, n );
+    Axpy( -mean, I, B );
+    I.Empty();
+    if( FrobeniusNorm( B ) <= n*eps*FrobeniusNorm( A ) )
+    {
+        w.ResizeTo( n, 1 );
+        for( int j=0; j<n; ++j )
+            w.SetLocal( j, 0, mean );
+        Identity( Z, n, n );
+        return;
+    }
+    B.Empty();
+
+    if( n <= cutoff )
+    {
+        RedundantEig( A, w, Z );
+        return;
+    }
+    DistMatrix<F> Q( g ), ATL( g ), ABR( g );
+    const int k = QDWHSplit( A, Q, ATL, ABR );
+    if( k == 0 )
+    {
+        DistributedEig( A, w, Z );
+        return;
+    }
+    A.Empty();
+
+    DistMatrix<F> ZTL( g ), ZBR( g );
+    if( g.Size() > 1 )
+    {
+        QDWHSubgridRecursion( ATL, ABR, w, ZTL, ZBR, cutoff );
+    }
+    else
+    {
+        DistMatrix<R,STAR,STAR> wT( g ), wB( g );
+        QDWHRecursion( ATL, wT, ZTL, cutoff );
+        QDWHRecursion( ABR, wB, ZBR, cutoff );
+        w.ResizeTo( n, 1 );
+        MemCopy( w.Buffer(0,0), wT.LockedBuffer(), k );
+        MemCopy( w.Buffer(k,0), wB.LockedBuffer(), n-k );
+    }
+
+    // Z := [Q1 ZTL, Q2 ZBR]
+    Zeros( Z, n, n );
+    DistMatrix<F> QL( g ), QR( g ), ZL( g ), ZR( g );
+    LockedView( QL, Q, 0, 0, n, k );
+    LockedView( QR, Q, 0, k, n, n-k );
+    View( ZL, Z, 0, 0, n, k );
+    View( ZR, Z, 0, k, n, n-k );
+    Gemm( NORMAL, NORMAL, F(1), QL, ZTL, F(0), ZL );
+    Gemm( NORMAL, NORMAL, F(1), QR, ZBR, F(0), ZR );
+}
+
+//
+// Overwrite w and Z with the eigenvalues, in ascending order, and the
+// eigenvectors of the Hermitian matrix A. A is destroyed.
+//
+
+template<typename F>
+inline void
+QDWH
+( UpperOrLower uplo, Matrix<F>& A, Matrix<BASE(F)>& w, Matrix<F>& Z,
+  int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWH");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( cutoff < 1 )
+        throw std::logic_error("Cutoff must be positive");
+#endif
+    if( A.Height() == 0 )
+    {
+        w.ResizeTo( 0, 1 );
+        Z.ResizeTo( 0, 0 );
+        return;
+    }
+    MakeHermitian( uplo, A );
+    QDWHRecursion( A, w, Z, cutoff );
+    Sort( w, Z );
+}
+
+template<typename F>
+inline void
+QDWH
+( UpperOrLower uplo, DistMatrix<F>& A,
+  DistMatrix<BASE(F),VR,STAR>& w, DistMatrix<F>& Z, int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_eig::QDWH");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( cutoff < 1 )
+        throw std::logic_error("Cutoff must be positive");
+#endif
+    typedef BASE(F) R;
+    if( A.Height() == 0 )
+    {
+        w.ResizeTo( 0, 1 );
+        Z.ResizeTo( 0, 0 );
+        return;
+    }
+    MakeHermitian( uplo, A );
+    DistMatrix<R,STAR,STAR> w_STAR_STAR( A.Grid() );
+    QDWHRecursion( A, w_STAR_STAR, Z, cutoff );
+    w = w_STAR_STAR;
+    Sort( w, Z );
+}
+
+} // namespace hermitian_eig
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANEIG_QDWH_HPP
@@ -11,9 +11,14 @@
 #define LAPACK_HERMITIANFUNCTION_HPP
 
 #include "elemental/blas-like/level1/DiagonalScale.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/blas-like/level1/MakeTrapezoidal.hpp"
 #include "elemental/blas-like/level3/Gemm.hpp"
 #include "elemental/lapack-like/HermitianEig.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+
+#include "elemental/lapack-like/HermitianFunction/Chebyshev.hpp"
 
 namespace elem {
 
@@ -341,6 +346,64 @@ RealHermitianFunction
 }
 #endif // ifdef HAVE_PMRRR
 
+//
+// Apply the real-valued function f to A using the selected method and return
+// the degree of the Chebyshev expansion (or zero for FUNCTION_EIG). The
+// Chebyshev expansion is formed over [-c,c], where c is an upper bound on the
+// two-norm of A; hermitian_function::Chebyshev may be called directly when 
+// tighter bounds on the spectrum are known.
+//
+
+template<typename F,class RealFunctor>
+inline int
+RealHermitianFunction
+( UpperOrLower uplo, Matrix<F>& A, const RealFunctor& f,
+  HermitianFunctionMethod method, int maxDegree=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RealHermitianFunction");
+#endif
+    typedef BASE(F) R;
+    if( method == FUNCTION_EIG )
+    {
+        RealHermitianFunction( uplo, A, f );
+        return 0;
+    }
+    MakeHermitian( uplo, A );
+    R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        normBound = 1;
+    return hermitian_function::Chebyshev
+           ( A, f, -normBound, normBound, maxDegree, progress );
+}
+
+template<typename F,class RealFunctor>
+inline int
+RealHermitianFunction
+( UpperOrLower uplo, DistMatrix<F>& A, const RealFunctor& f,
+  HermitianFunctionMethod method, int maxDegree=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RealHermitianFunction");
+#endif
+    typedef BASE(F) R;
+    if( method == FUNCTION_EIG )
+    {
+#ifdef HAVE_PMRRR
+        RealHermitianFunction( uplo, A, f );
+        return 0;
+#else
+        throw std::logic_error("FUNCTION_EIG requires PMRRR");
+#endif
+    }
+    MakeHermitian( uplo, A );
+    R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        normBound = 1;
+    return hermitian_function::Chebyshev
+           ( A, f, -normBound, normBound, maxDegree, progress );
+}
+
 //
 // Modify the eigenvalues of A with the complex-valued function f, which will
 // therefore result in a normal (in general, non-Hermitian) matrix, which we 
@@ -0,0 +1,201 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+#define LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Approximate f(A) by a truncated Chebyshev expansion of f over an interval
+// [lower,upper] which contains the spectrum of A,
+//     f(A) ~= c_0/2 I + sum_{k=1}^d c_k T_k(B),  B = (2 A - (upper+lower) I)
+//                                                    / (upper-lower),
+// which is evaluated with Clenshaw's recurrence using d matrix-matrix
+// multiplications. The coefficients are computed by Chebyshev-Gauss
+// quadrature with maxDegree+1 nodes, and the expansion is truncated after the
+// last coefficient whose magnitude exceeds the quadrature's rounding error,
+// (maxDegree+1) epsilon relative to the largest coefficient. If that is the
+// last computed coefficient, then f is not resolved by a polynomial of degree
+// maxDegree and an exception is thrown.
+//
+// The input must be Hermitian with both triangles explicitly stored, and the
+// degree of the expansion is returned. This approach is most efficient when f
+// is smooth over [lower,upper].
+//
+
+namespace elem {
+namespace hermitian_function {
+
+template<typename R,class RealFunctor>
+inline int
+ChebyshevCoefficients
+( const RealFunctor& f, R lower, R upper, int maxDegree,
+  std::vector<R>& coefficients, bool progress )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::ChebyshevCoefficients");
+#endif
+    const int numNodes = maxDegree+1;
+    const R center = (upper+lower)/2;
+    const R radius = (upper-lower)/2;
+    std::vector<R> fNodes( numNodes ), cosNodes( numNodes );
+    for( int j=0; j<numNodes; ++j )
+    {
+        const R theta = Pi*(j+R(1)/R(2))/numNodes;
+        cosNodes[j] = Cos(theta);
+        fNodes[j] = f( center+radius*cosNodes[j] );
+    }
+
+    // c_k = (2/N) sum_j f(x_j) cos(k theta_j), where cos(k theta_j) is
+    // generated by the three-term recurrence for T_k(cos(theta_j))
+    coefficients.resize( numNodes );
+    std::vector<R> TLast( numNodes, R(1) ), T( cosNodes ), TNext( numNodes );
+    for( int k=0; k<numNodes; ++k )
+    {
+        R sum = 0;
+        if( k == 0 )
+            for( int j=0; j<numNodes; ++j )
+                sum += fNodes[j];
+        else
+        {
+            for( int j=0; j<numNodes; ++j )
+                sum += fNodes[j]*T[j];
+            for( int j=0; j<numNodes; ++j )
+                TNext[j] = 2*cosNodes[j]*T[j] - TLast[j];
+            TLast.swap( T );
+            T.swap( TNext );
+        }
+        coefficients[k] = 2*sum/numNodes;
+    }
+
+    // Truncate after the last coefficient above the rounding-error floor
+    R maxCoeff = 0;
+    for( int k=0; k<numNodes; ++k )
+        maxCoeff = std::max( maxCoeff, Abs(coefficients[k]) );
+    const R tol = numNodes*lapack::MachineEpsilon<R>()*maxCoeff;
+    int degree = 0;
+    for( int k=0; k<numNodes; ++k )
+        if( Abs(coefficients[k]) > tol )
+            degree = k;
+    if( progress )
+        std::cout << "  Chebyshev expansion of degree " << degree << " with "
+                  << "|c_d| / max_k |c_k| = "
+                  << Abs(coefficients[degree])/maxCoeff << std::endl;
+    if( degree == maxDegree && maxDegree > 0 )
+        throw std::runtime_error
+        ("Chebyshev expansion did not converge; increase the maximum degree");
+    coefficients.resize( degree+1 );
+    return degree;
+}
+
+template<typename F,class RealFunctor>
+inline int
+Chebyshev
+( Matrix<F>& A, const RealFunctor& f, BASE(F) lower, BASE(F) upper,
+  int maxDegree=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::Chebyshev");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( lower >= upper )
+        throw std::logic_error("Invalid spectral interval");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    std::vector<R> c;
+    const int degree =
+        ChebyshevCoefficients( f, lower, upper, maxDegree, c, progress );
+
+    // Form B := (2 A - (upper+lower) I) / (upper-lower) in place
+    Matrix<F> I;
+    Identity( I, n, n );
+    Scale( 2/(upper-lower), A );
+    Axpy( -(upper+lower)/(upper-lower), I, A );
+
+    // Run Clenshaw's recurrence, b_k := 2 B b_{k+1} - b_{k+2} + c_k I
+    Matrix<F> b1, b2, b0;
+    Zeros( b1, n, n );
+    Zeros( b2, n, n );
+    for( int k=degree; k>=1; --k )
+    {
+        b0 = b2;
+        if( k < degree )
+            Gemm( NORMAL, NORMAL, F(2), A, b1, F(-1), b0 );
+        Axpy( c[k], I, b0 );
+        b2 = b1;
+        b1 = b0;
+    }
+
+    // f(A) ~= B b_1 - b_2 + c_0/2 I
+    b0 = b2;
+    Gemm( NORMAL, NORMAL, F(1), A, b1, F(-1), b0 );
+    Axpy( c[0]/2, I, b0 );
+    A = b0;
+    return degree;
+}
+
+template<typename F,class RealFunctor>
+inline int
+Chebyshev
+( DistMatrix<F>& A, const RealFunctor& f, BASE(F) lower, BASE(F) upper,
+  int maxDegree=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_function::Chebyshev");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+    if( lower >= upper )
+        throw std::logic_error("Invalid spectral interval");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    std::vector<R> c;
+    const int degree =
+        ChebyshevCoefficients
+        ( f, lower, upper, maxDegree, c, progress && g.Rank() == 0 );
+
+    // Form B := (2 A - (upper+lower) I) / (upper-lower) in place
+    DistMatrix<F> I( g );
+    Identity( I, n, n );
+    Scale( 2/(upper-lower), A );
+    Axpy( -(upper+lower)/(upper-lower), I, A );
+
+    // Run Clenshaw's recurrence, b_k := 2 B b_{k+1} - b_{k+2} + c_k I
+    DistMatrix<F> b1( g ), b2( g ), b0( g );
+    Zeros( b1, n, n );
+    Zeros( b2, n, n );
+    for( int k=degree; k>=1; --k )
+    {
+        b0 = b2;
+        if( k < degree )
+            Gemm( NORMAL, NORMAL, F(2), A, b1, F(-1), b0 );
+        Axpy( c[k], I, b0 );
+        b2 = b1;
+        b1 = b0;
+    }
+
+    // f(A) ~= B b_1 - b_2 + c_0/2 I
+    b0 = b2;
+    Gemm( NORMAL, NORMAL, F(1), A, b1, F(-1), b0 );
+    Axpy( c[0]/2, I, b0 );
+    A = b0;
+    return degree;
+}
+
+} // namespace hermitian_function
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANFUNCTION_CHEBYSHEV_HPP
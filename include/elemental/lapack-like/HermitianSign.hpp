@@ -11,8 +11,12 @@
 #define LAPACK_HERMITIANSIGN_HPP
 
 #include "elemental/lapack-like/HermitianFunction.hpp"
+#include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/lapack-like/Norm/Max.hpp"
 
+#include "elemental/lapack-like/HermitianSign/Newton.hpp"
+#include "elemental/lapack-like/HermitianSign/NewtonSchulz.hpp"
+
 namespace elem {
 
 //
@@ -95,6 +99,58 @@ HermitianSign( UpperOrLower uplo, DistMatrix<F>& A )
 }
 #endif // ifdef HAVE_PMRRR
 
+//
+// Compute the sign of A using the selected method and return the number of
+// iterations (or zero for SIGN_EIG). Unlike SIGN_EIG, the iterative methods
+// overwrite both triangles of A.
+//
+
+template<typename F>
+inline int
+HermitianSign
+( UpperOrLower uplo, Matrix<F>& A, HermitianSignMethod method,
+  int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSign");
+#endif
+    if( method == SIGN_EIG )
+    {
+        HermitianSign( uplo, A );
+        return 0;
+    }
+    MakeHermitian( uplo, A );
+    if( method == SIGN_NEWTON )
+        return hermitian_sign::Newton( A, maxIts, progress );
+    else
+        return hermitian_sign::NewtonSchulz( A, maxIts, progress );
+}
+
+template<typename F>
+inline int
+HermitianSign
+( UpperOrLower uplo, DistMatrix<F>& A, HermitianSignMethod method,
+  int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianSign");
+#endif
+    if( method == SIGN_EIG )
+    {
+#ifdef HAVE_PMRRR
+        HermitianSign( uplo, A );
+        return 0;
+#else
+        throw std::logic_error("SIGN_EIG requires PMRRR");
+#endif
+    }
+    MakeHermitian( uplo, A );
+    if( method == SIGN_NEWTON )
+        return hermitian_sign::Newton( A, maxIts, progress );
+    else
+        return hermitian_sign::NewtonSchulz( A, maxIts, progress );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_HERMITIANSIGN_HPP
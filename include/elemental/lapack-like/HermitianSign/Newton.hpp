@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANSIGN_NEWTON_HPP
+#define LAPACK_HERMITIANSIGN_NEWTON_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/Inverse.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+
+//
+// The scaled Newton iteration for the matrix sign function,
+//     X_{k+1} := (mu_k X_k + inv(mu_k X_k))/2,
+// with the Frobenius-norm scaling mu_k = sqrt(||inv(X_k)||_F/||X_k||_F),
+// which is disabled once the iteration enters its region of quadratic
+// convergence. See Chapter 5 of Higham's "Functions of Matrices".
+//
+// The input must be a nonsingular Hermitian matrix with both triangles
+// explicitly stored, and the number of iterations is returned.
+//
+
+namespace elem {
+namespace hermitian_sign {
+
+template<typename F>
+inline int
+Newton( Matrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_sign::Newton");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    int numIts = 0;
+    bool scale = true;
+    Matrix<F> AInv, ALast;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Newton sign iteration did not converge");
+        ++numIts;
+        ALast = A;
+        AInv = A;
+        Inverse( AInv );
+
+        const R mu = ( scale ? Sqrt(FrobeniusNorm(AInv)/FrobeniusNorm(A)) : 1 );
+        Scale( mu/2, A );
+        Axpy( 1/(2*mu), AInv, A );
+
+        Axpy( F(-1), A, ALast );
+        const R relChange = FrobeniusNorm( ALast ) / FrobeniusNorm( A );
+        if( progress )
+            std::cout << "  Newton sign iteration " << numIts
+                      << ": ||X_k - X_{k-1}||_F / ||X_k||_F = " << relChange
+                      << std::endl;
+        if( relChange < R(1)/R(100) )
+            scale = false;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+Newton( DistMatrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_sign::Newton");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    int numIts = 0;
+    bool scale = true;
+    DistMatrix<F> AInv( g ), ALast( g );
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error("Newton sign iteration did not converge");
+        ++numIts;
+        ALast = A;
+        AInv = A;
+        Inverse( AInv );
+
+        const R mu = ( scale ? Sqrt(FrobeniusNorm(AInv)/FrobeniusNorm(A)) : 1 );
+        Scale( mu/2, A );
+        Axpy( 1/(2*mu), AInv, A );
+
+        Axpy( F(-1), A, ALast );
+        const R relChange = FrobeniusNorm( ALast ) / FrobeniusNorm( A );
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Newton sign iteration " << numIts
+                      << ": ||X_k - X_{k-1}||_F / ||X_k||_F = " << relChange
+                      << std::endl;
+        if( relChange < R(1)/R(100) )
+            scale = false;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+} // namespace hermitian_sign
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANSIGN_NEWTON_HPP
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_HERMITIANSIGN_NEWTONSCHULZ_HPP
+#define LAPACK_HERMITIANSIGN_NEWTONSCHULZ_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/lapack-like/Norm/One.hpp"
+
+//
+// The inverse-free Newton-Schulz iteration for the matrix sign function,
+//     X_{k+1} := X_k (3 I - X_k^2)/2,
+// which only requires two matrix-matrix multiplications per step. It
+// converges for eigenvalues of magnitude less than sqrt(3), and so A is first
+// scaled by an upper bound on its two-norm. Convergence is quadratic once the
+// eigenvalues approach +-1, but an eigenvalue of magnitude delta, relative to
+// the two-norm, initially only grows by a factor of 3/2 per step, so that
+// roughly log_{3/2}(1/delta) steps are required. Eigenvalues which are exactly
+// zero are mapped to zero.
+//
+// The input must be Hermitian with both triangles explicitly stored, and the
+// number of iterations is returned.
+//
+
+namespace elem {
+namespace hermitian_sign {
+
+template<typename F>
+inline int
+NewtonSchulz( Matrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_sign::NewtonSchulz");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    // Both norms are upper bounds on the two-norm
+    const R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        return 0;
+    Scale( 1/normBound, A );
+
+    int numIts = 0;
+    Matrix<F> ASquared, ANew;
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Newton-Schulz sign iteration did not converge");
+        ++numIts;
+        Gemm( NORMAL, NORMAL, F(1), A, A, ASquared );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), A, ASquared, ANew );
+        Axpy( F(3)/F(2), A, ANew );
+
+        Axpy( F(-1), ANew, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( ANew );
+        A = ANew;
+        if( progress )
+            std::cout << "  Newton-Schulz sign iteration " << numIts
+                      << ": ||X_k - X_{k-1}||_F / ||X_k||_F = " << relChange
+                      << std::endl;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+template<typename F>
+inline int
+NewtonSchulz( DistMatrix<F>& A, int maxIts=100, bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("hermitian_sign::NewtonSchulz");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Height();
+    const R tol = Sqrt( n*lapack::MachineEpsilon<R>() );
+
+    // Both norms are upper bounds on the two-norm
+    const R normBound = std::min( OneNorm(A), FrobeniusNorm(A) );
+    if( normBound == R(0) )
+        return 0;
+    Scale( 1/normBound, A );
+
+    int numIts = 0;
+    DistMatrix<F> ASquared( g ), ANew( g );
+    while( true )
+    {
+        if( numIts >= maxIts )
+            throw std::runtime_error
+            ("Newton-Schulz sign iteration did not converge");
+        ++numIts;
+        Gemm( NORMAL, NORMAL, F(1), A, A, ASquared );
+        Gemm( NORMAL, NORMAL, F(-1)/F(2), A, ASquared, ANew );
+        Axpy( F(3)/F(2), A, ANew );
+
+        Axpy( F(-1), ANew, A );
+        const R relChange = FrobeniusNorm( A ) / FrobeniusNorm( ANew );
+        A = ANew;
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Newton-Schulz sign iteration " << numIts
+                      << ": ||X_k - X_{k-1}||_F / ||X_k||_F = " << relChange
+                      << std::endl;
+        if( relChange <= tol )
+            break;
+    }
+    return numIts;
+}
+
+} // namespace hermitian_sign
+} // namespace elem
+
+#endif // ifndef LAPACK_HERMITIANSIGN_NEWTONSCHULZ_HPP
@@ -10,7 +10,7 @@
 #ifndef LAPACK_ID_HPP
 #define LAPACK_ID_HPP
 
-#include "elemental/lapack-like/QR/BusingerGolub.hpp"
+#include "elemental/lapack-like/QR/Tournament.hpp"
 
 // TODO: Add detailed references to Tygert et al.'s ID package and the papers
 //       "Randomized algorithms for the low-rank approximation of matrices", 
@@ -84,21 +84,22 @@ PseudoTrsm( const DistMatrix<F>& RL, DistMatrix<F,STAR,VR>& RR, BASE(F) tol )
 // matrix, and p contains the pivots used during the iterations of 
 // pivoted QR. Either 'maxSteps' iterations are reached, or a pivot value less 
 // than or equal to tol times the original pivot value was found. 
-// The input matrix A is unchanged.
+// The input matrix A is overwritten by the pivoted QR factorization.
 
 template<typename F> 
 inline void
-BusingerGolub
-( Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, int maxSteps, BASE(F) tol )
+RankRevealing
+( Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, int maxSteps, BASE(F) tol,
+  RRQRMethod method=RRQR_BUSINGER_GOLUB )
 {
 #ifndef RELEASE
-    CallStackEntry entry("id::BusingerGolub");
+    CallStackEntry entry("id::RankRevealing");
 #endif
     typedef BASE(F) Real;
     const int n = A.Width();
 
     // Perform the pivoted QR factorization
-    qr::BusingerGolub( A, p, maxSteps, tol );
+    qr::RankRevealing( A, p, maxSteps, tol, method );
     const int numSteps = p.Height();
 
     Real pinvTol;
@@ -120,19 +121,19 @@ BusingerGolub
 
 template<typename F> 
 inline void
-BusingerGolub
+RankRevealing
 ( DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
-  int maxSteps, BASE(F) tol )
+  int maxSteps, BASE(F) tol, RRQRMethod method=RRQR_BUSINGER_GOLUB )
 {
 #ifndef RELEASE
-    CallStackEntry entry("id::BusingerGolub");
+    CallStackEntry entry("id::RankRevealing");
 #endif
     typedef BASE(F) Real;
     const Grid& g = A.Grid();
     const int n = A.Width();
 
-    // Perform the pivoted QR factorization on a copy of A
-    qr::BusingerGolub( A, p, maxSteps, tol );
+    // Perform the pivoted QR factorization
+    qr::RankRevealing( A, p, maxSteps, tol, method );
     const int numSteps = p.Height();
 
     Real pinvTol;
@@ -154,24 +155,40 @@ BusingerGolub
 
 } // namespace id
 
+// The pivoted QR factorizations may be selected with 'method'; the tournament
+// variants choose blocks of pivots at once and are preferable for large 
+// matrices (see qr::Tournament)
+
 template<typename F> 
 inline void
 ID
 ( const Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, 
-  int maxSteps, BASE(F) tol )
+  int maxSteps, BASE(F) tol, RRQRMethod method )
 {
 #ifndef RELEASE
     CallStackEntry entry("ID");
 #endif
     Matrix<F> B( A );
-    id::BusingerGolub( A, p, Z, maxSteps, tol );
+    id::RankRevealing( B, p, Z, maxSteps, tol, method );
+}
+
+template<typename F> 
+inline void
+ID
+( const Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, 
+  int maxSteps, BASE(F) tol )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, maxSteps, tol, RRQR_BUSINGER_GOLUB );
 }
 
 template<typename F> 
 inline void
 ID
 ( Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, 
-  int maxSteps, BASE(F) tol, bool canOverwrite=false )
+  int maxSteps, BASE(F) tol, RRQRMethod method, bool canOverwrite=false )
 {
 #ifndef RELEASE
     CallStackEntry entry("ID");
@@ -181,7 +198,31 @@ ID
         View( B, A );
     else
         B = A;
-    id::BusingerGolub( B, p, Z, maxSteps, tol );
+    id::RankRevealing( B, p, Z, maxSteps, tol, method );
+}
+
+template<typename F> 
+inline void
+ID
+( Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, 
+  int maxSteps, BASE(F) tol, bool canOverwrite=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, maxSteps, tol, RRQR_BUSINGER_GOLUB, canOverwrite );
+}
+
+template<typename F> 
+inline void
+ID
+( const Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, int numSteps,
+  RRQRMethod method )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, numSteps, BASE(F)(-1), method );
 }
 
 template<typename F> 
@@ -194,6 +235,18 @@ ID( const Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, int numSteps )
     ID( A, p, Z, numSteps, BASE(F)(-1) );
 }
 
+template<typename F> 
+inline void
+ID
+( Matrix<F>& A, Matrix<int>& p, Matrix<F>& Z, int numSteps, 
+  RRQRMethod method, bool canOverwrite=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, numSteps, BASE(F)(-1), method, canOverwrite );
+}
+
 template<typename F> 
 inline void
 ID
@@ -206,6 +259,20 @@ ID
     ID( A, p, Z, numSteps, BASE(F)(-1), canOverwrite );
 }
 
+template<typename F> 
+inline void
+ID
+( const DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
+  int maxSteps, BASE(F) tol, RRQRMethod method )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    DistMatrix<F> B( A.Grid() );
+    B = A;
+    id::RankRevealing( B, p, Z, maxSteps, tol, method );
+}
+
 template<typename F> 
 inline void
 ID
@@ -215,15 +282,14 @@ ID
 #ifndef RELEASE
     CallStackEntry entry("ID");
 #endif
-    DistMatrix<F> B( A );
-    id::BusingerGolub( A, p, Z, maxSteps, tol );
+    ID( A, p, Z, maxSteps, tol, RRQR_BUSINGER_GOLUB );
 }
 
 template<typename F> 
 inline void
 ID
 ( DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
-  int maxSteps, BASE(F) tol, bool canOverwrite=false )
+  int maxSteps, BASE(F) tol, RRQRMethod method, bool canOverwrite=false )
 {
 #ifndef RELEASE
     CallStackEntry entry("ID");
@@ -233,7 +299,31 @@ ID
         View( B, A );
     else
         B = A;
-    id::BusingerGolub( B, p, Z, maxSteps, tol );
+    id::RankRevealing( B, p, Z, maxSteps, tol, method );
+}
+
+template<typename F> 
+inline void
+ID
+( DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
+  int maxSteps, BASE(F) tol, bool canOverwrite=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, maxSteps, tol, RRQR_BUSINGER_GOLUB, canOverwrite );
+}
+
+template<typename F> 
+inline void
+ID
+( const DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
+  int numSteps, RRQRMethod method )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, numSteps, BASE(F)(-1), method );
 }
 
 template<typename F> 
@@ -248,6 +338,18 @@ ID
     ID( A, p, Z, numSteps, BASE(F)(-1) );
 }
 
+template<typename F> 
+inline void
+ID
+( DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, DistMatrix<F,STAR,VR>& Z, 
+  int numSteps, RRQRMethod method, bool canOverwrite=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("ID");
+#endif
+    ID( A, p, Z, numSteps, BASE(F)(-1), method, canOverwrite );
+}
+
 template<typename F> 
 inline void
 ID
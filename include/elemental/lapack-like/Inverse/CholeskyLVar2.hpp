@@ -121,7 +121,7 @@ CholeskyLVar2( DistMatrix<F>& A )
         A21_VR_STAR.AlignWith( A22 );
         A21Adj_STAR_MR.AlignWith( A22 );
         //--------------------------------------------------------------------//
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( LOWER, A11, A11_STAR_STAR );
         LocalCholesky( LOWER, A11_STAR_STAR );
 
         A10_STAR_VR = A10;
@@ -158,7 +158,7 @@ CholeskyLVar2( DistMatrix<F>& A )
 
         LocalTrtrmm( ADJOINT, LOWER, A11_STAR_STAR );
 
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( LOWER, A11_STAR_STAR, A11 );
         A10 = A10_STAR_VR;
         A21 = A21_VC_STAR;
         //--------------------------------------------------------------------//
@@ -122,7 +122,7 @@ CholeskyUVar2( DistMatrix<F>& A )
         A12_STAR_MR.AlignWith( A02 );
         A12_STAR_MC.AlignWith( A22 );
         //--------------------------------------------------------------------//
-        A11_STAR_STAR = A11;
+        RedistributeTriangle( UPPER, A11, A11_STAR_STAR );
         LocalCholesky( UPPER, A11_STAR_STAR );
 
         A01_VC_STAR = A01;
@@ -159,7 +159,7 @@ CholeskyUVar2( DistMatrix<F>& A )
 
         LocalTrtrmm( ADJOINT, UPPER, A11_STAR_STAR );
 
-        A11 = A11_STAR_STAR;
+        RedistributeTriangle( UPPER, A11_STAR_STAR, A11 );
         A01 = A01_VC_STAR;
         A12 = A12_STAR_VR;
         //--------------------------------------------------------------------//
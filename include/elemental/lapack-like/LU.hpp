@@ -16,6 +16,8 @@
 
 #include "elemental/lapack-like/LU/Local.hpp"
 #include "elemental/lapack-like/LU/Panel.hpp"
+#include "elemental/lapack-like/LU/Recursive.hpp"
+#include "elemental/lapack-like/LU/Tiled.hpp"
 
 #include "elemental/lapack-like/LU/SolveAfter.hpp"
 
@@ -40,37 +42,7 @@ LU( Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("LU");
 #endif
-    // Matrix views
-    Matrix<F>
-        ATL, ATR,  A00, A01, A02, 
-        ABL, ABR,  A10, A11, A12,  
-                   A20, A21, A22;
-
-    // Start the algorithm
-    PartitionDownDiagonal
-    ( A, ATL, ATR,
-         ABL, ABR, 0 );
-    while( ATL.Height() < A.Height() && ATL.Width() < A.Width() )
-    {
-        RepartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
-         /*************/ /******************/
-               /**/       A10, /**/ A11, A12,
-          ABL, /**/ ABR,  A20, /**/ A21, A22 );
-
-        //--------------------------------------------------------------------//
-        lu::Unb( A11 );
-        Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
-        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
-        Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
-        //--------------------------------------------------------------------//
-
-        SlidePartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
-               /**/       A10, A11, /**/ A12,
-         /*************/ /******************/
-          ABL, /**/ ABR,  A20, A21, /**/ A22 );
-    }
+    lu::Recursive( A );
 }
 
 template<typename F> 
@@ -155,69 +127,28 @@ LU( Matrix<F>& A, Matrix<int>& p )
         throw std::logic_error
         ("p must be a vector of the same height as the min dimension of A");
 #endif
+    const int m = A.Height();
+    const int n = A.Width();
     if( !p.Viewing() )
-        p.ResizeTo( std::min(A.Height(),A.Width()), 1 );
-
-    // Matrix views
-    Matrix<F>
-        ATL, ATR,  A00, A01, A02,  ABRL, ABRR,
-        ABL, ABR,  A10, A11, A12,  
-                   A20, A21, A22;
-
-    Matrix<int>
-        pT,  p0, 
-        pB,  p1,
-             p2;
-
-    // Pivot composition
-    std::vector<int> image, preimage;
-
-    // Start the algorithm
-    PartitionDownDiagonal
-    ( A, ATL, ATR,
-         ABL, ABR, 0 );
-    PartitionDown
-    ( p, pT,
-         pB, 0 );
-    while( ATL.Height() < A.Height() && ATL.Width() < A.Width() )
+        p.ResizeTo( std::min(m,n), 1 );
+    if( UseTaskGraph( std::min(m,n) ) )
     {
-        RepartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, /**/ A01, A02,
-         /*************/ /******************/
-               /**/       A10, /**/ A11, A12,
-          ABL, /**/ ABR,  A20, /**/ A21, A22 );
-
-        RepartitionDown
-        ( pT,  p0,
-         /**/ /**/
-               p1,
-          pB,  p2 );
-
-        PartitionRight( ABR, ABRL, ABRR, A11.Width() );
-
-        const int pivotOffset = A01.Height();
-        //--------------------------------------------------------------------//
-        lu::Panel( ABRL, p1, pivotOffset );
-        ComposePivots( p1, pivotOffset, image, preimage );
-        ApplyRowPivots( ABL, image, preimage );
-        ApplyRowPivots( ABRR, image, preimage );
-
-        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
-        Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
-        //--------------------------------------------------------------------//
-
-        SlidePartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, A01, /**/ A02,
-               /**/       A10, A11, /**/ A12,
-         /*************/ /******************/
-          ABL, /**/ ABR,  A20, A21, /**/ A22 );
-
-        SlidePartitionDown
-        ( pT,  p0,
-               p1,
-         /**/ /**/
-          pB,  p2 );
+        lu::Tiled( A, p );
+        return;
+    }
+    if( m >= n )
+    {
+        lu::RecursivePanel( A, p );
+        return;
     }
+
+    // Factor the leading square block and then solve for the remaining 
+    // columns of U
+    Matrix<F> AL, AR;
+    PartitionRight( A, AL, AR, m );
+    lu::RecursivePanel( AL, p );
+    lu::ApplyPanelPivots( AR, p, 0 );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), AL, AR );
 }
 
 template<typename F> 
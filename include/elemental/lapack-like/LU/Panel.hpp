@@ -25,66 +25,48 @@ Panel( Matrix<F>& A, Matrix<int>& p, int pivotOffset=0 )
     if( A.Width() != p.Height() || p.Width() != 1 )
         throw std::logic_error("p must be a vector that conforms with A");
 #endif
-    // Matrix views
-    Matrix<F> 
-        ATL, ATR,  A00, a01,     A02,  
-        ABL, ABR,  a10, alpha11, a12,  
-                   A20, a21,     A22;
-
+    const int height = A.Height();
     const int width = A.Width();
-    std::vector<F> buffer( width );
-
-    // Start the algorithm
-    PartitionDownDiagonal
-    ( A, ATL, ATR,
-         ABL, ABR, 0 );
-    while( ATL.Width() < A.Width() )
+    const int lda = A.LDim();
+    F* ABuffer = A.Buffer();
+    for( int j=0; j<width; ++j )
     {
-        RepartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, /**/ a01,     A02,
-         /*************/ /**********************/
-               /**/       a10, /**/ alpha11, a12,
-          ABL, /**/ ABR,  A20, /**/ a21,     A22, 1 );
+        F* RESTRICT aCol = &ABuffer[j*lda];
 
-        //--------------------------------------------------------------------//
-        const int currentRow = A00.Height();
-        
         // Find the index and value of the pivot candidate
-        F pivot = alpha11.Get(0,0);
-        int pivotRow = currentRow;
-        for( int i=0; i<a21.Height(); ++i )
+        F pivot = aCol[j];
+        int pivotRow = j;
+        for( int i=j+1; i<height; ++i )
         {
-            const F value = a21.Get(i,0);
-            if( FastAbs(value) > FastAbs(pivot) )
+            if( FastAbs(aCol[i]) > FastAbs(pivot) )
             {
-                pivot = value;
-                pivotRow = currentRow + i + 1;
+                pivot = aCol[i];
+                pivotRow = i;
             }
         }
-        p.Set( currentRow, 0, pivotRow+pivotOffset );
+        p.Set( j, 0, pivotRow+pivotOffset );
 
         // Swap the pivot row and current row
-        for( int j=0; j<width; ++j )
+        if( pivotRow != j )
         {
-            buffer[j] = A.Get(currentRow,j);
-            A.Set(currentRow,j,A.Get(pivotRow,j)); 
-            A.Set(pivotRow,j,buffer[j]);
+            for( int k=0; k<width; ++k )
+            {
+                const F temp = ABuffer[j+k*lda];
+                ABuffer[j+k*lda] = ABuffer[pivotRow+k*lda];
+                ABuffer[pivotRow+k*lda] = temp;
+            }
         }
 
         // Now we can perform the update of the current panel
-        const F alpha = alpha11.Get(0,0);
-        if( alpha == F(0) )
+        if( pivot == F(0) )
             throw SingularMatrixException();
-        const F alpha11Inv = F(1) / alpha;
-        Scale( alpha11Inv, a21 );
-        Geru( F(-1), a21, a12, A22 );
-        //--------------------------------------------------------------------//
-
-        SlidePartitionDownDiagonal
-        ( ATL, /**/ ATR,  A00, a01,     /**/ A02,
-               /**/       a10, alpha11, /**/ a12,
-         /*************/ /**********************/
-          ABL, /**/ ABR,  A20, a21,     /**/ A22 );
+        const F pivotInv = F(1) / pivot;
+        for( int i=j+1; i<height; ++i )
+            aCol[i] *= pivotInv;
+        blas::Geru
+        ( height-(j+1), width-(j+1),
+          F(-1), &aCol[j+1], 1, &ABuffer[j+(j+1)*lda], lda,
+                 &ABuffer[(j+1)+(j+1)*lda], lda );
     }
 }
 
@@ -0,0 +1,129 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LU_RECURSIVE_HPP
+#define LAPACK_LU_RECURSIVE_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/LU/Local.hpp"
+#include "elemental/lapack-like/LU/Panel.hpp"
+
+//
+// Cache-oblivious LU factorizations which split the (leading) columns in
+// half, factor the left half recursively, update the right half with a Trsm
+// and a Gemm, and then recurse on the trailing matrix. Nearly all of the
+// work is thus within large level 3 BLAS calls, regardless of Blocksize().
+//
+
+namespace elem {
+namespace lu {
+
+// The widest matrix which is directly factored with the unblocked kernel
+const int RECURSIVE_CUTOFF = 16;
+
+// LU without pivoting
+template<typename F>
+inline void
+Recursive( Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::Recursive");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    if( minDim <= RECURSIVE_CUTOFF )
+    {
+        Unb( A );
+        return;
+    }
+    const int n1 = minDim/2;
+    Matrix<F> A11, A12, A21, A22;
+    View( A11, A, 0,  0,  n1,   n1   );
+    View( A12, A, 0,  n1, n1,   n-n1 );
+    View( A21, A, n1, 0,  m-n1, n1   );
+    View( A22, A, n1, n1, m-n1, n-n1 );
+
+    Recursive( A11 );
+    Trsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11, A21 );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+    Recursive( A22 );
+}
+
+// Apply the sequence of row swaps (i,p(i)-pivotOffset) to A
+template<typename F>
+inline void
+ApplyPanelPivots( Matrix<F>& A, const Matrix<int>& p, int pivotOffset )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::ApplyPanelPivots");
+#endif
+    const int width = A.Width();
+    const int lda = A.LDim();
+    F* ABuffer = A.Buffer();
+    for( int i=0; i<p.Height(); ++i )
+    {
+        const int k = p.Get(i,0) - pivotOffset;
+        if( k == i )
+            continue;
+        for( int j=0; j<width; ++j )
+        {
+            const F temp = ABuffer[i+j*lda];
+            ABuffer[i+j*lda] = ABuffer[k+j*lda];
+            ABuffer[k+j*lda] = temp;
+        }
+    }
+}
+
+// LU with partial pivoting of a panel with at least as many rows as
+// columns, with the same pivot convention as lu::Panel
+template<typename F>
+inline void
+RecursivePanel( Matrix<F>& A, Matrix<int>& p, int pivotOffset=0 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::RecursivePanel");
+    if( A.Width() != p.Height() || p.Width() != 1 )
+        throw std::logic_error("p must be a vector that conforms with A");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("The panel must not be wider than it is tall");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    if( n <= RECURSIVE_CUTOFF )
+    {
+        Panel( A, p, pivotOffset );
+        return;
+    }
+    const int n1 = n/2;
+    Matrix<F> AL, AR, A11, A12, A21, A22;
+    Matrix<int> p1, p2;
+    View( AL,  A, 0,  0,  m,    n1   );
+    View( AR,  A, 0,  n1, m,    n-n1 );
+    View( A11, A, 0,  0,  n1,   n1   );
+    View( A12, A, 0,  n1, n1,   n-n1 );
+    View( A21, A, n1, 0,  m-n1, n1   );
+    View( A22, A, n1, n1, m-n1, n-n1 );
+    View( p1,  p, 0,  0,  n1,   1    );
+    View( p2,  p, n1, 0,  n-n1, 1    );
+
+    RecursivePanel( AL, p1, pivotOffset );
+    ApplyPanelPivots( AR, p1, pivotOffset );
+    Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11, A12 );
+    Gemm( NORMAL, NORMAL, F(-1), A21, A12, F(1), A22 );
+    RecursivePanel( A22, p2, pivotOffset+n1 );
+    ApplyPanelPivots( A21, p2, pivotOffset+n1 );
+}
+
+} // namespace lu
+} // namespace elem
+
+#endif // ifndef LAPACK_LU_RECURSIVE_HPP
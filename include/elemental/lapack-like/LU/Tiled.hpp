@@ -0,0 +1,164 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_LU_TILED_HPP
+#define LAPACK_LU_TILED_HPP
+
+#include "elemental/blas-like/level3/Tasks.hpp"
+#include "elemental/lapack-like/LU/Recursive.hpp"
+
+//
+// LU with partial pivoting as a TaskGraph over TileSize() x TileSize() tiles.
+// Each panel (tile column) is factored by a single task, after which the
+// pivots are applied to each of the other tile columns (followed by a Trsm
+// for those to the right) as separate tasks, and the trailing matrix is
+// updated with one Gemm per tile. Since the panel factorizations have the
+// highest priority, the factorization of the next panel begins as soon as its
+// tile column has been updated.
+//
+
+namespace elem {
+namespace lu {
+
+template<typename F>
+class PanelTask : public Task
+{
+public:
+    PanelTask( Matrix<F>& APan, Matrix<int>& p, int pivotOffset )
+    : pivotOffset_(pivotOffset)
+    { View( APan_, APan ); View( p_, p ); }
+
+    void Run()
+    { RecursivePanel( APan_, p_, pivotOffset_ ); }
+
+private:
+    int pivotOffset_;
+    Matrix<F> APan_;
+    Matrix<int> p_;
+};
+
+// Apply the pivots from a panel factorization to a block of columns and then,
+// if A11 is nonempty, overwrite the top of the block with inv(L11) times it
+template<typename F>
+class PivotTask : public Task
+{
+public:
+    PivotTask
+    ( const Matrix<int>& p, int pivotOffset, Matrix<F>& ABlock,
+      const Matrix<F>& A11 )
+    : pivotOffset_(pivotOffset)
+    { LockedView( p_, p ); View( ABlock_, ABlock ); LockedView( A11_, A11 ); }
+
+    void Run()
+    {
+        ApplyPanelPivots( ABlock_, p_, pivotOffset_ );
+        if( A11_.Height() != 0 )
+        {
+            Matrix<F> A12;
+            View( A12, ABlock_, 0, 0, A11_.Height(), ABlock_.Width() );
+            Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), A11_, A12 );
+        }
+    }
+
+private:
+    int pivotOffset_;
+    Matrix<int> p_;
+    Matrix<F> ABlock_, A11_;
+};
+
+template<typename F>
+inline void
+Tiled( Matrix<F>& A, Matrix<int>& p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("lu::Tiled");
+    if( p.Viewing() &&
+        (p.Height() != std::min(A.Height(),A.Width()) || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a vector of the same height as the min dimension of A");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    if( !p.Viewing() )
+        p.ResizeTo( minDim, 1 );
+
+    std::vector<int> rowOffsets, colOffsets;
+    TileOffsets( m, TileSize(), rowOffsets, minDim );
+    TileOffsets( n, TileSize(), colOffsets, minDim );
+    const int numRowTiles = rowOffsets.size()-1;
+    const int numColTiles = colOffsets.size()-1;
+    int numSteps = 0;
+    while( numSteps < numColTiles && colOffsets[numSteps] < minDim )
+        ++numSteps;
+    // The handle of the k'th set of pivots follows those of the tiles
+    const int pivotHandle = numRowTiles*numColTiles;
+
+    TaskGraph graph;
+    Matrix<F> APan, ABlock, A11, Aik, Akj, Aij, AEmpty;
+    Matrix<int> p1;
+    for( int k=0; k<numSteps; ++k )
+    {
+        const int priority = 3*(numSteps-k);
+        const int rowOffset = rowOffsets[k];
+        const int nb = colOffsets[k+1]-colOffsets[k];
+        View( APan, A, rowOffset, colOffsets[k], m-rowOffset, nb );
+        View( p1, p, colOffsets[k], 0, nb, 1 );
+        ViewTile( A11, A, rowOffsets, colOffsets, k, k );
+
+        graph.Add( new PanelTask<F>( APan, p1, rowOffset ), priority+2 );
+        for( int i=k; i<numRowTiles; ++i )
+            graph.Writes( i+k*numRowTiles );
+        graph.Writes( pivotHandle+k );
+
+        for( int j=0; j<numColTiles; ++j )
+        {
+            if( j == k )
+                continue;
+            View
+            ( ABlock, A, rowOffset, colOffsets[j],
+              m-rowOffset, colOffsets[j+1]-colOffsets[j] );
+            if( j < k )
+                graph.Add( new PivotTask<F>( p1, rowOffset, ABlock, AEmpty ) );
+            else
+            {
+                graph.Add
+                ( new PivotTask<F>( p1, rowOffset, ABlock, A11 ),
+                  ( j == k+1 ? priority+1 : priority ) );
+                graph.Reads( k+k*numRowTiles );
+            }
+            graph.Reads( pivotHandle+k );
+            for( int i=k; i<numRowTiles; ++i )
+                graph.Writes( i+j*numRowTiles );
+        }
+
+        for( int j=k+1; j<numColTiles; ++j )
+        {
+            ViewTile( Akj, A, rowOffsets, colOffsets, k, j );
+            for( int i=k+1; i<numRowTiles; ++i )
+            {
+                ViewTile( Aik, A, rowOffsets, colOffsets, i, k );
+                ViewTile( Aij, A, rowOffsets, colOffsets, i, j );
+                graph.Add
+                ( new GemmTask<F>
+                  ( NORMAL, NORMAL, F(-1), Aik, Akj, F(1), Aij ),
+                  ( j == k+1 ? priority+1 : priority ) );
+                graph.Reads( i+k*numRowTiles );
+                graph.Reads( k+j*numRowTiles );
+                graph.Writes( i+j*numRowTiles );
+            }
+        }
+    }
+    graph.Execute();
+}
+
+} // namespace lu
+} // namespace elem
+
+#endif // ifndef LAPACK_LU_TILED_HPP
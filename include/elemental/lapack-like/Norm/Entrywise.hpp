@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_ENTRYWISE_HPP
 #define LAPACK_NORM_ENTRYWISE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -20,14 +22,9 @@ EntrywiseNorm( const Matrix<F>& A, BASE(F) p )
     CallStackEntry entry("EntrywiseNorm");
 #endif
     // TODO: Make this more numerically stable
-    typedef BASE(F) R;
-    R sum = 0;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            sum += Pow( Abs(A.Get(i,j)), p );
-    return Pow( sum, 1/p );
+    entrywise::SumAbsPowReduction<F> sumAbsPow( p );
+    EntrywiseReduce( A, sumAbsPow );
+    return Pow( sumAbsPow.Result(), 1/p );
 }
 
 template<typename F>
@@ -95,18 +92,9 @@ EntrywiseNorm( const DistMatrix<F,U,V>& A, BASE(F) p )
 #ifndef RELEASE
     CallStackEntry entry("EntrywiseNorm");
 #endif
-    typedef BASE(F) R;
-    R localSum = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLocal=0; jLocal<localWidth; ++jLocal )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            localSum += Pow( Abs(A.GetLocal(iLocal,jLocal)), p ); 
-
-    R sum;
-    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, comm );
-    return Pow( sum, 1/p );
+    entrywise::SumAbsPowReduction<F> sumAbsPow( p );
+    EntrywiseReduce( A, sumAbsPow );
+    return Pow( sumAbsPow.Result(), 1/p );
 }
 
 template<typename F>
@@ -180,6 +168,56 @@ SymmetricEntrywiseNorm
     return HermitianEntrywiseNorm( uplo, A, p );
 }
 
+namespace entrywise_norm {
+
+// The sum of |A(i,j)|^p
+template<typename R>
+inline R
+SplitSum( const SplitMatrix<R>& A, R p )
+{
+    const R halfP = p/2;
+    R sum = 0;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT aRe = A.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT aIm = A.LockedImag().LockedBuffer(0,j);
+        for( int i=0; i<height; ++i )
+            sum += Pow( aRe[i]*aRe[i] + aIm[i]*aIm[i], halfP );
+    }
+    return sum;
+}
+
+} // namespace entrywise_norm
+
+template<typename R>
+inline R
+EntrywiseNorm( const SplitMatrix<R>& A, R p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseNorm");
+#endif
+    return Pow( entrywise_norm::SplitSum( A, p ), 1/p );
+}
+
+template<typename R,Distribution U,Distribution V>
+inline R
+EntrywiseNorm( const SplitDistMatrix<R,U,V>& A, R p )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseNorm");
+#endif
+    SplitMatrix<R> ALocal;
+    LockedLocalView( ALocal, A );
+    const R localSum = entrywise_norm::SplitSum( ALocal, p );
+
+    R sum;
+    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
+    mpi::AllReduce( &localSum, &sum, 1, mpi::SUM, comm );
+    return Pow( sum, 1/p );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_NORM_ENTRYWISE_HPP
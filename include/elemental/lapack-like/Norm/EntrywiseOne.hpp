@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_ENTRYWISEONE_HPP
 #define LAPACK_NORM_ENTRYWISEONE_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,14 +21,9 @@ EntrywiseOneNorm( const Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("EntrywiseOneNorm");
 #endif
-    typedef BASE(F) R;
-    R norm = 0;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-        for( int i=0; i<height; ++i )
-            norm += Abs(A.Get(i,j));
-    return norm;
+    entrywise::SumAbsReduction<F> sumAbs;
+    EntrywiseReduce( A, sumAbs );
+    return sumAbs.Result();
 }
 
 template<typename F>
@@ -91,18 +88,9 @@ EntrywiseOneNorm( const DistMatrix<F,U,V>& A )
 #ifndef RELEASE
     CallStackEntry entry("EntrywiseOneNorm");
 #endif
-    typedef BASE(F) R;
-    R localSum = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLocal=0; jLocal<localWidth; ++jLocal )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            localSum += Abs(A.GetLocal(iLocal,jLocal)); 
-
-    R norm;
-    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localSum, &norm, 1, mpi::SUM, comm );
-    return norm;
+    entrywise::SumAbsReduction<F> sumAbs;
+    EntrywiseReduce( A, sumAbs );
+    return sumAbs.Result();
 }
 
 template<typename F>
@@ -174,6 +162,43 @@ SymmetricEntrywiseOneNorm( UpperOrLower uplo, const DistMatrix<F,U,V>& A )
     return HermitianEntrywiseOneNorm( uplo, A );
 }
 
+template<typename R>
+inline R
+EntrywiseOneNorm( const SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseOneNorm");
+#endif
+    R norm = 0;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT aRe = A.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT aIm = A.LockedImag().LockedBuffer(0,j);
+        for( int i=0; i<height; ++i )
+            norm += Sqrt( aRe[i]*aRe[i] + aIm[i]*aIm[i] );
+    }
+    return norm;
+}
+
+template<typename R,Distribution U,Distribution V>
+inline R
+EntrywiseOneNorm( const SplitDistMatrix<R,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("EntrywiseOneNorm");
+#endif
+    SplitMatrix<R> ALocal;
+    LockedLocalView( ALocal, A );
+    const R localSum = EntrywiseOneNorm( ALocal );
+
+    R norm;
+    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
+    mpi::AllReduce( &localSum, &norm, 1, mpi::SUM, comm );
+    return norm;
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_NORM_ENTRYWISEONE_HPP
@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_FROBENIUS_HPP
 #define LAPACK_NORM_FROBENIUS_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,33 +21,9 @@ FrobeniusNorm( const Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("FrobeniusNorm");
 #endif
-    typedef BASE(F) R;
-    R scale = 0;
-    R scaledSquare = 1;
-    const int width = A.Width();
-    const int height = A.Height();
-    for( int j=0; j<width; ++j )
-    {
-        for( int i=0; i<height; ++i )
-        {
-            const R alphaAbs = Abs(A.Get(i,j));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= scale )
-                {
-                    const R relScale = alphaAbs/scale;
-                    scaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = scale/alphaAbs;
-                    scaledSquare = scaledSquare*relScale*relScale + 1;
-                    scale = alphaAbs;
-                }
-            }
-        }
-    }
-    return scale*Sqrt(scaledSquare);
+    entrywise::FrobeniusReduction<F> frobenius;
+    EntrywiseReduce( A, frobenius );
+    return frobenius.Result();
 }
 
 template<typename F>
@@ -161,51 +139,9 @@ FrobeniusNorm( const DistMatrix<F,U,V>& A )
 #ifndef RELEASE
     CallStackEntry entry("FrobeniusNorm");
 #endif
-    typedef BASE(F) R;
-    R localScale = 0;
-    R localScaledSquare = 1;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLocal=0; jLocal<localWidth; ++jLocal )
-    {
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-        {
-            const R alphaAbs = Abs(A.GetLocal(iLocal,jLocal));
-            if( alphaAbs != 0 )
-            {
-                if( alphaAbs <= localScale )
-                {
-                    const R relScale = alphaAbs/localScale;
-                    localScaledSquare += relScale*relScale;
-                }
-                else
-                {
-                    const R relScale = localScale/alphaAbs;
-                    localScaledSquare = localScaledSquare*relScale*relScale + 1;
-                    localScale = alphaAbs; 
-                }
-            }
-        }
-    }
-
-    // Find the maximum relative scale
-    R scale;
-    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localScale, &scale, 1, mpi::MAX, comm );
-
-    R norm = 0;
-    if( scale != 0 )
-    {
-        // Equilibrate our local scaled sum to the maximum scale
-        R relScale = localScale/scale;
-        localScaledSquare *= relScale*relScale;
-
-        // The scaled square is now simply the sum of the local contributions
-        R scaledSquare;
-        mpi::AllReduce( &localScaledSquare, &scaledSquare, 1, mpi::SUM, comm );
-        norm = scale*Sqrt(scaledSquare);
-    }
-    return norm;
+    entrywise::FrobeniusReduction<F> frobenius;
+    EntrywiseReduce( A, frobenius );
+    return frobenius.Result();
 }
 
 template<typename F>
@@ -331,6 +267,94 @@ SymmetricFrobeniusNorm( UpperOrLower uplo, const DistMatrix<F,U,V>& A )
     return HermitianFrobeniusNorm( uplo, A );
 }
 
+namespace frobenius_norm {
+
+// The largest magnitude of the real and imaginary parts of the entries of A
+template<typename R>
+inline R
+SplitMaxPart( const SplitMatrix<R>& A )
+{
+    R maxPart = 0;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT aRe = A.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT aIm = A.LockedImag().LockedBuffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            maxPart = std::max( maxPart, Abs(aRe[i]) );
+            maxPart = std::max( maxPart, Abs(aIm[i]) );
+        }
+    }
+    return maxPart;
+}
+
+// The sum of |A(i,j)/scale|^2, which is free of overflow as long as 'scale'
+// is at least the largest magnitude of the real and imaginary parts
+template<typename R>
+inline R
+SplitScaledSquare( const SplitMatrix<R>& A, R scale )
+{
+    const R invScale = 1/scale;
+    R scaledSquare = 0;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT aRe = A.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT aIm = A.LockedImag().LockedBuffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            const R re = invScale*aRe[i];
+            const R im = invScale*aIm[i];
+            scaledSquare += re*re + im*im;
+        }
+    }
+    return scaledSquare;
+}
+
+} // namespace frobenius_norm
+
+// Rather than updating the scale entry by entry (as above), the split versions
+// make two branch-free passes: one to find the scale and one to sum squares
+template<typename R>
+inline R
+FrobeniusNorm( const SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FrobeniusNorm");
+#endif
+    const R scale = frobenius_norm::SplitMaxPart( A );
+    if( scale == 0 )
+        return 0;
+    return scale*Sqrt(frobenius_norm::SplitScaledSquare( A, scale ));
+}
+
+template<typename R,Distribution U,Distribution V>
+inline R
+FrobeniusNorm( const SplitDistMatrix<R,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("FrobeniusNorm");
+#endif
+    SplitMatrix<R> ALocal;
+    LockedLocalView( ALocal, A );
+    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
+
+    const R localScale = frobenius_norm::SplitMaxPart( ALocal );
+    R scale;
+    mpi::AllReduce( &localScale, &scale, 1, mpi::MAX, comm );
+    if( scale == 0 )
+        return 0;
+
+    const R localScaledSquare =
+        frobenius_norm::SplitScaledSquare( ALocal, scale );
+    R scaledSquare;
+    mpi::AllReduce( &localScaledSquare, &scaledSquare, 1, mpi::SUM, comm );
+    return scale*Sqrt(scaledSquare);
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_NORM_FROBENIUS_HPP
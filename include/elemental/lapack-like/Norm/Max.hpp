@@ -10,6 +10,8 @@
 #ifndef LAPACK_NORM_MAX_HPP
 #define LAPACK_NORM_MAX_HPP
 
+#include "elemental/blas-like/level1/EntrywiseMap.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -19,19 +21,9 @@ MaxNorm( const Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("MaxNorm");
 #endif
-    typedef BASE(F) R;
-    R maxAbs = 0;
-    const int height = A.Height();
-    const int width = A.Width();
-    for( int j=0; j<width; ++j )
-    {
-        for( int i=0; i<height; ++i )
-        {
-            const R thisAbs = Abs(A.Get(i,j));
-            maxAbs = std::max( maxAbs, thisAbs );
-        }
-    }
-    return maxAbs;
+    entrywise::MaxAbsReduction<F> maxAbs;
+    EntrywiseReduce( A, maxAbs );
+    return maxAbs.Result();
 }
 
 template<typename F>
@@ -90,23 +82,9 @@ MaxNorm( const DistMatrix<F,U,V>& A )
 #ifndef RELEASE
     CallStackEntry entry("MaxNorm");
 #endif
-    typedef BASE(F) R;
-    R localMaxAbs = 0;
-    const int localHeight = A.LocalHeight();
-    const int localWidth = A.LocalWidth();
-    for( int jLocal=0; jLocal<localWidth; ++jLocal )
-    {
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-        {
-            const R thisAbs = Abs(A.GetLocal(iLocal,jLocal));
-            localMaxAbs = std::max( localMaxAbs, thisAbs );
-        }
-    }
-
-    R maxAbs;
-    mpi::Comm reduceComm = ReduceComm<U,V>( A.Grid() );
-    mpi::AllReduce( &localMaxAbs, &maxAbs, 1, mpi::MAX, reduceComm );
-    return maxAbs;
+    entrywise::MaxAbsReduction<F> maxAbs;
+    EntrywiseReduce( A, maxAbs );
+    return maxAbs.Result();
 }
 
 template<typename F>
@@ -170,6 +148,47 @@ SymmetricMaxNorm( UpperOrLower uplo, const DistMatrix<F>& A )
     return HermitianMaxNorm( uplo, A );
 }
 
+template<typename R>
+inline R
+MaxNorm( const SplitMatrix<R>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MaxNorm");
+#endif
+    // Maximize the squared magnitudes so that only one square root is needed
+    R maxAbsSquared = 0;
+    const int height = A.Height();
+    const int width = A.Width();
+    for( int j=0; j<width; ++j )
+    {
+        const R* RESTRICT aRe = A.LockedReal().LockedBuffer(0,j);
+        const R* RESTRICT aIm = A.LockedImag().LockedBuffer(0,j);
+        for( int i=0; i<height; ++i )
+        {
+            const R thisAbsSquared = aRe[i]*aRe[i] + aIm[i]*aIm[i];
+            maxAbsSquared = std::max( maxAbsSquared, thisAbsSquared );
+        }
+    }
+    return Sqrt(maxAbsSquared);
+}
+
+template<typename R,Distribution U,Distribution V>
+inline R
+MaxNorm( const SplitDistMatrix<R,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MaxNorm");
+#endif
+    SplitMatrix<R> ALocal;
+    LockedLocalView( ALocal, A );
+    const R localMaxAbs = MaxNorm( ALocal );
+
+    R maxAbs;
+    mpi::Comm comm = ReduceComm<U,V>( A.Grid() );
+    mpi::AllReduce( &localMaxAbs, &maxAbs, 1, mpi::MAX, comm );
+    return maxAbs;
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_NORM_MAX_HPP
@@ -0,0 +1,152 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_NORM_TWOESTIMATE_HPP
+#define LAPACK_NORM_TWOESTIMATE_HPP
+
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Estimate the two-norm with the power method applied to A^H A, in the
+// manner of MATLAB's normest: each step consists of a product with A and
+// with A^H, and ||A^H A x||_2 / ||A x||_2, for unit x, increases
+// monotonically towards ||A||_2. The iteration stops once the relative change
+// in the estimate is at most 'tol', so that the result is a lower bound which
+// is typically accurate to several digits after a few steps, as convergence
+// depends upon the gap between the two largest singular values.
+//
+// Since only products with A and A^H are required, A may also be any implicit
+// operator which provides Height(), Width(), and
+//
+//     Multiply( orientation, alpha, X, beta, Y ) for DistMatrix<F> X and Y,
+//
+// e.g., a HODLR matrix, a ToeplitzOperator, or a GeneratedOperator such as
+// HilbertOperator, so that the two-norm of a matrix which is never formed
+// can be estimated.
+//
+
+namespace elem {
+
+template<typename F>
+inline BASE(F)
+TwoNormEstimate( const Matrix<F>& A, BASE(F) tol=1e-6, int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TwoNormEstimate");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = A.Width();
+    if( m == 0 || n == 0 )
+        return R(0);
+
+    Matrix<F> x, y;
+    Uniform( x, n, 1 );
+    Scale( F(1)/FrobeniusNorm(x), x );
+    R estimate = 0;
+    for( int it=0; it<maxIts; ++it )
+    {
+        Zeros( y, m, 1 );
+        Gemv( NORMAL, F(1), A, x, F(0), y );
+        Zeros( x, n, 1 );
+        Gemv( ADJOINT, F(1), A, y, F(0), x );
+        const R xNorm = FrobeniusNorm( x );
+        const R yNorm = FrobeniusNorm( y );
+        if( xNorm == R(0) || yNorm == R(0) )
+            return R(0);
+        const R lastEstimate = estimate;
+        estimate = xNorm / yNorm;
+        if( Abs(estimate-lastEstimate) <= tol*estimate )
+            break;
+        Scale( F(1)/xNorm, x );
+    }
+    return estimate;
+}
+
+template<typename F>
+inline BASE(F)
+TwoNormEstimate( const DistMatrix<F>& A, BASE(F) tol=1e-6, int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TwoNormEstimate");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    if( m == 0 || n == 0 )
+        return R(0);
+
+    DistMatrix<F,VC,STAR> x( g ), y( g );
+    Uniform( x, n, 1 );
+    Scale( F(1)/FrobeniusNorm(x), x );
+    R estimate = 0;
+    for( int it=0; it<maxIts; ++it )
+    {
+        Zeros( y, m, 1 );
+        Gemv( NORMAL, F(1), A, x, F(0), y );
+        Zeros( x, n, 1 );
+        Gemv( ADJOINT, F(1), A, y, F(0), x );
+        const R xNorm = FrobeniusNorm( x );
+        const R yNorm = FrobeniusNorm( y );
+        if( xNorm == R(0) || yNorm == R(0) )
+            return R(0);
+        const R lastEstimate = estimate;
+        estimate = xNorm / yNorm;
+        if( Abs(estimate-lastEstimate) <= tol*estimate )
+            break;
+        Scale( F(1)/xNorm, x );
+    }
+    return estimate;
+}
+
+template<typename F,class Operator>
+inline BASE(F)
+TwoNormEstimate
+( const Operator& A, const Grid& g, BASE(F) tol=1e-6, int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TwoNormEstimate");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = A.Width();
+    if( m == 0 || n == 0 )
+        return R(0);
+
+    DistMatrix<F> x( g ), y( g );
+    Uniform( x, n, 1 );
+    Scale( F(1)/FrobeniusNorm(x), x );
+    R estimate = 0;
+    for( int it=0; it<maxIts; ++it )
+    {
+        Zeros( y, m, 1 );
+        A.Multiply( NORMAL, F(1), x, F(0), y );
+        Zeros( x, n, 1 );
+        A.Multiply( ADJOINT, F(1), y, F(0), x );
+        const R xNorm = FrobeniusNorm( x );
+        const R yNorm = FrobeniusNorm( y );
+        if( xNorm == R(0) || yNorm == R(0) )
+            return R(0);
+        const R lastEstimate = estimate;
+        estimate = xNorm / yNorm;
+        if( Abs(estimate-lastEstimate) <= tol*estimate )
+            break;
+        Scale( F(1)/xNorm, x );
+    }
+    return estimate;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_NORM_TWOESTIMATE_HPP
@@ -93,8 +93,8 @@ QDWH( Matrix<F>& A, BASE(F) lowerBound, BASE(F) upperBound )
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
@@ -187,8 +187,8 @@ QDWH( DistMatrix<F>& A, BASE(F) lowerBound, BASE(F) upperBound )
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
@@ -283,8 +283,8 @@ QDWH( UpperOrLower uplo, Matrix<F>& A, BASE(F) lowerBound, BASE(F) upperBound )
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
@@ -384,8 +384,8 @@ QDWH
         const R a = (sqd + Sqrt( arg )/2).real;
         const R b = (a-1)*(a-1)/4;
         const R c = a+b-1;
-        const Complex<R> alpha = a-b/c;
-        const Complex<R> beta = b/c;
+        const F alpha = a-b/c;
+        const F beta = b/c;
 
         lowerBound = lowerBound*(a+b*L2)/(1+c*L2);
 
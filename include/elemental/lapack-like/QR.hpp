@@ -13,7 +13,9 @@
 #include "elemental/lapack-like/QR/BusingerGolub.hpp"
 #include "elemental/lapack-like/QR/Cholesky.hpp"
 #include "elemental/lapack-like/QR/Householder.hpp"
+#include "elemental/lapack-like/QR/Tiled.hpp"
 #include "elemental/lapack-like/QR/Explicit.hpp"
+#include "elemental/lapack-like/QR/Tournament.hpp"
 
 namespace elem {
 
@@ -35,7 +37,10 @@ QR( Matrix<Real>& A )
 #ifndef RELEASE
     CallStackEntry entry("QR");
 #endif
-    qr::Householder( A );
+    if( UseTaskGraph( std::min(A.Height(),A.Width()) ) )
+        qr::Tiled( A );
+    else
+        qr::Householder( A );
 }
 
 template<typename Real> 
@@ -56,7 +61,10 @@ QR( Matrix<Complex<Real> >& A,
 #ifndef RELEASE
     CallStackEntry entry("QR");
 #endif
-    qr::Householder( A, t );
+    if( UseTaskGraph( std::min(A.Height(),A.Width()) ) )
+        qr::Tiled( A, t );
+    else
+        qr::Householder( A, t );
 }
 
 template<typename Real> 
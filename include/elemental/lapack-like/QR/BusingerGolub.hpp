@@ -727,8 +727,11 @@ BusingerGolub
                     norms[jLocal] *= Sqrt(gamma);
             }
         }
-        // Step 2: Compute the replacement norms and also reset origNorms
-        ReplaceColumnNorms( A, inaccurateNorms, norms, origNorms );
+        // Step 2: Compute the replacement norms from the rows below the 
+        //         pivot and also reset origNorms
+        DistMatrix<Real> ABottom(g);
+        View( ABottom, A, col+1, 0, m-(col+1), n );
+        ReplaceColumnNorms( ABottom, inaccurateNorms, norms, origNorms );
         //--------------------------------------------------------------------//
         aLeftCol_MC_STAR.FreeAlignments();
         z_MR_STAR.FreeAlignments();
@@ -945,8 +948,11 @@ BusingerGolub
                     norms[jLocal] *= Sqrt(gamma);
             }
         }
-        // Step 2: Compute the replacement norms and also reset origNorms
-        ReplaceColumnNorms( A, inaccurateNorms, norms, origNorms );
+        // Step 2: Compute the replacement norms from the rows below the 
+        //         pivot and also reset origNorms
+        DistMatrix<C> ABottom(g);
+        View( ABottom, A, col+1, 0, m-(col+1), n );
+        ReplaceColumnNorms( ABottom, inaccurateNorms, norms, origNorms );
         //--------------------------------------------------------------------//
         aLeftCol_MC_STAR.FreeAlignments();
         z_MR_STAR.FreeAlignments();
@@ -0,0 +1,150 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_QR_TILED_HPP
+#define LAPACK_QR_TILED_HPP
+
+#include "elemental/blas-like/level3/Tasks.hpp"
+#include "elemental/lapack-like/ApplyPackedReflectors.hpp"
+#include "elemental/lapack-like/QR/PanelHouseholder.hpp"
+
+//
+// Householder QR as a TaskGraph over tile columns of width TileSize(): each
+// panel is factored by a single task, and its reflectors are then applied to
+// each of the tile columns to its right as separate tasks. The factorization
+// of the next panel therefore overlaps with the remaining updates from the
+// previous panels. The result is identical in form to that of
+// qr::Householder.
+//
+
+namespace elem {
+namespace qr {
+
+template<typename F>
+class PanelTask : public Task
+{
+public:
+    PanelTask( Matrix<F>& APan, Matrix<F>& t )
+    { View( APan_, APan ); View( t_, t ); }
+
+    void Run()
+    { Panel( APan_, t_ ); }
+
+private:
+    Matrix<F> APan_, t_;
+
+    template<typename Real>
+    static void Panel( Matrix<Real>& APan, Matrix<Real>& t )
+    { PanelHouseholder( APan ); }
+
+    template<typename Real>
+    static void Panel
+    ( Matrix<Complex<Real> >& APan, Matrix<Complex<Real> >& t )
+    { PanelHouseholder( APan, t ); }
+};
+
+template<typename F>
+class ApplyTask : public Task
+{
+public:
+    ApplyTask( const Matrix<F>& APan, const Matrix<F>& t, Matrix<F>& ABlock )
+    { LockedView( APan_, APan ); LockedView( t_, t ); View( ABlock_, ABlock ); }
+
+    void Run()
+    { Apply( APan_, t_, ABlock_ ); }
+
+private:
+    Matrix<F> APan_, t_, ABlock_;
+
+    template<typename Real>
+    static void Apply
+    ( const Matrix<Real>& APan, const Matrix<Real>& t, Matrix<Real>& ABlock )
+    {
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, 0, APan, ABlock );
+    }
+
+    template<typename Real>
+    static void Apply
+    ( const Matrix<Complex<Real> >& APan, const Matrix<Complex<Real> >& t,
+      Matrix<Complex<Real> >& ABlock )
+    {
+        ApplyPackedReflectors
+        ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, APan, t, ABlock );
+    }
+};
+
+// Since real Householder transforms do not require t, it is left empty
+template<typename F>
+inline void
+Tiled( Matrix<F>& A, Matrix<F>& t )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tiled");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int minDim = std::min(m,n);
+    const bool complex = IsComplex<F>::val;
+    if( complex )
+        t.ResizeTo( minDim, 1 );
+
+    std::vector<int> colOffsets;
+    TileOffsets( n, TileSize(), colOffsets, minDim );
+    const int numColTiles = colOffsets.size()-1;
+    int numSteps = 0;
+    while( numSteps < numColTiles && colOffsets[numSteps] < minDim )
+        ++numSteps;
+
+    // Since each task updates entire tile columns (below the diagonal), the
+    // handles are simply the tile column indices
+    TaskGraph graph;
+    Matrix<F> APan, ABlock, t1;
+    for( int k=0; k<numSteps; ++k )
+    {
+        const int priority = 2*(numSteps-k);
+        const int offset = colOffsets[k];
+        const int nb = colOffsets[k+1]-offset;
+        View( APan, A, offset, offset, m-offset, nb );
+        if( complex )
+            View( t1, t, offset, 0, nb, 1 );
+
+        graph.Add( new PanelTask<F>( APan, t1 ), priority+1 );
+        graph.Writes( k );
+
+        for( int j=k+1; j<numColTiles; ++j )
+        {
+            View
+            ( ABlock, A, offset, colOffsets[j],
+              m-offset, colOffsets[j+1]-colOffsets[j] );
+            graph.Add
+            ( new ApplyTask<F>( APan, t1, ABlock ),
+              ( j == k+1 ? priority+1 : priority ) );
+            graph.Reads( k );
+            graph.Writes( j );
+        }
+    }
+    graph.Execute();
+}
+
+template<typename Real>
+inline void
+Tiled( Matrix<Real>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tiled");
+#endif
+    Matrix<Real> t;
+    Tiled( A, t );
+}
+
+} // namespace qr
+} // namespace elem
+
+#endif // ifndef LAPACK_QR_TILED_HPP
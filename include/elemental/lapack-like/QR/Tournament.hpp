@@ -0,0 +1,764 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_QR_TOURNAMENT_HPP
+#define LAPACK_QR_TOURNAMENT_HPP
+
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/ApplyColumnPivots.hpp"
+#include "elemental/lapack-like/QR/BusingerGolub.hpp"
+#include "elemental/lapack-like/QR/Householder.hpp"
+#include "elemental/matrices/Identity.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Blocked rank-revealing QR with tournament pivoting, as in Demmel, Grigori,
+// Gu, and Xiang's "Communication avoiding rank revealing QR factorization with
+// column pivoting". Rather than searching for a single pivot column per step,
+// each panel of Blocksize() pivots is chosen from the trailing matrix with a
+// reduction tree whose nodes run a pivoted QR on the R factor of (at most)
+// twice as many candidate columns and keep the best half. The selected columns
+// are then moved to the front and factored with an unpivoted Householder panel
+// followed by a Level 3 update of the trailing matrix.
+//
+// In the distributed case, the leaves of the tree are the local columns of
+// each process column, and the R factors of all of the nodes on a level of
+// the tree are formed at once by stacking the R factors of the local rows, so
+// that each level only requires a single AllGather within process columns.
+// The winners from each process column are then combined with a single
+// AllGather within process rows.
+//
+// If 'strong' is true, the selection at each node is refined with the column
+// exchanges of Gu and Eisenstat's strong RRQR until no exchange could increase
+// |det(R11)| by more than a factor of two, which bounds the entries of
+// inv(R11) R12.
+//
+// On exit, A and p (and t) have the same meaning as for qr::BusingerGolub, and
+// the factorization is stopped early once a pivot has a magnitude less than or
+// equal to tol times the maximum original column norm.
+//
+
+namespace elem {
+namespace qr {
+namespace tournament {
+
+template<typename Real>
+inline void
+UnpivotedQR( Matrix<Real>& A )
+{ Householder( A ); }
+
+template<typename Real>
+inline void
+UnpivotedQR( Matrix<Complex<Real> >& A )
+{
+    Matrix<Complex<Real> > t;
+    Householder( A, t );
+}
+
+// Form the square upper-triangular factor R of the columns of B, padding with
+// zeros if B has fewer rows than columns
+template<typename F>
+inline void
+TriangularFactor( const Matrix<F>& B, Matrix<F>& R )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::TriangularFactor");
+#endif
+    const int m = B.Height();
+    const int s = B.Width();
+    Matrix<F> BCopy( B );
+    UnpivotedQR( BCopy );
+    Zeros( R, s, s );
+    for( int j=0; j<s; ++j )
+    {
+        const int height = std::min(j+1,m);
+        for( int i=0; i<height; ++i )
+            R.Set( i, j, BCopy.Get(i,j) );
+    }
+}
+
+// The R factors of the local rows are already the R factors of the nodes
+class SequentialReducer
+{
+public:
+    template<typename F>
+    void operator()( std::vector<Matrix<F> >& Rs ) const { }
+};
+
+// Replace the R factors of the local rows with those of the rows owned by the
+// entire communicator
+class ColumnReducer
+{
+public:
+    ColumnReducer( mpi::Comm comm ) : comm_(comm) { }
+
+    template<typename F>
+    void operator()( std::vector<Matrix<F> >& Rs ) const
+    {
+#ifndef RELEASE
+        CallStackEntry entry("qr::tournament::ColumnReducer");
+#endif
+        const int commSize = mpi::CommSize( comm_ );
+        const int numNodes = Rs.size();
+        int totalSize = 0;
+        for( int k=0; k<numNodes; ++k )
+            totalSize += Rs[k].Width()*Rs[k].Width();
+        if( commSize == 1 || totalSize == 0 )
+            return;
+
+        std::vector<F> sendBuf( totalSize ), recvBuf( commSize*totalSize );
+        int offset = 0;
+        for( int k=0; k<numNodes; ++k )
+        {
+            const int s = Rs[k].Width();
+            for( int j=0; j<s; ++j )
+                MemCopy( &sendBuf[offset+j*s], Rs[k].LockedBuffer(0,j), s );
+            offset += s*s;
+        }
+        mpi::AllGather
+        ( &sendBuf[0], totalSize, &recvBuf[0], totalSize, comm_ );
+
+        Matrix<F> stacked;
+        offset = 0;
+        for( int k=0; k<numNodes; ++k )
+        {
+            const int s = Rs[k].Width();
+            stacked.ResizeTo( commSize*s, s );
+            for( int q=0; q<commSize; ++q )
+                for( int j=0; j<s; ++j )
+                    MemCopy
+                    ( stacked.Buffer(q*s,j),
+                      &recvBuf[q*totalSize+offset+j*s], s );
+            TriangularFactor( stacked, Rs[k] );
+            offset += s*s;
+        }
+    }
+
+private:
+    mpi::Comm comm_;
+};
+
+// Given the R factor of the columns 'order', exchange the selected columns
+// (the first k) with the remaining ones until no exchange can increase
+// |det(R11)| by more than a factor of f. On exit, T holds the R factor of
+// the reordered columns.
+template<typename F>
+inline void
+StrongExchanges
+( const Matrix<F>& R, int k, std::vector<int>& order, Matrix<F>& T )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::StrongExchanges");
+#endif
+    typedef BASE(F) Real;
+    const Real f = 2;
+    const int s = R.Width();
+    const int maxExchanges = s*s;
+    Matrix<F> RPerm( s, s ), R11, R12, R22, W, R11Inv;
+    std::vector<Real> rowNorms( k ), colNorms( s-k );
+    for( int it=0; it<=maxExchanges; ++it )
+    {
+        for( int j=0; j<s; ++j )
+            MemCopy( RPerm.Buffer(0,j), R.LockedBuffer(0,order[j]), s );
+        TriangularFactor( RPerm, T );
+        if( it == maxExchanges )
+            break;
+        for( int i=0; i<k; ++i )
+            if( T.Get(i,i) == F(0) )
+                return;
+        LockedView( R11, T, 0, 0, k, k );
+        LockedView( R12, T, 0, k, k, s-k );
+        LockedView( R22, T, k, k, s-k, s-k );
+
+        // The exchange of columns i and k+j scales |det(R11)| by
+        //   sqrt( |(inv(R11) R12)_{i,j}|^2 + ||R22 e_j||^2 ||e_i^T inv(R11)||^2 )
+        W = R12;
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, W );
+        Identity( R11Inv, k, k );
+        Trsm( LEFT, UPPER, NORMAL, NON_UNIT, F(1), R11, R11Inv );
+        for( int i=0; i<k; ++i )
+        {
+            rowNorms[i] = 0;
+            for( int j=i; j<k; ++j )
+            {
+                const Real alphaAbs = Abs(R11Inv.Get(i,j));
+                rowNorms[i] += alphaAbs*alphaAbs;
+            }
+        }
+        for( int j=0; j<s-k; ++j )
+        {
+            const Real gamma = blas::Nrm2( s-k, R22.LockedBuffer(0,j), 1 );
+            colNorms[j] = gamma*gamma;
+        }
+        Real maxGrowth = 0;
+        int iMax = 0, jMax = 0;
+        for( int j=0; j<s-k; ++j )
+        {
+            for( int i=0; i<k; ++i )
+            {
+                const Real omega = Abs(W.Get(i,j));
+                const Real growth = omega*omega + colNorms[j]*rowNorms[i];
+                if( growth > maxGrowth )
+                {
+                    maxGrowth = growth;
+                    iMax = i;
+                    jMax = j;
+                }
+            }
+        }
+        if( maxGrowth <= f*f )
+            break;
+        std::swap( order[iMax], order[k+jMax] );
+    }
+}
+
+// Choose (at most) b columns of the R factor of a node of the tournament, in
+// the order they should be pivoted, and return the magnitudes of the diagonal
+// of the R factor of the chosen columns
+template<typename F>
+inline void
+SelectColumns
+( const Matrix<F>& R, int b, bool strong,
+  std::vector<int>& order, std::vector<BASE(F)>& diag )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::SelectColumns");
+#endif
+    const int s = R.Width();
+    const int k = std::min( b, s );
+    order.resize( s );
+    for( int j=0; j<s; ++j )
+        order[j] = j;
+    diag.resize( k );
+    if( k == 0 )
+        return;
+
+    Matrix<F> T( R );
+    Matrix<int> p;
+    BusingerGolub( T, p, k );
+    const int numPivots = p.Height();
+    for( int j=0; j<numPivots; ++j )
+        std::swap( order[j], order[p.Get(j,0)] );
+    if( strong && k < s )
+        StrongExchanges( R, k, order, T );
+
+    order.resize( k );
+    for( int j=0; j<k; ++j )
+        diag[j] = Abs(T.Get(j,j));
+}
+
+// Play one round of the tournament: the columns of C (which may only be the
+// locally-owned rows) are split into the groups [offsets[i],offsets[i+1]),
+// pairs of consecutive groups form the nodes of this level, and the winners
+// of each node are copied into CNew
+template<typename F,class Reducer>
+inline void
+PlayRound
+( const Matrix<F>& C,
+  const std::vector<int>& indices, const std::vector<int>& offsets,
+  int b, bool strong, const Reducer& reduce,
+  Matrix<F>& CNew, std::vector<int>& newIndices, std::vector<int>& newOffsets,
+  std::vector<BASE(F)>& diag )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::PlayRound");
+#endif
+    const int mLocal = C.Height();
+    const int numGroups = offsets.size()-1;
+    const int numNodes = (numGroups+1)/2;
+
+    std::vector<Matrix<F> > Rs( numNodes );
+    Matrix<F> CNode;
+    for( int k=0; k<numNodes; ++k )
+    {
+        const int first = offsets[2*k];
+        const int last = offsets[std::min(2*k+2,numGroups)];
+        LockedView( CNode, C, 0, first, mLocal, last-first );
+        TriangularFactor( CNode, Rs[k] );
+    }
+    reduce( Rs );
+
+    std::vector<std::vector<int> > orders( numNodes );
+    newOffsets.resize( numNodes+1 );
+    newOffsets[0] = 0;
+    for( int k=0; k<numNodes; ++k )
+    {
+        SelectColumns( Rs[k], b, strong, orders[k], diag );
+        newOffsets[k+1] = newOffsets[k] + orders[k].size();
+    }
+
+    const int numWinners = newOffsets[numNodes];
+    CNew.ResizeTo( mLocal, numWinners );
+    newIndices.resize( numWinners );
+    for( int k=0; k<numNodes; ++k )
+    {
+        const int first = offsets[2*k];
+        const int numNodeWinners = orders[k].size();
+        for( int j=0; j<numNodeWinners; ++j )
+        {
+            const int jOld = first + orders[k][j];
+            const int jNew = newOffsets[k] + j;
+            MemCopy( CNew.Buffer(0,jNew), C.LockedBuffer(0,jOld), mLocal );
+            newIndices[jNew] = indices[jOld];
+        }
+    }
+}
+
+// Play rounds until a single group of winners remains (at least one round is
+// always played so that the winners are ordered and 'diag' is filled)
+template<typename F,class Reducer>
+inline void
+PlayTournament
+( const Matrix<F>& CInit, std::vector<int>& indices, std::vector<int>& offsets,
+  int b, bool strong, const Reducer& reduce,
+  Matrix<F>& C, std::vector<BASE(F)>& diag )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::PlayTournament");
+#endif
+    Matrix<F> CNew;
+    std::vector<int> newIndices, newOffsets;
+    PlayRound
+    ( CInit, indices, offsets, b, strong, reduce,
+      C, newIndices, newOffsets, diag );
+    indices.swap( newIndices );
+    offsets.swap( newOffsets );
+    while( offsets.size() > 2 )
+    {
+        PlayRound
+        ( C, indices, offsets, b, strong, reduce,
+          CNew, newIndices, newOffsets, diag );
+        C = CNew;
+        indices.swap( newIndices );
+        offsets.swap( newOffsets );
+    }
+}
+
+template<typename F>
+inline void
+SelectPanel
+( const Matrix<F>& A, int b, bool strong,
+  std::vector<int>& selected, std::vector<BASE(F)>& diag )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::SelectPanel");
+#endif
+    const int n = A.Width();
+    selected.resize( n );
+    for( int j=0; j<n; ++j )
+        selected[j] = j;
+    std::vector<int> offsets;
+    for( int j=0; j<n; j+=b )
+        offsets.push_back( j );
+    offsets.push_back( n );
+
+    Matrix<F> C;
+    PlayTournament
+    ( A, selected, offsets, b, strong, SequentialReducer(), C, diag );
+}
+
+template<typename F>
+inline void
+SelectPanel
+( const DistMatrix<F>& A, int b, bool strong,
+  std::vector<int>& selected, std::vector<BASE(F)>& diag )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::SelectPanel");
+#endif
+    const Grid& g = A.Grid();
+    const int mLocal = A.LocalHeight();
+    const int nLocal = A.LocalWidth();
+    const int rowShift = A.RowShift();
+    const int rowStride = A.RowStride();
+    const ColumnReducer reduce( g.ColComm() );
+
+    // Run the tournament over the local columns of each process column
+    selected.resize( nLocal );
+    for( int jLocal=0; jLocal<nLocal; ++jLocal )
+        selected[jLocal] = rowShift + jLocal*rowStride;
+    std::vector<int> offsets;
+    for( int jLocal=0; jLocal<nLocal; jLocal+=b )
+        offsets.push_back( jLocal );
+    offsets.push_back( nLocal );
+    Matrix<F> C;
+    PlayTournament
+    ( A.LockedMatrix(), selected, offsets, b, strong, reduce, C, diag );
+
+    // Gather the winners from each process column and finish the tournament
+    const int c = g.Width();
+    if( c > 1 )
+    {
+        const int numWinners = C.Width();
+        std::vector<int> sendInts( b+1 ), recvInts( c*(b+1) );
+        sendInts[0] = numWinners;
+        for( int j=0; j<numWinners; ++j )
+            sendInts[j+1] = selected[j];
+        mpi::AllGather( &sendInts[0], b+1, &recvInts[0], b+1, g.RowComm() );
+
+        const int blockSize = mLocal*b;
+        std::vector<F> sendBuf( std::max(blockSize,1) ),
+                       recvBuf( std::max(c*blockSize,1) );
+        for( int j=0; j<numWinners; ++j )
+            MemCopy( &sendBuf[j*mLocal], C.LockedBuffer(0,j), mLocal );
+        if( blockSize > 0 )
+            mpi::AllGather
+            ( &sendBuf[0], blockSize, &recvBuf[0], blockSize, g.RowComm() );
+
+        offsets.resize( c+1 );
+        offsets[0] = 0;
+        for( int q=0; q<c; ++q )
+            offsets[q+1] = offsets[q] + recvInts[q*(b+1)];
+        Matrix<F> CGathered( mLocal, offsets[c] );
+        selected.resize( offsets[c] );
+        for( int q=0; q<c; ++q )
+        {
+            for( int j=0; j<offsets[q+1]-offsets[q]; ++j )
+            {
+                MemCopy
+                ( CGathered.Buffer(0,offsets[q]+j),
+                  &recvBuf[q*blockSize+j*mLocal], mLocal );
+                selected[offsets[q]+j] = recvInts[q*(b+1)+j+1];
+            }
+        }
+        PlayTournament
+        ( CGathered, selected, offsets, b, strong, reduce, C, diag );
+    }
+
+    // Ensure that every process agrees upon the winners
+    int numSelected = selected.size();
+    mpi::Broadcast( &numSelected, 1, 0, g.Comm() );
+    selected.resize( numSelected );
+    diag.resize( numSelected );
+    if( numSelected > 0 )
+    {
+        mpi::Broadcast( &selected[0], numSelected, 0, g.Comm() );
+        mpi::Broadcast( &diag[0], numSelected, 0, g.Comm() );
+    }
+}
+
+template<typename Real>
+inline void
+FactorPanel
+( Matrix<Real>& APan, Matrix<Real>& ARight, Matrix<Real>& t, int offset )
+{
+    PanelHouseholder( APan );
+    ApplyPackedReflectors( LEFT, LOWER, VERTICAL, FORWARD, 0, APan, ARight );
+}
+
+template<typename Real>
+inline void
+FactorPanel
+( Matrix<Complex<Real> >& APan, Matrix<Complex<Real> >& ARight,
+  Matrix<Complex<Real> >& t, int offset )
+{
+    Matrix<Complex<Real> > tPan;
+    PanelHouseholder( APan, tPan );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, APan, tPan, ARight );
+    for( int j=0; j<tPan.Height(); ++j )
+        t.Set( offset+j, 0, tPan.Get(j,0) );
+}
+
+template<typename Real>
+inline void
+FactorPanel
+( DistMatrix<Real>& APan, DistMatrix<Real>& ARight,
+  DistMatrix<Real,MD,STAR>& t, int offset )
+{
+    PanelHouseholder( APan );
+    ApplyPackedReflectors( LEFT, LOWER, VERTICAL, FORWARD, 0, APan, ARight );
+}
+
+template<typename Real>
+inline void
+FactorPanel
+( DistMatrix<Complex<Real> >& APan, DistMatrix<Complex<Real> >& ARight,
+  DistMatrix<Complex<Real>,MD,STAR>& t, int offset )
+{
+    const Grid& g = APan.Grid();
+    DistMatrix<Complex<Real>,MD,STAR> tPan( g );
+    tPan.AlignWithDiagonal( APan );
+    PanelHouseholder( APan, tPan );
+    ApplyPackedReflectors
+    ( LEFT, LOWER, VERTICAL, FORWARD, CONJUGATED, 0, APan, tPan, ARight );
+    DistMatrix<Complex<Real>,STAR,STAR> tPan_STAR_STAR( g );
+    tPan_STAR_STAR = tPan;
+    for( int j=0; j<tPan_STAR_STAR.Height(); ++j )
+        t.Set( offset+j, 0, tPan_STAR_STAR.GetLocal(j,0) );
+}
+
+// Convert the (ordered) selection of columns of the trailing matrix into a
+// sequence of column swaps
+inline void
+SelectionToSwaps
+( const std::vector<int>& selected, int k, int n, std::vector<int>& swaps )
+{
+    std::vector<int> position( n ), column( n );
+    for( int j=0; j<n; ++j )
+        position[j] = column[j] = j;
+    swaps.resize( k );
+    for( int j=0; j<k; ++j )
+    {
+        const int target = position[selected[j]];
+        swaps[j] = target;
+        const int displaced = column[j];
+        column[target] = displaced;
+        position[displaced] = target;
+        column[j] = selected[j];
+        position[selected[j]] = j;
+    }
+}
+
+template<typename F>
+inline void
+Factor
+( Matrix<F>& A, Matrix<F>& t, Matrix<int>& p, int maxSteps, BASE(F) tol,
+  bool strong )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::Factor");
+    if( maxSteps > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Too many steps requested");
+    if( p.Viewing() && (p.Height() != maxSteps || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a vector of the same height as the number of steps");
+#endif
+    typedef BASE(F) Real;
+    if( !p.Viewing() )
+        p.ResizeTo( maxSteps, 1 );
+    if( !t.Viewing() )
+        t.ResizeTo( maxSteps, 1 );
+
+    const int m = A.Height();
+    const int n = A.Width();
+    std::vector<Real> norms;
+    const Real maxOrigNorm = ColumnNorms( A, norms );
+
+    Matrix<F> ABR, AR, APan, ARight;
+    Matrix<int> pPan;
+    std::vector<int> selected, swaps;
+    std::vector<Real> diag;
+    int col = 0;
+    while( col < maxSteps )
+    {
+        const int b = std::min( Blocksize(), maxSteps-col );
+        LockedView( ABR, A, col, col, m-col, n-col );
+        SelectPanel( ABR, b, strong, selected, diag );
+        int k = 0;
+        while( k < (int)diag.size() && diag[k] > tol*maxOrigNorm )
+            ++k;
+        if( k > 0 )
+        {
+            SelectionToSwaps( selected, k, n-col, swaps );
+            pPan.ResizeTo( k, 1 );
+            for( int j=0; j<k; ++j )
+            {
+                pPan.Set( j, 0, swaps[j] );
+                p.Set( col+j, 0, col+swaps[j] );
+            }
+            View( AR, A, 0, col, m, n-col );
+            ApplyColumnPivots( AR, pPan );
+            View( APan, A, col, col, m-col, k );
+            View( ARight, A, col, col+k, m-col, n-col-k );
+            FactorPanel( APan, ARight, t, col );
+        }
+        col += k;
+        if( k < b )
+            break;
+    }
+    if( col < maxSteps )
+    {
+        p.ResizeTo( col, 1 );
+        t.ResizeTo( col, 1 );
+    }
+}
+
+template<typename F>
+inline void
+Factor
+( DistMatrix<F>& A, DistMatrix<F,MD,STAR>& t, DistMatrix<int,VR,STAR>& p,
+  int maxSteps, BASE(F) tol, bool strong )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::tournament::Factor");
+    if( maxSteps > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Too many steps requested");
+    if( p.Viewing() && (p.Height() != maxSteps || p.Width() != 1) )
+        throw std::logic_error
+        ("p must be a vector of the same height as the number of steps");
+    if( A.Grid() != p.Grid() || A.Grid() != t.Grid() )
+        throw std::logic_error("A, t, and p must have the same grid");
+#endif
+    typedef BASE(F) Real;
+    const Grid& g = A.Grid();
+    if( !p.Viewing() )
+        p.ResizeTo( maxSteps, 1 );
+    if( !t.Viewing() )
+        t.ResizeTo( maxSteps, 1 );
+
+    const int m = A.Height();
+    const int n = A.Width();
+    std::vector<Real> norms;
+    const Real maxOrigNorm = ColumnNorms( A, norms );
+
+    DistMatrix<F> ABR(g), AR(g), APan(g), ARight(g);
+    DistMatrix<int,STAR,STAR> pPan(g);
+    std::vector<int> selected, swaps;
+    std::vector<Real> diag;
+    int col = 0;
+    while( col < maxSteps )
+    {
+        const int b = std::min( Blocksize(), maxSteps-col );
+        LockedView( ABR, A, col, col, m-col, n-col );
+        SelectPanel( ABR, b, strong, selected, diag );
+        int k = 0;
+        while( k < (int)diag.size() && diag[k] > tol*maxOrigNorm )
+            ++k;
+        if( k > 0 )
+        {
+            SelectionToSwaps( selected, k, n-col, swaps );
+            pPan.ResizeTo( k, 1 );
+            for( int j=0; j<k; ++j )
+            {
+                pPan.SetLocal( j, 0, swaps[j] );
+                p.Set( col+j, 0, col+swaps[j] );
+            }
+            View( AR, A, 0, col, m, n-col );
+            ApplyColumnPivots( AR, pPan );
+            View( APan, A, col, col, m-col, k );
+            View( ARight, A, col, col+k, m-col, n-col-k );
+            FactorPanel( APan, ARight, t, col );
+        }
+        col += k;
+        if( k < b )
+            break;
+    }
+    if( col < maxSteps )
+    {
+        p.ResizeTo( col, 1 );
+        t.ResizeTo( col, 1 );
+    }
+}
+
+} // namespace tournament
+
+template<typename Real>
+inline void
+Tournament
+( Matrix<Real>& A, Matrix<int>& p, int maxSteps, Real tol, bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    Matrix<Real> t;
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+template<typename Real>
+inline void
+Tournament
+( Matrix<Complex<Real> >& A, Matrix<Complex<Real> >& t, Matrix<int>& p,
+  int maxSteps, Real tol, bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+// If we don't need 't' from the above routine
+template<typename Real>
+inline void
+Tournament
+( Matrix<Complex<Real> >& A, Matrix<int>& p,
+  int maxSteps, Real tol, bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    Matrix<Complex<Real> > t;
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+template<typename Real>
+inline void
+Tournament
+( DistMatrix<Real>& A, DistMatrix<int,VR,STAR>& p, int maxSteps, Real tol,
+  bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    DistMatrix<Real,MD,STAR> t( A.Grid() );
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+template<typename Real>
+inline void
+Tournament
+( DistMatrix<Complex<Real> >& A, DistMatrix<Complex<Real>,MD,STAR>& t,
+  DistMatrix<int,VR,STAR>& p, int maxSteps, Real tol, bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+// If we don't need 't' from the above routine
+template<typename Real>
+inline void
+Tournament
+( DistMatrix<Complex<Real> >& A, DistMatrix<int,VR,STAR>& p,
+  int maxSteps, Real tol, bool strong=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::Tournament");
+#endif
+    DistMatrix<Complex<Real>,MD,STAR> t( A.Grid() );
+    tournament::Factor( A, t, p, maxSteps, tol, strong );
+}
+
+// Dispatch to the requested rank-revealing QR (with a negative tolerance,
+// exactly maxSteps steps are performed)
+template<typename F>
+inline void
+RankRevealing
+( Matrix<F>& A, Matrix<int>& p, int maxSteps, BASE(F) tol,
+  RRQRMethod method )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::RankRevealing");
+#endif
+    if( method == RRQR_BUSINGER_GOLUB )
+        BusingerGolub( A, p, maxSteps, tol );
+    else
+        Tournament( A, p, maxSteps, tol, method==RRQR_STRONG_TOURNAMENT );
+}
+
+template<typename F>
+inline void
+RankRevealing
+( DistMatrix<F>& A, DistMatrix<int,VR,STAR>& p, int maxSteps, BASE(F) tol,
+  RRQRMethod method )
+{
+#ifndef RELEASE
+    CallStackEntry entry("qr::RankRevealing");
+#endif
+    if( method == RRQR_BUSINGER_GOLUB )
+        BusingerGolub( A, p, maxSteps, tol );
+    else
+        Tournament( A, p, maxSteps, tol, method==RRQR_STRONG_TOURNAMENT );
+}
+
+} // namespace qr
+} // namespace elem
+
+#endif // ifndef LAPACK_QR_TOURNAMENT_HPP
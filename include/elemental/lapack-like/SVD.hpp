@@ -13,6 +13,8 @@
 #include "elemental/blas-like/level1/MakeHermitian.hpp"
 #include "elemental/lapack-like/HermitianEig.hpp"
 #include "elemental/lapack-like/SVD/Chan.hpp"
+#include "elemental/lapack-like/SVD/QDWH.hpp"
+#include "elemental/lapack-like/SVD/Randomized.hpp"
 #include "elemental/lapack-like/SVD/Thresholded.hpp"
 
 namespace elem {
@@ -140,6 +142,42 @@ inline void HermitianSVD
 #endif // ifdef HAVE_PMRRR
 }
 
+//----------------------------------------------------------------------------//
+// Grab the full SVD of A using the selected method. SVD_QDWH avoids the      //
+// bidiagonal reduction at the cost of extra flops, and subproblems of its    //
+// eigensolver of size at most 'cutoff' use the standard eigensolver.         //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+SVD
+( Matrix<F>& A, Matrix<BASE(F)>& s, Matrix<F>& V, SVDMethod method,
+  int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SVD");
+#endif
+    if( method == SVD_QDWH )
+        svd::QDWH( A, s, V, cutoff );
+    else
+        SVD( A, s, V );
+}
+
+template<typename F>
+inline void
+SVD
+( DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& s, DistMatrix<F>& V,
+  SVDMethod method, int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SVD");
+#endif
+    if( method == SVD_QDWH )
+        svd::QDWH( A, s, V, cutoff );
+    else
+        SVD( A, s, V );
+}
+
 //----------------------------------------------------------------------------//
 // Grab the singular values of the general matrix A using the QR algorithm.   //
 //----------------------------------------------------------------------------//
@@ -217,6 +255,39 @@ inline void HermitianSVD
 #endif // ifdef HAVE_PMRRR
 }
 
+//----------------------------------------------------------------------------//
+// Grab an approximate rank-k truncated SVD of A, A ~= U diag(s) V^H, from a  //
+// randomized range finder with 'oversample' extra columns and the specified  //
+// number of power iterations, whose test matrix is either uniform or, if     //
+// 'srht' is true, a subsampled randomized Walsh-Hadamard transform. A is     //
+// left unchanged.                                                            //
+//----------------------------------------------------------------------------//
+
+template<typename F>
+inline void
+RandomizedSVD
+( const Matrix<F>& A, Matrix<F>& U, Matrix<BASE(F)>& s, Matrix<F>& V,
+  int rank, int oversample=10, int numPowerIts=1, bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RandomizedSVD");
+#endif
+    svd::Randomized( A, U, s, V, rank, oversample, numPowerIts, srht );
+}
+
+template<typename F>
+inline void
+RandomizedSVD
+( const DistMatrix<F>& A, 
+  DistMatrix<F>& U, DistMatrix<BASE(F),VR,STAR>& s, DistMatrix<F>& V,
+  int rank, int oversample=10, int numPowerIts=1, bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("RandomizedSVD");
+#endif
+    svd::Randomized( A, U, s, V, rank, oversample, numPowerIts, srht );
+}
+
 } // namespace elem
 
 #endif // ifndef LAPACK_SVD_HPP
@@ -0,0 +1,143 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SVD_QDWH_HPP
+#define LAPACK_SVD_QDWH_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/HermitianEig/QDWH.hpp"
+#include "elemental/lapack-like/Polar/QDWH.hpp"
+#include "elemental/lapack-like/Norm/TwoUpperBound.hpp"
+
+//
+// The QDWH-SVD of Nakatsukasa and Higham: the polar decomposition A = U_p H
+// is computed with QDWH, and then the spectral divide-and-conquer
+// eigensolver is applied to H = V Sigma V^H, so that A = (U_p V) Sigma V^H.
+// As with hermitian_eig::QDWH, there is no bidiagonal reduction, and every
+// step is a QR or Cholesky factorization or a matrix-matrix multiplication.
+//
+// On exit, A is overwritten with U, and the singular values are sorted in
+// descending order. If A is numerically rank-deficient, the columns of U
+// corresponding to zero singular values need not be orthonormal.
+//
+
+namespace elem {
+namespace svd {
+
+template<typename F>
+inline void
+QDWH( Matrix<F>& A, Matrix<BASE(F)>& s, Matrix<F>& V, int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::QDWH");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int n = A.Width();
+    if( m < n )
+    {
+        // Compute the SVD of A^H = V Sigma U^H instead
+        Matrix<F> AAdj;
+        Adjoint( A, AAdj );
+        QDWH( AAdj, s, A, cutoff );
+        V = AAdj;
+        return;
+    }
+    if( n == 0 )
+    {
+        s.ResizeTo( 0, 1 );
+        V.ResizeTo( 0, 0 );
+        return;
+    }
+
+    // Since no lower bound on the smallest singular value is known, assume
+    // the worst case, which requires at most six QDWH iterations
+    const R upperBound = TwoNormUpperBound( A );
+    if( upperBound == R(0) )
+    {
+        Zeros( s, n, 1 );
+        Identity( V, n, n );
+        Identity( A, m, n );
+        return;
+    }
+    Matrix<F> UP( A );
+    polar::QDWH( UP, lapack::MachineEpsilon<R>(), upperBound );
+
+    // H := U_p^H A = V Sigma V^H
+    Matrix<F> H;
+    Gemm( ADJOINT, NORMAL, F(1), UP, A, H );
+    hermitian_eig::QDWH( LOWER, H, s, V, cutoff );
+    for( int j=0; j<n; ++j )
+        s.Set( j, 0, Abs(s.Get(j,0)) );
+    hermitian_eig::Sort( s, V, false );
+
+    // U := U_p V
+    Gemm( NORMAL, NORMAL, F(1), UP, V, A );
+}
+
+template<typename F>
+inline void
+QDWH
+( DistMatrix<F>& A, DistMatrix<BASE(F),VR,STAR>& s, DistMatrix<F>& V,
+  int cutoff=256 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::QDWH");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    if( m < n )
+    {
+        // Compute the SVD of A^H = V Sigma U^H instead
+        DistMatrix<F> AAdj( g );
+        Adjoint( A, AAdj );
+        QDWH( AAdj, s, A, cutoff );
+        V = AAdj;
+        return;
+    }
+    if( n == 0 )
+    {
+        s.ResizeTo( 0, 1 );
+        V.ResizeTo( 0, 0 );
+        return;
+    }
+
+    // Since no lower bound on the smallest singular value is known, assume
+    // the worst case, which requires at most six QDWH iterations
+    const R upperBound = TwoNormUpperBound( A );
+    if( upperBound == R(0) )
+    {
+        Zeros( s, n, 1 );
+        Identity( V, n, n );
+        Identity( A, m, n );
+        return;
+    }
+    DistMatrix<F> UP( A );
+    polar::QDWH( UP, lapack::MachineEpsilon<R>(), upperBound );
+
+    // H := U_p^H A = V Sigma V^H
+    DistMatrix<F> H( g );
+    Gemm( ADJOINT, NORMAL, F(1), UP, A, H );
+    hermitian_eig::QDWH( LOWER, H, s, V, cutoff );
+    const int localHeight = s.LocalHeight();
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        s.SetLocal( iLocal, 0, Abs(s.GetLocal(iLocal,0)) );
+    hermitian_eig::Sort( s, V, false );
+
+    // U := U_p V
+    Gemm( NORMAL, NORMAL, F(1), UP, V, A );
+}
+
+} // namespace svd
+} // namespace elem
+
+#endif // ifndef LAPACK_SVD_QDWH_HPP
@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SVD_RANDOMIZED_HPP
+#define LAPACK_SVD_RANDOMIZED_HPP
+
+#include "elemental/blas-like/level1/Adjoint.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Sketch.hpp"
+#include "elemental/lapack-like/SVD/Chan.hpp"
+#include "elemental/matrices/Uniform.hpp"
+
+// The randomized range finder with power iterations from Halko, Martinsson,
+// and Tropp's "Finding structure with randomness: Probabilistic algorithms
+// for constructing approximate matrix decompositions", Algorithm 4.4,
+// followed by their Algorithm 5.1 for converting the orthonormal basis into
+// a truncated SVD. For an m x n matrix, the cost is O(mnk) for a rank-k
+// approximation rather than the O(mn min(m,n)) of a full SVD.
+
+namespace elem {
+namespace svd {
+
+//
+// Return an m x numCols matrix Q with orthonormal columns such that
+// Q Q^H A approximates A. Each power iteration applies (A A^H) once more in
+// order to sharpen the decay of the singular values, and the basis is
+// re-orthonormalized after each application of A or A^H.
+//
+// The test matrix is either a dense uniform matrix or, if 'srht' is true, 
+// the adjoint of a subsampled randomized Walsh-Hadamard transform, S, in 
+// which case A S^H is formed as (S A^H)^H in O(mn log n) rather than 
+// O(mn numCols) work.
+//
+
+template<typename F>
+inline void
+RangeFinder
+( const Matrix<F>& A, Matrix<F>& Q, int numCols, int numPowerIts=1,
+  bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::RangeFinder");
+    if( numCols < 1 || numCols > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid number of columns for range finder");
+    if( numPowerIts < 0 )
+        throw std::logic_error("Number of power iterations must be >= 0");
+#endif
+    const int n = A.Width();
+
+    if( srht )
+    {
+        Matrix<F> AAdj, SAAdj;
+        Adjoint( A, AAdj );
+        SRHTSketch( AAdj, SAAdj, numCols );
+        AAdj.Empty();
+        Adjoint( SAAdj, Q );
+    }
+    else
+    {
+        Matrix<F> Omega;
+        Uniform( Omega, n, numCols );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    }
+    qr::Explicit( Q );
+
+    Matrix<F> Z;
+    for( int it=0; it<numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+        qr::Explicit( Z );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+        qr::Explicit( Q );
+    }
+}
+
+template<typename F>
+inline void
+RangeFinder
+( const DistMatrix<F>& A, DistMatrix<F>& Q, int numCols, int numPowerIts=1,
+  bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::RangeFinder");
+    if( numCols < 1 || numCols > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid number of columns for range finder");
+    if( numPowerIts < 0 )
+        throw std::logic_error("Number of power iterations must be >= 0");
+#endif
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+
+    if( srht )
+    {
+        // Redistribute A^H directly into the [* ,VR] distribution used by
+        // the transform rather than going through SRHTSketch, which would 
+        // first form A^H in a [MC,MR] distribution
+        DistMatrix<F,STAR,VR> AAdj_STAR_VR( g ), SAAdj_STAR_VR( g );
+        Adjoint( A, AAdj_STAR_VR );
+        SAAdj_STAR_VR.AlignWith( AAdj_STAR_VR );
+        SAAdj_STAR_VR.ResizeTo( numCols, A.Height() );
+        sketch::LocalSRHT
+        ( NextRandomStream(), 
+          AAdj_STAR_VR.LockedMatrix(), SAAdj_STAR_VR.Matrix() );
+        AAdj_STAR_VR.Empty();
+        Adjoint( SAAdj_STAR_VR, Q );
+    }
+    else
+    {
+        DistMatrix<F> Omega( g );
+        Uniform( Omega, n, numCols );
+        Gemm( NORMAL, NORMAL, F(1), A, Omega, Q );
+    }
+    qr::Explicit( Q );
+
+    DistMatrix<F> Z( g );
+    for( int it=0; it<numPowerIts; ++it )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), A, Q, Z );
+        qr::Explicit( Z );
+        Gemm( NORMAL, NORMAL, F(1), A, Z, Q );
+        qr::Explicit( Q );
+    }
+}
+
+//
+// Compute an approximate rank-k truncated SVD, A ~= U diag(s) V^H, from an
+// orthonormal basis for the range of A with 'oversample' extra columns
+// (see RangeFinder for the meaning of 'srht').
+//
+// Since B := Q^H A is short and fat, we instead compute the SVD of
+// B^H = W diag(s) X^H, so that A ~= (Q X) diag(s) W^H.
+//
+
+template<typename F>
+inline void
+Randomized
+( const Matrix<F>& A, Matrix<F>& U, Matrix<BASE(F)>& s, Matrix<F>& V,
+  int rank, int oversample=10, int numPowerIts=1, bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::Randomized");
+    if( rank < 1 || rank > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid rank for randomized SVD");
+    if( oversample < 0 )
+        throw std::logic_error("Oversampling parameter must be non-negative");
+#endif
+    typedef BASE(F) R;
+    const int minDim = std::min( A.Height(), A.Width() );
+    const int numCols = std::min( rank+oversample, minDim );
+
+    Matrix<F> Q;
+    RangeFinder( A, Q, numCols, numPowerIts, srht );
+
+    // Form B^H := A^H Q and compute its SVD, overwriting it with W
+    Matrix<F> BAdj;
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    Matrix<R> sFull;
+    Matrix<F> X;
+    DivideAndConquerSVD( BAdj, sFull, X );
+
+    // Keep the leading 'rank' triplets
+    Matrix<F> XL, WL;
+    Matrix<R> sT;
+    LockedView( XL, X, 0, 0, numCols, rank );
+    LockedView( WL, BAdj, 0, 0, BAdj.Height(), rank );
+    LockedView( sT, sFull, 0, 0, rank, 1 );
+    Gemm( NORMAL, NORMAL, F(1), Q, XL, U );
+    V = WL;
+    s = sT;
+}
+
+template<typename F>
+inline void
+Randomized
+( const DistMatrix<F>& A,
+  DistMatrix<F>& U, DistMatrix<BASE(F),VR,STAR>& s, DistMatrix<F>& V,
+  int rank, int oversample=10, int numPowerIts=1, bool srht=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("svd::Randomized");
+    if( rank < 1 || rank > std::min(A.Height(),A.Width()) )
+        throw std::logic_error("Invalid rank for randomized SVD");
+    if( oversample < 0 )
+        throw std::logic_error("Oversampling parameter must be non-negative");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int minDim = std::min( A.Height(), A.Width() );
+    const int numCols = std::min( rank+oversample, minDim );
+
+    DistMatrix<F> Q( g );
+    RangeFinder( A, Q, numCols, numPowerIts, srht );
+
+    // Form B^H := A^H Q and compute its SVD, overwriting it with W
+    DistMatrix<F> BAdj( g );
+    Gemm( ADJOINT, NORMAL, F(1), A, Q, BAdj );
+    DistMatrix<R,VR,STAR> sFull( g );
+    DistMatrix<F> X( g );
+    Chan( BAdj, sFull, X );
+
+    // Keep the leading 'rank' triplets
+    DistMatrix<F> XL( g ), WL( g );
+    DistMatrix<R,VR,STAR> sT( g );
+    LockedView( XL, X, 0, 0, numCols, rank );
+    LockedView( WL, BAdj, 0, 0, BAdj.Height(), rank );
+    LockedView( sT, sFull, 0, 0, rank, 1 );
+    Gemm( NORMAL, NORMAL, F(1), Q, XL, U );
+    V = WL;
+    s = sT;
+}
+
+} // namespace svd
+} // namespace elem
+
+#endif // ifndef LAPACK_SVD_RANDOMIZED_HPP
@@ -11,7 +11,7 @@
 #define LAPACK_SKELETON_HPP
 
 #include "elemental/blas-like/level1/Adjoint.hpp"
-#include "elemental/lapack-like/QR/BusingerGolub.hpp"
+#include "elemental/lapack-like/QR/Tournament.hpp"
 #include "elemental/lapack-like/Pseudoinverse.hpp"
 
 // NOTE: There are *many* algorithms for (pseudo-)skeleton/CUR decompositions,
@@ -29,7 +29,8 @@ inline void
 Skeleton
 ( const Matrix<F>& A, 
   Matrix<int>& pR, Matrix<int>& pC, 
-  Matrix<F>& Z, int maxSteps, BASE(F) tol )
+  Matrix<F>& Z, int maxSteps, BASE(F) tol,
+  RRQRMethod method=RRQR_BUSINGER_GOLUB )
 {
 #ifndef RELEASE
     CallStackEntry entry("Skeleton");
@@ -37,7 +38,7 @@ Skeleton
     // Find the row permutation
     Matrix<F> B;
     Adjoint( A, B );
-    qr::BusingerGolub( B, pR, maxSteps, tol );
+    qr::RankRevealing( B, pR, maxSteps, tol, method );
     const int numSteps = pR.Height();
 
     // Form pinv(AR')=pinv(AR)'
@@ -52,7 +53,7 @@ Skeleton
 
     // Find the column permutation (force the same number of steps)
     B = A;
-    qr::BusingerGolub( B, pC, numSteps );
+    qr::RankRevealing( B, pC, numSteps, BASE(F)(-1), method );
 
     // Form pinv(AC)
     B = A;
@@ -69,7 +70,8 @@ inline void
 Skeleton
 ( const DistMatrix<F>& A, 
   DistMatrix<int,VR,STAR>& pR, DistMatrix<int,VR,STAR>& pC, 
-  DistMatrix<F>& Z, int maxSteps, BASE(F) tol )
+  DistMatrix<F>& Z, int maxSteps, BASE(F) tol,
+  RRQRMethod method=RRQR_BUSINGER_GOLUB )
 {
 #ifndef RELEASE
     CallStackEntry entry("Skeleton");
@@ -79,7 +81,7 @@ Skeleton
     // Find the row permutation
     DistMatrix<F> B(g);
     Adjoint( A, B );
-    qr::BusingerGolub( B, pR, maxSteps, tol );
+    qr::RankRevealing( B, pR, maxSteps, tol, method );
     const int numSteps = pR.Height();
 
     // Form pinv(AR')=pinv(AR)'
@@ -94,7 +96,7 @@ Skeleton
 
     // Find the column permutation (force the same number of steps)
     B = A;
-    qr::BusingerGolub( B, pC, numSteps );
+    qr::RankRevealing( B, pC, numSteps, BASE(F)(-1), method );
 
     // Form pinv(AC)
     B = A;
@@ -0,0 +1,389 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SKETCH_HPP
+#define LAPACK_SKETCH_HPP
+
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+#include <set>
+
+// Random embeddings S, with s rows and m columns, which approximately
+// preserve the norms of every vector in the span of the columns of an m x n
+// matrix A when s is modestly larger than n. Each routine forms S A in a
+// single pass over A, and S is never explicitly stored. Since the entries of
+// S are generated from counter-based streams, the sketch of a distributed
+// matrix does not depend upon the process grid.
+//
+// For the Gaussian embedding and CountSketch, each process sketches the rows
+// which it owns, and the partial sketches are then summed within each process
+// column, so that only s x n/c entries are communicated per process. The
+// subsampled randomized Walsh-Hadamard transform instead mixes entire
+// columns, and so A is redistributed once into a [* ,VR] distribution.
+
+namespace elem {
+namespace sketch {
+
+// Overwrite the length-n vector x (where n is a power of two) with W x,
+// where W is the unnormalized Walsh matrix, Walsh(log2(n)), using
+// O(n log n) work.
+template<typename F>
+inline void
+WalshHadamardTransform( F* x, int n )
+{
+    for( int h=1; h<n; h*=2 )
+    {
+        for( int i=0; i<n; i+=2*h )
+        {
+            for( int k=i; k<i+h; ++k )
+            {
+                const F alpha = x[k];
+                const F beta = x[k+h];
+                x[k] = alpha + beta;
+                x[k+h] = alpha - beta;
+            }
+        }
+    }
+}
+
+// Return s distinct indices from {0,...,n-1} in increasing order using
+// Floyd's algorithm, which requires only O(s log s) work and storage
+inline void
+SampleIndices
+( const RandomStream& stream, int n, int s, std::vector<int>& indices )
+{
+    std::set<int> chosen;
+    unsigned words[4];
+    for( int j=n-s; j<n; ++j )
+    {
+        stream.Sample( j, 1, words );
+        const unsigned long long sample =
+            (static_cast<unsigned long long>(words[0]) << 32) | words[1];
+        const int t = sample % static_cast<unsigned long long>(j+1);
+        if( chosen.count( t ) )
+            chosen.insert( j );
+        else
+            chosen.insert( t );
+    }
+    indices.assign( chosen.begin(), chosen.end() );
+}
+
+// Add S(:,rows) A into SA, where the local row iLocal of A is global row
+// colShift+iLocal*colStride
+template<typename F>
+inline void
+LocalGaussian
+( const RandomStream& stream, const Matrix<F>& A, int colShift, int colStride,
+  Matrix<F>& SA )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sketch::LocalGaussian");
+#endif
+    typedef BASE(F) R;
+    const int s = SA.Height();
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    const R scale = R(1)/Sqrt(R(s));
+
+    // Generate S one block of columns at a time to bound the workspace
+    const int bsize = Blocksize();
+    Matrix<F> SBlock, ABlock;
+    for( int iLocal=0; iLocal<localHeight; iLocal+=bsize )
+    {
+        const int nb = std::min(bsize,localHeight-iLocal);
+        SBlock.ResizeTo( s, nb );
+        F* SBuffer = SBlock.Buffer();
+        const int SLDim = SBlock.LDim();
+#ifdef HAVE_OPENMP
+        #pragma omp parallel for
+#endif
+        for( int k=0; k<nb; ++k )
+        {
+            const int i = colShift + (iLocal+k)*colStride;
+            for( int r=0; r<s; ++r )
+                SBuffer[r+k*SLDim] = scale*stream.SampleNormal<F>( r, i );
+        }
+        LockedView( ABlock, A, iLocal, 0, nb, localWidth );
+        Gemm( NORMAL, NORMAL, F(1), SBlock, ABlock, F(1), SA );
+    }
+}
+
+// Add the CountSketch of the local rows of A into SA, where each row of A is
+// added, with a random sign, into a single random row of SA
+template<typename F>
+inline void
+LocalCount
+( const RandomStream& stream, const Matrix<F>& A, int colShift, int colStride,
+  Matrix<F>& SA )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sketch::LocalCount");
+#endif
+    const int s = SA.Height();
+    const int localHeight = A.Height();
+    const int localWidth = A.Width();
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+
+    std::vector<int> buckets( localHeight );
+    std::vector<char> flips( localHeight );
+    for( int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        unsigned words[4];
+        stream.Sample( colShift+iLocal*colStride, 0, words );
+        buckets[iLocal] = words[0] % s;
+        flips[iLocal] = words[1] & 1;
+    }
+
+    const F* ABuffer = A.LockedBuffer();
+    const int ALDim = A.LDim();
+    F* SABuffer = SA.Buffer();
+    const int SALDim = SA.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const F* ACol = &ABuffer[jLocal*ALDim];
+        F* SACol = &SABuffer[jLocal*SALDim];
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            if( flips[iLocal] )
+                SACol[buckets[iLocal]] -= ACol[iLocal];
+            else
+                SACol[buckets[iLocal]] += ACol[iLocal];
+        }
+    }
+}
+
+// Overwrite SA with the subsampled randomized Walsh-Hadamard transform of
+// the full columns stored in A, S = sqrt(1/s) P W D, where D is a random
+// diagonal sign matrix, W is the unnormalized Walsh matrix of the smallest
+// power-of-two order which is at least the height of A (which is implicitly
+// padded with zeros), and P selects s of its rows uniformly at random.
+template<typename F>
+inline void
+LocalSRHT( const RandomStream& stream, const Matrix<F>& A, Matrix<F>& SA )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sketch::LocalSRHT");
+#endif
+    typedef BASE(F) R;
+    const int m = A.Height();
+    const int width = A.Width();
+    const int s = SA.Height();
+    int mPadded = 1;
+    while( mPadded < m )
+        mPadded *= 2;
+    if( s > mPadded )
+        throw std::logic_error("Too many rows requested from SRHT");
+    const R scale = R(1)/Sqrt(R(s));
+
+    std::vector<char> flips( m );
+    for( int i=0; i<m; ++i )
+    {
+        unsigned words[4];
+        stream.Sample( i, 0, words );
+        flips[i] = words[0] & 1;
+    }
+    std::vector<int> rows;
+    SampleIndices( stream, mPadded, s, rows );
+
+    const F* ABuffer = A.LockedBuffer();
+    const int ALDim = A.LDim();
+    F* SABuffer = SA.Buffer();
+    const int SALDim = SA.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel
+#endif
+    {
+        std::vector<F> work( mPadded );
+#ifdef HAVE_OPENMP
+        #pragma omp for
+#endif
+        for( int jLocal=0; jLocal<width; ++jLocal )
+        {
+            const F* ACol = &ABuffer[jLocal*ALDim];
+            for( int i=0; i<m; ++i )
+                work[i] = ( flips[i] ? -ACol[i] : ACol[i] );
+            for( int i=m; i<mPadded; ++i )
+                work[i] = 0;
+            WalshHadamardTransform( &work[0], mPadded );
+            F* SACol = &SABuffer[jLocal*SALDim];
+            for( int k=0; k<s; ++k )
+                SACol[k] = scale*work[rows[k]];
+        }
+    }
+}
+
+} // namespace sketch
+
+//
+// Gaussian embedding: S has i.i.d. normal entries with variance 1/s
+//
+
+template<typename F>
+inline void
+GaussianSketch( const Matrix<F>& A, Matrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("GaussianSketch");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const RandomStream stream = NextLocalRandomStream();
+    Zeros( SA, s, A.Width() );
+    sketch::LocalGaussian( stream, A, 0, 1, SA );
+}
+
+template<typename F>
+inline void
+GaussianSketch( const DistMatrix<F>& A, DistMatrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("GaussianSketch");
+    if( A.Grid() != SA.Grid() )
+        throw std::logic_error("A and SA must use the same grid");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const Grid& g = A.Grid();
+    const RandomStream stream = NextRandomStream();
+    DistMatrix<F,STAR,MR> SA_STAR_MR( g );
+    SA_STAR_MR.AlignWith( A );
+    Zeros( SA_STAR_MR, s, A.Width() );
+    sketch::LocalGaussian
+    ( stream, A.LockedMatrix(), A.ColShift(), A.ColStride(),
+      SA_STAR_MR.Matrix() );
+    SA_STAR_MR.SumOverCol();
+    SA = SA_STAR_MR;
+}
+
+//
+// Subsampled randomized Walsh-Hadamard transform
+//
+
+template<typename F>
+inline void
+SRHTSketch( const Matrix<F>& A, Matrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SRHTSketch");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const RandomStream stream = NextLocalRandomStream();
+    SA.ResizeTo( s, A.Width() );
+    sketch::LocalSRHT( stream, A, SA );
+}
+
+template<typename F>
+inline void
+SRHTSketch( const DistMatrix<F>& A, DistMatrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SRHTSketch");
+    if( A.Grid() != SA.Grid() )
+        throw std::logic_error("A and SA must use the same grid");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const Grid& g = A.Grid();
+    const RandomStream stream = NextRandomStream();
+    DistMatrix<F,STAR,VR> A_STAR_VR( g );
+    A_STAR_VR = A;
+    DistMatrix<F,STAR,VR> SA_STAR_VR( g );
+    SA_STAR_VR.AlignWith( A_STAR_VR );
+    SA_STAR_VR.ResizeTo( s, A.Width() );
+    sketch::LocalSRHT( stream, A_STAR_VR.LockedMatrix(), SA_STAR_VR.Matrix() );
+    A_STAR_VR.Empty();
+    SA = SA_STAR_VR;
+}
+
+//
+// CountSketch: each column of S has a single nonzero, a random sign placed
+// in a random row, so that S A requires only O(nnz(A)) work. More rows are
+// typically required than for the dense embeddings.
+//
+
+template<typename F>
+inline void
+CountSketch( const Matrix<F>& A, Matrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CountSketch");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const RandomStream stream = NextLocalRandomStream();
+    Zeros( SA, s, A.Width() );
+    sketch::LocalCount( stream, A, 0, 1, SA );
+}
+
+template<typename F>
+inline void
+CountSketch( const DistMatrix<F>& A, DistMatrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CountSketch");
+    if( A.Grid() != SA.Grid() )
+        throw std::logic_error("A and SA must use the same grid");
+    if( s < 1 )
+        throw std::logic_error("Sketch must have at least one row");
+#endif
+    const Grid& g = A.Grid();
+    const RandomStream stream = NextRandomStream();
+    DistMatrix<F,STAR,MR> SA_STAR_MR( g );
+    SA_STAR_MR.AlignWith( A );
+    Zeros( SA_STAR_MR, s, A.Width() );
+    sketch::LocalCount
+    ( stream, A.LockedMatrix(), A.ColShift(), A.ColStride(),
+      SA_STAR_MR.Matrix() );
+    SA_STAR_MR.SumOverCol();
+    SA = SA_STAR_MR;
+}
+
+template<typename F>
+inline void
+Sketch( SketchType type, const Matrix<F>& A, Matrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Sketch");
+#endif
+    switch( type )
+    {
+    case GAUSSIAN_SKETCH: GaussianSketch( A, SA, s ); break;
+    case SRHT_SKETCH:     SRHTSketch( A, SA, s );     break;
+    case COUNT_SKETCH:    CountSketch( A, SA, s );    break;
+    default: throw std::logic_error("Invalid sketch type");
+    }
+}
+
+template<typename F>
+inline void
+Sketch( SketchType type, const DistMatrix<F>& A, DistMatrix<F>& SA, int s )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Sketch");
+#endif
+    switch( type )
+    {
+    case GAUSSIAN_SKETCH: GaussianSketch( A, SA, s ); break;
+    case SRHT_SKETCH:     SRHTSketch( A, SA, s );     break;
+    case COUNT_SKETCH:    CountSketch( A, SA, s );    break;
+    default: throw std::logic_error("Invalid sketch type");
+    }
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_SKETCH_HPP
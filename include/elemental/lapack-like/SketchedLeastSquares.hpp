@@ -0,0 +1,358 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_SKETCHEDLEASTSQUARES_HPP
+#define LAPACK_SKETCHEDLEASTSQUARES_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level1/Nrm2.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level2/Gemv.hpp"
+#include "elemental/blas-like/level2/Trsv.hpp"
+#include "elemental/lapack-like/QR.hpp"
+#include "elemental/lapack-like/Sketch.hpp"
+
+// Solve the overdetermined least squares problem min_X || A X - B ||_F using
+// the approach of Avron, Maymounkov, and Toledo's "Blendenpik: Supercharging
+// LAPACK's least-squares solver" (and Meng, Saunders, and Mahoney's LSRN):
+// the R factor of the QR decomposition of a sketch S A is a preconditioner
+// such that A inv(R) is well-conditioned with high probability, and LSQR is
+// then applied to min_y || A inv(R) y - b ||_2 for each column b of B.
+//
+// Each iteration requires one multiplication with A, one with A^H, and two
+// triangular solves with the n x n matrix R, which is stored redundantly on
+// each process in the distributed case so that the solves require no
+// communication. For m >> n, the cost is dominated by O(mn log m) work for
+// the SRHT plus O(mn) work per iteration, rather than the O(mn^2) of
+// Householder QR.
+
+namespace elem {
+namespace sketched_ls {
+
+// Return the number of rows of the sketch for an m x n matrix
+inline int
+SketchHeight( int m, int n, double sketchFactor )
+{
+    const int s = std::max( int(std::ceil(sketchFactor*n)), n );
+    if( s > m )
+        throw std::logic_error
+        ("Sketch would have more rows than A; use LeastSquares instead");
+    return s;
+}
+
+// Overwrite the n x n upper triangle of the sketch with its R factor
+template<typename Real>
+inline void
+TriangularFactor( Matrix<Real>& SA )
+{ QR( SA ); }
+
+template<typename Real>
+inline void
+TriangularFactor( DistMatrix<Real>& SA )
+{ QR( SA ); }
+
+template<typename Real>
+inline void
+TriangularFactor( Matrix<Complex<Real> >& SA )
+{
+    Matrix<Complex<Real> > t;
+    QR( SA, t );
+}
+
+template<typename Real>
+inline void
+TriangularFactor( DistMatrix<Complex<Real> >& SA )
+{
+    DistMatrix<Complex<Real>,MD,STAR> t( SA.Grid() );
+    QR( SA, t );
+}
+
+// Run LSQR on min_y || A inv(U) y - b ||_2, where U is upper triangular, and
+// return x = inv(U) y along with the number of iterations
+template<typename F>
+inline int
+LSQR
+( const Matrix<F>& A, const Matrix<F>& U, const Matrix<F>& b, Matrix<F>& x,
+  BASE(F) tol, int maxIts )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sketched_ls::LSQR");
+#endif
+    typedef BASE(F) R;
+    const int n = A.Width();
+
+    // beta u := b
+    Matrix<F> u( b );
+    R beta = Nrm2( u );
+    const R bNorm = beta;
+    Zeros( x, n, 1 );
+    if( bNorm == R(0) )
+        return 0;
+    Scale( R(1)/beta, u );
+
+    // alpha v := inv(U)^H A^H u
+    Matrix<F> v, w, y, z;
+    Zeros( v, n, 1 );
+    Gemv( ADJOINT, F(1), A, u, F(0), v );
+    Trsv( UPPER, ADJOINT, NON_UNIT, U, v );
+    R alpha = Nrm2( v );
+    if( alpha == R(0) )
+        return 0;
+    Scale( R(1)/alpha, v );
+
+    w = v;
+    Zeros( y, n, 1 );
+    R phiBar = beta;
+    R rhoBar = alpha;
+    R normSquared = alpha*alpha;
+    int numIts = 0;
+    while( numIts < maxIts )
+    {
+        ++numIts;
+
+        // beta u := A inv(U) v - alpha u
+        z = v;
+        Trsv( UPPER, NORMAL, NON_UNIT, U, z );
+        Gemv( NORMAL, F(1), A, z, F(-alpha), u );
+        beta = Nrm2( u );
+        if( beta != R(0) )
+            Scale( R(1)/beta, u );
+
+        // alpha v := inv(U)^H A^H u - beta v
+        Gemv( ADJOINT, F(1), A, u, F(0), z );
+        Trsv( UPPER, ADJOINT, NON_UNIT, U, z );
+        Scale( -beta, v );
+        Axpy( F(1), z, v );
+        alpha = Nrm2( v );
+        if( alpha != R(0) )
+            Scale( R(1)/alpha, v );
+        normSquared += alpha*alpha + beta*beta;
+
+        // Apply the next plane rotation and update y and w
+        const R rho = lapack::SafeNorm( rhoBar, beta );
+        const R c = rhoBar/rho;
+        const R sn = beta/rho;
+        const R theta = sn*alpha;
+        rhoBar = -c*alpha;
+        const R phi = c*phiBar;
+        phiBar = sn*phiBar;
+        Axpy( phi/rho, w, y );
+        Scale( -theta/rho, w );
+        Axpy( F(1), v, w );
+
+        // Stop once either the residual or || (A inv(U))^H r ||_2 is small
+        if( phiBar <= tol*bNorm ||
+            alpha*Abs(c) <= tol*Sqrt(normSquared) )
+            break;
+    }
+
+    x = y;
+    Trsv( UPPER, NORMAL, NON_UNIT, U, x );
+    return numIts;
+}
+
+template<typename F>
+inline int
+LSQR
+( const DistMatrix<F>& A, const DistMatrix<F,STAR,STAR>& U,
+  const DistMatrix<F>& b, DistMatrix<F>& x, BASE(F) tol, int maxIts )
+{
+#ifndef RELEASE
+    CallStackEntry entry("sketched_ls::LSQR");
+#endif
+    typedef BASE(F) R;
+    const Grid& g = A.Grid();
+    const int n = A.Width();
+
+    // The long vectors are distributed like A, while the short vectors are
+    // redundantly stored on every process
+    DistMatrix<F> u( g ), z( g );
+    DistMatrix<F,STAR,STAR> v( g ), w( g ), y( g ), z_STAR_STAR( g );
+    Zeros( z, n, 1 );
+
+    // beta u := b
+    u = b;
+    R beta = Nrm2( u );
+    const R bNorm = beta;
+    if( bNorm == R(0) )
+    {
+        Zeros( x, n, 1 );
+        return 0;
+    }
+    Scale( R(1)/beta, u );
+
+    // alpha v := inv(U)^H A^H u
+    Gemv( ADJOINT, F(1), A, u, F(0), z );
+    v = z;
+    Trsv( UPPER, ADJOINT, NON_UNIT, U.LockedMatrix(), v.Matrix() );
+    R alpha = Nrm2( v.LockedMatrix() );
+    if( alpha == R(0) )
+    {
+        Zeros( x, n, 1 );
+        return 0;
+    }
+    Scale( R(1)/alpha, v.Matrix() );
+
+    w = v;
+    Zeros( y, n, 1 );
+    R phiBar = beta;
+    R rhoBar = alpha;
+    R normSquared = alpha*alpha;
+    int numIts = 0;
+    while( numIts < maxIts )
+    {
+        ++numIts;
+
+        // beta u := A inv(U) v - alpha u
+        z_STAR_STAR = v;
+        Trsv
+        ( UPPER, NORMAL, NON_UNIT, U.LockedMatrix(), z_STAR_STAR.Matrix() );
+        z = z_STAR_STAR;
+        Gemv( NORMAL, F(1), A, z, F(-alpha), u );
+        beta = Nrm2( u );
+        if( beta != R(0) )
+            Scale( R(1)/beta, u );
+
+        // alpha v := inv(U)^H A^H u - beta v
+        Gemv( ADJOINT, F(1), A, u, F(0), z );
+        z_STAR_STAR = z;
+        Trsv
+        ( UPPER, ADJOINT, NON_UNIT, U.LockedMatrix(), z_STAR_STAR.Matrix() );
+        Scale( -beta, v.Matrix() );
+        Axpy( F(1), z_STAR_STAR.LockedMatrix(), v.Matrix() );
+        alpha = Nrm2( v.LockedMatrix() );
+        if( alpha != R(0) )
+            Scale( R(1)/alpha, v.Matrix() );
+        normSquared += alpha*alpha + beta*beta;
+
+        // Apply the next plane rotation and update y and w
+        const R rho = lapack::SafeNorm( rhoBar, beta );
+        const R c = rhoBar/rho;
+        const R sn = beta/rho;
+        const R theta = sn*alpha;
+        rhoBar = -c*alpha;
+        const R phi = c*phiBar;
+        phiBar = sn*phiBar;
+        Axpy( phi/rho, w.LockedMatrix(), y.Matrix() );
+        Scale( -theta/rho, w.Matrix() );
+        Axpy( F(1), v.LockedMatrix(), w.Matrix() );
+
+        // Stop once either the residual or || (A inv(U))^H r ||_2 is small
+        if( phiBar <= tol*bNorm ||
+            alpha*Abs(c) <= tol*Sqrt(normSquared) )
+            break;
+    }
+
+    Trsv( UPPER, NORMAL, NON_UNIT, U.LockedMatrix(), y.Matrix() );
+    x = y;
+    return numIts;
+}
+
+} // namespace sketched_ls
+
+//
+// Overwrite X with the solution of min_X || A X - B ||_F, where A is m x n
+// with m >= n and full column rank. The sketch has ceil(sketchFactor*n) rows
+// (the default of four follows Blendenpik), and the number of LSQR iterations
+// required by the slowest column of B is returned.
+//
+
+template<typename F>
+inline int
+SketchedLeastSquares
+( const Matrix<F>& A, const Matrix<F>& B, Matrix<F>& X,
+  SketchType type=SRHT_SKETCH, double sketchFactor=4,
+  BASE(F) tol=10*lapack::MachineEpsilon<BASE(F)>(), int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SketchedLeastSquares");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B do not conform");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const int numRhs = B.Width();
+    const int s = sketched_ls::SketchHeight( m, n, sketchFactor );
+
+    // Form the preconditioner from the R factor of the sketch
+    Matrix<F> R;
+    Sketch( type, A, R, s );
+    sketched_ls::TriangularFactor( R );
+    R.ResizeTo( n, n );
+    MakeTriangular( UPPER, R );
+
+    X.ResizeTo( n, numRhs );
+    int maxNumIts = 0;
+    Matrix<F> b, x;
+    for( int j=0; j<numRhs; ++j )
+    {
+        LockedView( b, B, 0, j, m, 1 );
+        View( x, X, 0, j, n, 1 );
+        Matrix<F> xSol;
+        const int numIts = sketched_ls::LSQR( A, R, b, xSol, tol, maxIts );
+        x = xSol;
+        maxNumIts = std::max( maxNumIts, numIts );
+    }
+    return maxNumIts;
+}
+
+template<typename F>
+inline int
+SketchedLeastSquares
+( const DistMatrix<F>& A, const DistMatrix<F>& B, DistMatrix<F>& X,
+  SketchType type=SRHT_SKETCH, double sketchFactor=4,
+  BASE(F) tol=10*lapack::MachineEpsilon<BASE(F)>(), int maxIts=100 )
+{
+#ifndef RELEASE
+    CallStackEntry entry("SketchedLeastSquares");
+    if( A.Grid() != B.Grid() || A.Grid() != X.Grid() )
+        throw std::logic_error("Grids do not match");
+    if( A.Height() != B.Height() )
+        throw std::logic_error("A and B do not conform");
+    if( A.Height() < A.Width() )
+        throw std::logic_error("A must be at least as tall as it is wide");
+#endif
+    const Grid& g = A.Grid();
+    const int m = A.Height();
+    const int n = A.Width();
+    const int numRhs = B.Width();
+    const int s = sketched_ls::SketchHeight( m, n, sketchFactor );
+
+    // Form the preconditioner from the R factor of the sketch and replicate
+    // it on every process
+    DistMatrix<F> SA( g );
+    Sketch( type, A, SA, s );
+    sketched_ls::TriangularFactor( SA );
+    DistMatrix<F> SAT( g );
+    View( SAT, SA, 0, 0, n, n );
+    MakeTriangular( UPPER, SAT );
+    DistMatrix<F,STAR,STAR> R( g );
+    R = SAT;
+    SA.Empty();
+
+    X.ResizeTo( n, numRhs );
+    int maxNumIts = 0;
+    DistMatrix<F> b( g ), x( g ), xSol( g );
+    for( int j=0; j<numRhs; ++j )
+    {
+        LockedView( b, B, 0, j, m, 1 );
+        View( x, X, 0, j, n, 1 );
+        const int numIts = sketched_ls::LSQR( A, R, b, xSol, tol, maxIts );
+        x = xSol;
+        maxNumIts = std::max( maxNumIts, numIts );
+    }
+    return maxNumIts;
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_SKETCHEDLEASTSQUARES_HPP
@@ -0,0 +1,309 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_STOCHASTICTRACE_HPP
+#define LAPACK_STOCHASTICTRACE_HPP
+
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/lapack-like/HermitianEig/LOBPCG.hpp"
+#include "elemental/matrices/Rademacher.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// Stochastic estimators for tr(A) and tr(f(A)), for Hermitian A, which only
+// require applying A to blocks of Rademacher probe vectors z, for which
+// E[z^H A z] = tr(A). Each block of probes is applied at once, so that the
+// operator is always applied to several vectors (e.g., through a single Hemm).
+//
+// Hutchinson's estimator averages z^H A z, while stochastic Lanczos
+// quadrature (Ubaru, Chen, and Saad, "Fast estimation of tr(f(A)) via
+// stochastic Lanczos quadrature") approximates each z^H f(A) z with the
+// Gauss quadrature rule defined by 'numSteps' steps of the Lanczos process
+// started from z: if T = V diag(theta) V^H is the resulting tridiagonal
+// matrix, then z^H f(A) z ~= ||z||_2^2 sum_k |V(0,k)|^2 f(theta_k).
+//
+// Blocks of 'blockSize' probes are drawn until the standard error of the
+// mean is at most relTol times its magnitude, or 'maxProbes' probes have been
+// used. The standard error only accounts for the sampling error, not for the
+// quadrature error, which decreases geometrically with 'numSteps' at a rate
+// that depends upon the condition number and the smoothness of f.
+//
+
+namespace elem {
+
+template<typename R>
+struct TraceEstimate
+{
+    R value;
+    R stdError;
+    int numProbes;
+};
+
+namespace stochastic_trace {
+
+template<typename R>
+class LogFunctor {
+public:
+    R operator()( R alpha ) const { return Log(alpha); }
+};
+
+// Update the running estimate and return whether it is sufficiently accurate
+template<typename R>
+inline bool
+UpdateEstimate
+( const std::vector<R>& samples, R relTol, TraceEstimate<R>& estimate )
+{
+    const int numProbes = samples.size();
+    R mean = 0;
+    for( int j=0; j<numProbes; ++j )
+        mean += samples[j];
+    mean /= numProbes;
+    R variance = 0;
+    if( numProbes > 1 )
+    {
+        for( int j=0; j<numProbes; ++j )
+            variance += (samples[j]-mean)*(samples[j]-mean);
+        variance /= numProbes-1;
+    }
+    estimate.value = mean;
+    estimate.stdError = Sqrt( variance/numProbes );
+    estimate.numProbes = numProbes;
+    return numProbes > 1 && estimate.stdError <= relTol*Abs(mean);
+}
+
+template<typename F,typename Operator>
+inline TraceEstimate<BASE(F)>
+Hutchinson
+( const Operator& A, int n, const Grid& g,
+  BASE(F) relTol=0.01, int blockSize=16, int maxProbes=1024,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("stochastic_trace::Hutchinson");
+#endif
+    typedef BASE(F) R;
+    if( blockSize < 1 || maxProbes < 1 )
+        throw std::logic_error("Must allow at least one probe");
+    DistMatrix<F> Z( g ), AZ( g );
+    DistMatrix<F,VC,STAR> Z_VC( g ), AZ_VC( g );
+    std::vector<R> samples, dots;
+    TraceEstimate<R> estimate;
+    while( true )
+    {
+        const int numProbes = samples.size();
+        const int b = std::min( blockSize, maxProbes-numProbes );
+        Rademacher( Z, n, b );
+        A( Z, AZ );
+        Z_VC = Z;
+        AZ_VC = AZ;
+
+        // z_j^H A z_j for each probe in the block
+        const int localHeight = Z_VC.LocalHeight();
+        dots.resize( b );
+        for( int j=0; j<b; ++j )
+        {
+            R localDot = 0;
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                localDot +=
+                    RealPart(Conj(Z_VC.GetLocal(iLocal,j))*
+                             AZ_VC.GetLocal(iLocal,j));
+            dots[j] = localDot;
+        }
+        mpi::AllReduce( &dots[0], b, mpi::SUM, g.VCComm() );
+        samples.insert( samples.end(), dots.begin(), dots.end() );
+
+        const bool converged = UpdateEstimate( samples, relTol, estimate );
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Hutchinson: " << estimate.numProbes
+                      << " probes, estimate = " << estimate.value
+                      << ", standard error = " << estimate.stdError
+                      << std::endl;
+        if( converged || estimate.numProbes >= maxProbes )
+            break;
+    }
+    return estimate;
+}
+
+template<typename F,typename Operator,class RealFunctor>
+inline TraceEstimate<BASE(F)>
+LanczosQuadrature
+( const Operator& A, int n, const Grid& g, const RealFunctor& f,
+  int numSteps=30, BASE(F) relTol=0.01, int blockSize=16, int maxProbes=1024,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("stochastic_trace::LanczosQuadrature");
+#endif
+    typedef BASE(F) R;
+    if( blockSize < 1 || maxProbes < 1 )
+        throw std::logic_error("Must allow at least one probe");
+    if( numSteps < 1 )
+        throw std::logic_error("Must take at least one Lanczos step");
+    numSteps = std::min( numSteps, n );
+    const R eps = lapack::MachineEpsilon<R>();
+
+    DistMatrix<F> Q( g ), AQ( g );
+    DistMatrix<F,VC,STAR> Q_VC( g ), QPrev_VC( g ), W_VC( g );
+    std::vector<R> samples, alpha, beta, colSums, normEst;
+    std::vector<int> length;
+    Matrix<R> T, theta, V;
+    TraceEstimate<R> estimate;
+    while( true )
+    {
+        const int numProbes = samples.size();
+        const int b = std::min( blockSize, maxProbes-numProbes );
+
+        // Each Rademacher probe has a two-norm of sqrt(n)
+        Rademacher( Q_VC, n, b );
+        Scale( F(1)/Sqrt(R(n)), Q_VC );
+        Zeros( QPrev_VC, n, b );
+        alpha.assign( b*numSteps, 0 );
+        beta.assign( b*numSteps, 0 );
+        length.assign( b, numSteps );
+        normEst.assign( b, 0 );
+        colSums.resize( b );
+
+        // Run the Lanczos processes for the block of probes simultaneously,
+        // without reorthogonalization, since the quadrature rule is
+        // insensitive to the loss of orthogonality
+        const int localHeight = Q_VC.LocalHeight();
+        for( int t=0; t<numSteps; ++t )
+        {
+            Q = Q_VC;
+            A( Q, AQ );
+            W_VC = AQ;
+
+            for( int j=0; j<b; ++j )
+            {
+                R localDot = 0;
+                for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                    localDot +=
+                        RealPart(Conj(Q_VC.GetLocal(iLocal,j))*
+                                 W_VC.GetLocal(iLocal,j));
+                colSums[j] = localDot;
+            }
+            mpi::AllReduce( &colSums[0], b, mpi::SUM, g.VCComm() );
+            for( int j=0; j<b; ++j )
+                alpha[j*numSteps+t] = colSums[j];
+
+            // w_j := A q_j - alpha_j q_j - beta_{j,t-1} q_{j,prev}
+            for( int j=0; j<b; ++j )
+            {
+                const R alphaj = alpha[j*numSteps+t];
+                const R betaPrev = ( t == 0 ? R(0) : beta[j*numSteps+t-1] );
+                R localNormSquared = 0;
+                for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                {
+                    const F omega =
+                        W_VC.GetLocal(iLocal,j) -
+                        alphaj*Q_VC.GetLocal(iLocal,j) -
+                        betaPrev*QPrev_VC.GetLocal(iLocal,j);
+                    W_VC.SetLocal( iLocal, j, omega );
+                    localNormSquared += RealPart(Conj(omega)*omega);
+                }
+                colSums[j] = localNormSquared;
+            }
+            mpi::AllReduce( &colSums[0], b, mpi::SUM, g.VCComm() );
+            if( t == numSteps-1 )
+                break;
+
+            // q_{j,prev} := q_j, q_j := w_j / beta_{j,t}, stopping any
+            // process which has found an invariant subspace
+            QPrev_VC = Q_VC;
+            for( int j=0; j<b; ++j )
+            {
+                const R betaj = Sqrt(colSums[j]);
+                normEst[j] =
+                    std::max( normEst[j], Abs(alpha[j*numSteps+t])+betaj );
+                R invBeta = 0;
+                if( length[j] == numSteps )
+                {
+                    if( betaj <= n*eps*normEst[j] )
+                        length[j] = t+1;
+                    else
+                    {
+                        beta[j*numSteps+t] = betaj;
+                        invBeta = 1/betaj;
+                    }
+                }
+                for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                    Q_VC.SetLocal
+                    ( iLocal, j, invBeta*W_VC.GetLocal(iLocal,j) );
+            }
+        }
+
+        // Apply the Gauss quadrature rule for each probe
+        for( int j=0; j<b; ++j )
+        {
+            const int m = length[j];
+            Zeros( T, m, m );
+            for( int t=0; t<m; ++t )
+                T.Set( t, t, alpha[j*numSteps+t] );
+            for( int t=0; t<m-1; ++t )
+                T.Set( t+1, t, beta[j*numSteps+t] );
+            HermitianEig( LOWER, T, theta, V );
+            R sample = 0;
+            for( int k=0; k<m; ++k )
+                sample += V.Get(0,k)*V.Get(0,k)*f(theta.Get(k,0));
+            samples.push_back( n*sample );
+        }
+
+        const bool converged = UpdateEstimate( samples, relTol, estimate );
+        if( progress && g.Rank() == 0 )
+            std::cout << "  Lanczos quadrature: " << estimate.numProbes
+                      << " probes, estimate = " << estimate.value
+                      << ", standard error = " << estimate.stdError
+                      << std::endl;
+        if( converged || estimate.numProbes >= maxProbes )
+            break;
+    }
+    return estimate;
+}
+
+} // namespace stochastic_trace
+
+// Estimate tr(f(A)) for the Hermitian matrix A, stored in the 'uplo' triangle
+template<typename F,class RealFunctor>
+inline TraceEstimate<BASE(F)>
+HermitianTraceEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A, const RealFunctor& f,
+  int numSteps=30, BASE(F) relTol=0.01, int blockSize=16, int maxProbes=1024,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HermitianTraceEstimate");
+    if( A.Height() != A.Width() )
+        throw std::logic_error("Hermitian matrices must be square");
+#endif
+    hermitian_eig::HermitianOperator<F,DistMatrix<F> > op( uplo, A );
+    return stochastic_trace::LanczosQuadrature<F>
+           ( op, A.Height(), A.Grid(), f, numSteps, relTol, blockSize,
+             maxProbes, progress );
+}
+
+// Estimate log det(A) = tr(log(A)) for the HPD matrix A
+template<typename F>
+inline TraceEstimate<BASE(F)>
+HPDLogDetEstimate
+( UpperOrLower uplo, const DistMatrix<F>& A,
+  int numSteps=30, BASE(F) relTol=0.01, int blockSize=16, int maxProbes=1024,
+  bool progress=false )
+{
+#ifndef RELEASE
+    CallStackEntry entry("HPDLogDetEstimate");
+#endif
+    typedef BASE(F) R;
+    return HermitianTraceEstimate
+           ( uplo, A, stochastic_trace::LogFunctor<R>(), numSteps, relTol,
+             blockSize, maxProbes, progress );
+}
+
+} // namespace elem
+
+#endif // ifndef LAPACK_STOCHASTICTRACE_HPP
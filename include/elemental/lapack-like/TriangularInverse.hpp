@@ -19,6 +19,8 @@ LocalTriangularInverse
 
 #include "elemental/lapack-like/TriangularInverse/LVar3.hpp"
 #include "elemental/lapack-like/TriangularInverse/UVar3.hpp"
+#include "elemental/lapack-like/TriangularInverse/Recursive.hpp"
+#include "elemental/lapack-like/TriangularInverse/Tiled.hpp"
 
 namespace elem {
 
@@ -50,6 +52,32 @@ Var3( UpperOrLower uplo, UnitOrNonUnit diag, DistMatrix<F>& A  )
         UVar3( diag, A );
 }
 
+template<typename F>
+inline void
+Recursive( UpperOrLower uplo, UnitOrNonUnit diag, Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::Recursive");
+#endif
+    if( uplo == LOWER )
+        LRecursive( diag, A );
+    else
+        URecursive( diag, A );
+}
+
+template<typename F>
+inline void
+Tiled( UpperOrLower uplo, UnitOrNonUnit diag, Matrix<F>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::Tiled");
+#endif
+    if( uplo == LOWER )
+        LTiled( diag, A );
+    else
+        UTiled( diag, A );
+}
+
 } // namespace triangular_inverse
 
 template<typename F>
@@ -59,7 +87,10 @@ TriangularInverse( UpperOrLower uplo, UnitOrNonUnit diag, Matrix<F>& A )
 #ifndef RELEASE
     CallStackEntry entry("TriangularInverse");
 #endif
-    triangular_inverse::Var3( uplo, diag, A );
+    if( UseTaskGraph( A.Height() ) )
+        triangular_inverse::Tiled( uplo, diag, A );
+    else
+        triangular_inverse::Recursive( uplo, diag, A );
 }
 
 template<typename F>
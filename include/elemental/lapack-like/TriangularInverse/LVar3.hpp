@@ -128,7 +128,7 @@ LVar3( UnitOrNonUnit diag, DistMatrix<F>& L )
         L21_MC_STAR.AlignWith( L20 );
         //--------------------------------------------------------------------//
         L10_STAR_VR = L10;
-        L11_STAR_STAR = L11;
+        RedistributeTriangle( LOWER, diag, L11, L11_STAR_STAR );
         LocalTrsm
         ( LEFT, LOWER, NORMAL, diag, F(-1), L11_STAR_STAR, L10_STAR_VR );
 
@@ -142,7 +142,7 @@ LVar3( UnitOrNonUnit diag, DistMatrix<F>& L )
         LocalTrsm
         ( RIGHT, LOWER, NORMAL, diag, F(1), L11_STAR_STAR, L21_VC_STAR );
         LocalTriangularInverse( LOWER, diag, L11_STAR_STAR );
-        L11 = L11_STAR_STAR;
+        RedistributeTriangle( LOWER, diag, L11_STAR_STAR, L11 );
         L21 = L21_VC_STAR;
         //--------------------------------------------------------------------//
         L10_STAR_MR.FreeAlignments();
@@ -0,0 +1,90 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_TRIANGULARINVERSE_RECURSIVE_HPP
+#define LAPACK_TRIANGULARINVERSE_RECURSIVE_HPP
+
+#include "elemental/blas-like/level3/Trsm.hpp"
+#include "elemental/lapack-like/TriangularInverse/LVar3.hpp"
+#include "elemental/lapack-like/TriangularInverse/UVar3.hpp"
+
+//
+// Cache-oblivious triangular inversion based upon
+//
+//     | L11  0   |^-1 = |  inv(L11)              0        |
+//     | L21  L22 |      | -inv(L22) L21 inv(L11) inv(L22) |,
+//
+// where the off-diagonal block is formed with two Trsm's before the
+// diagonal blocks are recursively inverted.
+//
+
+namespace elem {
+namespace triangular_inverse {
+
+// The largest matrix which is directly inverted with the unblocked kernel
+const int RECURSIVE_CUTOFF = 32;
+
+template<typename F>
+inline void
+LRecursive( UnitOrNonUnit diag, Matrix<F>& L )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::LRecursive");
+    if( L.Height() != L.Width() )
+        throw std::logic_error("Nonsquare matrices cannot be triangular");
+#endif
+    const int n = L.Height();
+    if( n <= RECURSIVE_CUTOFF )
+    {
+        LVar3Unb( diag, L );
+        return;
+    }
+    const int n1 = n/2;
+    Matrix<F> L11, L21, L22;
+    View( L11, L, 0,  0,  n1,   n1   );
+    View( L21, L, n1, 0,  n-n1, n1   );
+    View( L22, L, n1, n1, n-n1, n-n1 );
+
+    Trsm( RIGHT, LOWER, NORMAL, diag, F(-1), L11, L21 );
+    Trsm( LEFT, LOWER, NORMAL, diag, F(1), L22, L21 );
+    LRecursive( diag, L11 );
+    LRecursive( diag, L22 );
+}
+
+template<typename F>
+inline void
+URecursive( UnitOrNonUnit diag, Matrix<F>& U )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::URecursive");
+    if( U.Height() != U.Width() )
+        throw std::logic_error("Nonsquare matrices cannot be triangular");
+#endif
+    const int n = U.Height();
+    if( n <= RECURSIVE_CUTOFF )
+    {
+        UVar3Unb( diag, U );
+        return;
+    }
+    const int n1 = n/2;
+    Matrix<F> U11, U12, U22;
+    View( U11, U, 0,  0,  n1,   n1   );
+    View( U12, U, 0,  n1, n1,   n-n1 );
+    View( U22, U, n1, n1, n-n1, n-n1 );
+
+    Trsm( LEFT, UPPER, NORMAL, diag, F(-1), U11, U12 );
+    Trsm( RIGHT, UPPER, NORMAL, diag, F(1), U22, U12 );
+    URecursive( diag, U11 );
+    URecursive( diag, U22 );
+}
+
+} // namespace triangular_inverse
+} // namespace elem
+
+#endif // ifndef LAPACK_TRIANGULARINVERSE_RECURSIVE_HPP
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef LAPACK_TRIANGULARINVERSE_TILED_HPP
+#define LAPACK_TRIANGULARINVERSE_TILED_HPP
+
+#include "elemental/blas-like/level3/Tasks.hpp"
+#include "elemental/lapack-like/TriangularInverse/Recursive.hpp"
+
+//
+// Tiled triangular inversion as a TaskGraph over TileSize() x TileSize()
+// tiles. At step k of the lower-triangular algorithm, the k'th tile column
+// below the diagonal is scaled by -inv(L_kk), its product with the k'th tile
+// row to the left of the diagonal is accumulated into the trailing tiles to
+// the left, and then the k'th tile row is scaled by inv(L_kk) and L_kk is
+// itself inverted.
+//
+
+namespace elem {
+namespace triangular_inverse {
+
+template<typename F>
+class RecursiveTask : public Task
+{
+public:
+    RecursiveTask( UpperOrLower uplo, UnitOrNonUnit diag, Matrix<F>& A )
+    : uplo_(uplo), diag_(diag)
+    { View( A_, A ); }
+
+    void Run()
+    {
+        if( uplo_ == LOWER )
+            LRecursive( diag_, A_ );
+        else
+            URecursive( diag_, A_ );
+    }
+
+private:
+    UpperOrLower uplo_;
+    UnitOrNonUnit diag_;
+    Matrix<F> A_;
+};
+
+template<typename F>
+inline void
+LTiled( UnitOrNonUnit diag, Matrix<F>& L )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::LTiled");
+    if( L.Height() != L.Width() )
+        throw std::logic_error("Nonsquare matrices cannot be triangular");
+#endif
+    std::vector<int> offsets;
+    TileOffsets( L.Height(), TileSize(), offsets );
+    const int numTiles = offsets.size()-1;
+
+    TaskGraph graph;
+    Matrix<F> Lkk, Lik, Lkj, Lij;
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int priority = 2*(numTiles-k);
+        ViewTile( Lkk, L, offsets, offsets, k, k );
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            ViewTile( Lik, L, offsets, offsets, i, k );
+            graph.Add
+            ( new TrsmTask<F>( RIGHT, LOWER, NORMAL, diag, F(-1), Lkk, Lik ),
+              priority+1 );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( i+k*numTiles );
+        }
+
+        for( int i=k+1; i<numTiles; ++i )
+        {
+            ViewTile( Lik, L, offsets, offsets, i, k );
+            for( int j=0; j<k; ++j )
+            {
+                ViewTile( Lkj, L, offsets, offsets, k, j );
+                ViewTile( Lij, L, offsets, offsets, i, j );
+                graph.Add
+                ( new GemmTask<F>
+                  ( NORMAL, NORMAL, F(1), Lik, Lkj, F(1), Lij ), priority );
+                graph.Reads( i+k*numTiles );
+                graph.Reads( k+j*numTiles );
+                graph.Writes( i+j*numTiles );
+            }
+        }
+
+        for( int j=0; j<k; ++j )
+        {
+            ViewTile( Lkj, L, offsets, offsets, k, j );
+            graph.Add
+            ( new TrsmTask<F>( LEFT, LOWER, NORMAL, diag, F(1), Lkk, Lkj ),
+              priority );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( k+j*numTiles );
+        }
+
+        graph.Add( new RecursiveTask<F>( LOWER, diag, Lkk ), priority );
+        graph.Writes( k+k*numTiles );
+    }
+    graph.Execute();
+}
+
+template<typename F>
+inline void
+UTiled( UnitOrNonUnit diag, Matrix<F>& U )
+{
+#ifndef RELEASE
+    CallStackEntry entry("triangular_inverse::UTiled");
+    if( U.Height() != U.Width() )
+        throw std::logic_error("Nonsquare matrices cannot be triangular");
+#endif
+    std::vector<int> offsets;
+    TileOffsets( U.Height(), TileSize(), offsets );
+    const int numTiles = offsets.size()-1;
+
+    TaskGraph graph;
+    Matrix<F> Ukk, Ukj, Uik, Uij;
+    for( int k=0; k<numTiles; ++k )
+    {
+        const int priority = 2*(numTiles-k);
+        ViewTile( Ukk, U, offsets, offsets, k, k );
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            ViewTile( Ukj, U, offsets, offsets, k, j );
+            graph.Add
+            ( new TrsmTask<F>( LEFT, UPPER, NORMAL, diag, F(-1), Ukk, Ukj ),
+              priority+1 );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( k+j*numTiles );
+        }
+
+        for( int j=k+1; j<numTiles; ++j )
+        {
+            ViewTile( Ukj, U, offsets, offsets, k, j );
+            for( int i=0; i<k; ++i )
+            {
+                ViewTile( Uik, U, offsets, offsets, i, k );
+                ViewTile( Uij, U, offsets, offsets, i, j );
+                graph.Add
+                ( new GemmTask<F>
+                  ( NORMAL, NORMAL, F(1), Uik, Ukj, F(1), Uij ), priority );
+                graph.Reads( i+k*numTiles );
+                graph.Reads( k+j*numTiles );
+                graph.Writes( i+j*numTiles );
+            }
+        }
+
+        for( int i=0; i<k; ++i )
+        {
+            ViewTile( Uik, U, offsets, offsets, i, k );
+            graph.Add
+            ( new TrsmTask<F>( RIGHT, UPPER, NORMAL, diag, F(1), Ukk, Uik ),
+              priority );
+            graph.Reads( k+k*numTiles );
+            graph.Writes( i+k*numTiles );
+        }
+
+        graph.Add( new RecursiveTask<F>( UPPER, diag, Ukk ), priority );
+        graph.Writes( k+k*numTiles );
+    }
+    graph.Execute();
+}
+
+} // namespace triangular_inverse
+} // namespace elem
+
+#endif // ifndef LAPACK_TRIANGULARINVERSE_TILED_HPP
@@ -128,7 +128,7 @@ UVar3( UnitOrNonUnit diag, DistMatrix<F>& U )
         U12Trans_MR_STAR.AlignWith( U02 );
         //--------------------------------------------------------------------//
         U01_VC_STAR = U01;
-        U11_STAR_STAR = U11;
+        RedistributeTriangle( UPPER, diag, U11, U11_STAR_STAR );
         LocalTrsm
         ( RIGHT, UPPER, NORMAL, diag, F(-1), U11_STAR_STAR, U01_VC_STAR );
 
@@ -146,7 +146,7 @@ UVar3( UnitOrNonUnit diag, DistMatrix<F>& U )
         LocalTrsm
         ( LEFT, UPPER, NORMAL, diag, F(1), U11_STAR_STAR, U12_STAR_VR );
         LocalTriangularInverse( UPPER, diag, U11_STAR_STAR );
-        U11 = U11_STAR_STAR;
+        RedistributeTriangle( UPPER, diag, U11_STAR_STAR, U11 );
         U12 = U12_STAR_VR;
         //--------------------------------------------------------------------//
         U01Trans_STAR_MC.FreeAlignments();
@@ -111,6 +111,85 @@ enum HermitianGenDefiniteEigType
 }
 using namespace hermitian_gen_definite_eig_type_wrapper;
 
+//
+// Methods for the Hermitian eigensolver and the SVD
+//
+namespace hermitian_eig_method_wrapper {
+enum HermitianEigMethod
+{
+    EIG_TRIDIAG, // reduction to tridiagonal form followed by MRRR
+    EIG_QDWH     // QDWH-based spectral divide and conquer
+};
+}
+using namespace hermitian_eig_method_wrapper;
+
+namespace svd_method_wrapper {
+enum SVDMethod
+{
+    SVD_BIDIAG, // reduction to bidiagonal form
+    SVD_QDWH    // QDWH polar decomposition followed by QDWH-eig
+};
+}
+using namespace svd_method_wrapper;
+
+//
+// Methods for computing functions of Hermitian matrices
+//
+namespace hermitian_sign_method_wrapper {
+enum HermitianSignMethod
+{
+    SIGN_EIG,          // full Hermitian eigensolver
+    SIGN_NEWTON,       // scaled Newton iteration (one inversion per step)
+    SIGN_NEWTON_SCHULZ // inverse-free Newton-Schulz iteration (two Gemms)
+};
+}
+using namespace hermitian_sign_method_wrapper;
+
+namespace square_root_method_wrapper {
+enum SquareRootMethod
+{
+    SQRT_EIG,          // full Hermitian eigensolver
+    SQRT_NEWTON,       // scaled Denman-Beavers iteration (one inversion)
+    SQRT_NEWTON_SCHULZ // inverse-free coupled Newton-Schulz (three Gemms)
+};
+}
+using namespace square_root_method_wrapper;
+
+namespace hermitian_function_method_wrapper {
+enum HermitianFunctionMethod
+{
+    FUNCTION_EIG,      // full Hermitian eigensolver
+    FUNCTION_CHEBYSHEV // Chebyshev expansion (one Gemm per degree)
+};
+}
+using namespace hermitian_function_method_wrapper;
+
+//
+// Pivoting strategies for rank-revealing QR factorizations
+//
+namespace rrqr_method_wrapper {
+enum RRQRMethod
+{
+    RRQR_BUSINGER_GOLUB,   // one pivot per step via a global column-norm search
+    RRQR_TOURNAMENT,       // panels of pivots chosen by a reduction tree
+    RRQR_STRONG_TOURNAMENT // tournament with strong RRQR exchanges at each node
+};
+}
+using namespace rrqr_method_wrapper;
+
+//
+// Sketch (random embeddings of the columns of tall matrices)
+//
+namespace sketch_type_wrapper {
+enum SketchType
+{
+    GAUSSIAN_SKETCH, // dense Gaussian embedding
+    SRHT_SKETCH,     // subsampled randomized Walsh-Hadamard transform
+    COUNT_SKETCH     // sparse embedding with one nonzero per column
+};
+}
+using namespace sketch_type_wrapper;
+
 //----------------------------------------------------------------------------//
 // Utilities                                                                  //
 //----------------------------------------------------------------------------//
@@ -16,6 +16,7 @@
 #include "./lapack-like/Bidiag.hpp"
 #include "./lapack-like/Cholesky.hpp"
 #include "./lapack-like/ComposePivots.hpp"
+#include "./lapack-like/ConditionEstimate.hpp"
 #include "./lapack-like/ConditionNumber.hpp"
 #include "./lapack-like/Determinant.hpp"
 #include "./lapack-like/ExpandPackedReflectors.hpp"
@@ -25,6 +26,7 @@
 #include "./lapack-like/HermitianGenDefiniteEig.hpp"
 #include "./lapack-like/HermitianSign.hpp"
 #include "./lapack-like/HilbertSchmidt.hpp"
+#include "./lapack-like/HODLR.hpp"
 #include "./lapack-like/HPDSolve.hpp"
 #include "./lapack-like/HPSDCholesky.hpp"
 #include "./lapack-like/HPSDSquareRoot.hpp"
@@ -41,7 +43,10 @@
 #include "./lapack-like/QR.hpp"
 #include "./lapack-like/Reflector.hpp"
 #include "./lapack-like/Skeleton.hpp"
+#include "./lapack-like/Sketch.hpp"
+#include "./lapack-like/SketchedLeastSquares.hpp"
 #include "./lapack-like/SkewHermitianEig.hpp"
+#include "./lapack-like/StochasticTrace.hpp"
 #include "./lapack-like/SVD.hpp"
 #include "./lapack-like/Trace.hpp"
 #include "./lapack-like/TriangularInverse.hpp"
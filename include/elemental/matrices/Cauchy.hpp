@@ -10,6 +10,8 @@
 #ifndef MATRICES_CAUCHY_HPP
 #define MATRICES_CAUCHY_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -82,6 +84,22 @@ Cauchy( DistMatrix<F,U,V>& A, const std::vector<F>& x, const std::vector<F>& y )
     }
 }
 
+// The Cauchy matrix as a matrix-free operator
+template<typename F>
+class CauchyOperator : public GeneratedOperator<F,CauchyOperator<F> >
+{
+public:
+    CauchyOperator( const std::vector<F>& x, const std::vector<F>& y )
+    : GeneratedOperator<F,CauchyOperator<F> >( x.size(), y.size() ),
+      x_(x), y_(y)
+    { }
+
+    F Get( int i, int j ) const { return F(1)/(x_[i]-y_[j]); }
+
+private:
+    std::vector<F> x_, y_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_CAUCHY_HPP
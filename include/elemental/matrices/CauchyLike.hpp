@@ -10,6 +10,8 @@
 #ifndef MATRICES_CAUCHYLIKE_HPP
 #define MATRICES_CAUCHYLIKE_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -94,6 +96,29 @@ CauchyLike
     }
 }
 
+// The Cauchy-like matrix as a matrix-free operator
+template<typename F>
+class CauchyLikeOperator : public GeneratedOperator<F,CauchyLikeOperator<F> >
+{
+public:
+    CauchyLikeOperator
+    ( const std::vector<F>& r, const std::vector<F>& s,
+      const std::vector<F>& x, const std::vector<F>& y )
+    : GeneratedOperator<F,CauchyLikeOperator<F> >( r.size(), s.size() ),
+      r_(r), s_(s), x_(x), y_(y)
+    {
+        if( x.size() != r.size() )
+            throw std::logic_error("x vector was the wrong length");
+        if( y.size() != s.size() )
+            throw std::logic_error("y vector was the wrong length");
+    }
+
+    F Get( int i, int j ) const { return r_[i]*s_[j]/(x_[i]-y_[j]); }
+
+private:
+    std::vector<F> r_, s_, x_, y_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_CAUCHYLIKE_HPP
@@ -10,6 +10,9 @@
 #ifndef MATRICES_CIRCULANT_HPP
 #define MATRICES_CIRCULANT_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -53,6 +56,131 @@ Circulant( DistMatrix<T,U,V>& A, const std::vector<T>& a )
     }
 }
 
+// An implicit representation of the circulant matrix A(i,j) = a[(i-j) mod n],
+// which is applied in O(n log n) work per vector through the diagonalization
+// A = inv(F) diag(F a) F, where F is the discrete Fourier transform
+template<typename T>
+class CirculantOperator
+{
+public:
+    typedef BASE(T) R;
+
+    CirculantOperator( const std::vector<T>& a );
+
+    int Height() const { return a_.size(); }
+    int Width() const { return a_.size(); }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    template<Distribution U,Distribution V>
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    // Y := A X
+    template<class MatrixType>
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Multiply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Z := op(A) X, where each column of X is stored locally
+    void ApplyToColumns
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Z ) const;
+
+    // y := the first yLength entries of op(A) [x; 0], where x has length
+    // xLength <= n
+    void ApplyToVector
+    ( Orientation orientation, 
+      const T* x, int xLength, T* y, int yLength ) const;
+
+    // Explicitly form the matrix
+    void Materialize( Matrix<T>& A ) const { Circulant( A, a_ ); }
+    template<Distribution U,Distribution V>
+    void Materialize( DistMatrix<T,U,V>& A ) const { Circulant( A, a_ ); }
+
+private:
+    std::vector<T> a_;
+    // The eigenvalues, F a, scaled by 1/n
+    std::vector<Complex<R> > eigenvalues_;
+    fft::Plan<R> forward_, backward_;
+    mutable std::vector<Complex<R> > work_;
+};
+
+template<typename T>
+inline
+CirculantOperator<T>::CirculantOperator( const std::vector<T>& a )
+: a_(a), forward_(a.size(),false), backward_(a.size(),true)
+{
+#ifndef RELEASE
+    CallStackEntry entry("CirculantOperator::CirculantOperator");
+#endif
+    const int n = a.size();
+    eigenvalues_.resize( n );
+    for( int i=0; i<n; ++i )
+        eigenvalues_[i] = a[i];
+    if( n > 0 )
+        forward_.Apply( &eigenvalues_[0] );
+    for( int i=0; i<n; ++i )
+        eigenvalues_[i] /= R(n);
+    work_.resize( n );
+}
+
+template<typename T>
+inline void
+CirculantOperator<T>::ApplyToVector
+( Orientation orientation, const T* x, int xLength, T* y, int yLength ) const
+{
+    typedef Complex<R> C;
+    const int n = a_.size();
+    if( n == 0 )
+        return;
+    C* w = &work_[0];
+    for( int i=0; i<xLength; ++i )
+        w[i] = x[i];
+    for( int i=xLength; i<n; ++i )
+        w[i] = 0;
+    forward_.Apply( w );
+    // The eigenvalues of A^T are those of A with reversed frequencies
+    if( orientation == NORMAL )
+        for( int k=0; k<n; ++k )
+            w[k] *= eigenvalues_[k];
+    else if( orientation == ADJOINT )
+        for( int k=0; k<n; ++k )
+            w[k] *= Conj(eigenvalues_[k]);
+    else
+        for( int k=0; k<n; ++k )
+            w[k] *= eigenvalues_[(n-k)%n];
+    backward_.Apply( w );
+    for( int i=0; i<yLength; ++i )
+        fft::Store( y[i], w[i] );
+}
+
+template<typename T>
+inline void
+CirculantOperator<T>::ApplyToColumns
+( Orientation orientation, const Matrix<T>& X, Matrix<T>& Z ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("CirculantOperator::ApplyToColumns");
+    if( X.Height() != Width() )
+        throw std::logic_error("X is the wrong height");
+#endif
+    const int n = a_.size();
+    const int width = X.Width();
+    Z.ResizeTo( n, width );
+    if( n == 0 )
+        return;
+    for( int j=0; j<width; ++j )
+        ApplyToVector( orientation, X.LockedBuffer(0,j), n, Z.Buffer(0,j), n );
+}
+
 } // namespace elem
 
 #endif // ifndef MATRICES_CIRCULANT_HPP
@@ -10,6 +10,9 @@
 #ifndef MATRICES_DISCRETEFOURIER_HPP
 #define MATRICES_DISCRETEFOURIER_HPP
 
+#include "elemental/blas-like/level1/FFT.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
 namespace elem {
 
 template<typename R>
@@ -97,6 +100,76 @@ MakeDiscreteFourier( DistMatrix<Complex<R>,U,V>& A )
     }
 }
 
+// An implicit representation of the n x n unitary discrete Fourier matrix,
+// which is applied in O(n log n) work per vector with an FFT
+template<typename R>
+class DiscreteFourierOperator
+{
+public:
+    typedef Complex<R> T;
+
+    DiscreteFourierOperator( int n )
+    : n_(n), forward_(n,false), backward_(n,true)
+    { }
+
+    int Height() const { return n_; }
+    int Width() const { return n_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    template<Distribution U,Distribution V>
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    // Y := A X
+    template<class MatrixType>
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Multiply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Z := op(A) X, where each column of X is stored locally; since A is
+    // symmetric, A^T = A, and, since it is unitary, A^H = inv(A)
+    void ApplyToColumns
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Z ) const
+    {
+#ifndef RELEASE
+        CallStackEntry entry("DiscreteFourierOperator::ApplyToColumns");
+        if( X.Height() != n_ )
+            throw std::logic_error("X is the wrong height");
+#endif
+        const int width = X.Width();
+        const fft::Plan<R>& plan = 
+            ( orientation == ADJOINT ? backward_ : forward_ );
+        const R scale = ( n_ > 0 ? R(1)/Sqrt(R(n_)) : R(1) );
+        Z = X;
+        for( int j=0; j<width; ++j )
+        {
+            T* z = Z.Buffer(0,j);
+            plan.Apply( z );
+            for( int i=0; i<n_; ++i )
+                z[i] *= scale;
+        }
+    }
+
+    // Explicitly form the matrix
+    void Materialize( Matrix<T>& A ) const { DiscreteFourier( A, n_ ); }
+    template<Distribution U,Distribution V>
+    void Materialize( DistMatrix<T,U,V>& A ) const 
+    { DiscreteFourier( A, n_ ); }
+
+private:
+    int n_;
+    fft::Plan<R> forward_, backward_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_DISCRETEFOURIER_HPP
@@ -0,0 +1,272 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef MATRICES_GENERATEDOPERATOR_HPP
+#define MATRICES_GENERATEDOPERATOR_HPP
+
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/Scale.hpp"
+#include "elemental/blas-like/level3/Gemm.hpp"
+#include "elemental/matrices/Zeros.hpp"
+
+//
+// A matrix-free representation of a matrix whose (i,j) entry can be cheaply
+// computed, e.g., the Hilbert, Cauchy, Kahan, Lehmer, MinIJ, and KMS
+// matrices. The derived class need only provide
+//
+//     T Get( int i, int j ) const,
+//
+// and the resulting operator supports the same interface as the other
+// implicit operators (e.g., ToeplitzOperator and HODLR):
+//
+//     Y := alpha op(A) X + beta Y   through   Multiply,
+//     Y := A X                      through   operator(),
+//
+// so that it may be passed to LOBPCG, the stochastic trace estimators, and
+// TwoNormEstimate in place of an explicit matrix.
+//
+// Products with distributed matrices generate the entries of A which would
+// be owned by each process in an [MC,MR] distribution, Blocksize() columns
+// at a time, and multiply them against X[MR,* ] (or X[MC,* ] for op(A) equal
+// to A^T or A^H), so that the only storage is a single panel of A and the
+// only communication is a redistribution of X and a summation of the result.
+// Each entry of A is therefore generated exactly once per product, which
+// allows for products with matrices that would not fit in memory.
+//
+
+namespace elem {
+
+template<typename T,class Derived>
+class GeneratedOperator
+{
+public:
+    GeneratedOperator( int height, int width )
+    : height_(height), width_(width)
+    {
+        if( height < 0 || width < 0 )
+            throw std::logic_error("Operator dimensions must be non-negative");
+    }
+
+    int Height() const { return height_; }
+    int Width() const { return width_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const;
+    template<Distribution U,Distribution V>
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const;
+
+    // Y := A X
+    template<class MatrixType>
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Multiply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Explicitly form the matrix
+    void Materialize( Matrix<T>& A ) const;
+    template<Distribution U,Distribution V>
+    void Materialize( DistMatrix<T,U,V>& A ) const;
+
+protected:
+    T GetEntry( int i, int j ) const
+    { return static_cast<const Derived*>(this)->Get( i, j ); }
+
+    // Z := op(A_local) X + Z, where A_local is the localHeight x localWidth
+    // submatrix of A with row indices colShift + iLocal*colStride and column
+    // indices rowShift + jLocal*rowStride
+    void LocalMultiply
+    ( Orientation orientation,
+      int colShift, int colStride, int rowShift, int rowStride,
+      int localHeight, int localWidth,
+      const Matrix<T>& X, Matrix<T>& Z ) const;
+
+private:
+    int height_, width_;
+};
+
+template<typename T,class Derived>
+inline void
+GeneratedOperator<T,Derived>::LocalMultiply
+( Orientation orientation,
+  int colShift, int colStride, int rowShift, int rowStride,
+  int localHeight, int localWidth,
+  const Matrix<T>& X, Matrix<T>& Z ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GeneratedOperator::LocalMultiply");
+#endif
+    const int width = X.Width();
+    const int bsize = Blocksize();
+    Matrix<T> APanel;
+    Matrix<T> X1, Z1;
+    for( int jStart=0; jStart<localWidth; jStart+=bsize )
+    {
+        const int nb = std::min(bsize,localWidth-jStart);
+
+        // Generate the next panel of the local submatrix
+        APanel.ResizeTo( localHeight, nb );
+        for( int jLocal=0; jLocal<nb; ++jLocal )
+        {
+            const int j = rowShift + (jStart+jLocal)*rowStride;
+            T* RESTRICT APanelCol = APanel.Buffer(0,jLocal);
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+                APanelCol[iLocal] = GetEntry( colShift+iLocal*colStride, j );
+        }
+
+        if( orientation == NORMAL )
+        {
+            LockedView( X1, X, jStart, 0, nb, width );
+            Gemm( NORMAL, NORMAL, T(1), APanel, X1, T(1), Z );
+        }
+        else
+        {
+            View( Z1, Z, jStart, 0, nb, width );
+            Gemm( orientation, NORMAL, T(1), APanel, X, T(1), Z1 );
+        }
+    }
+}
+
+template<typename T,class Derived>
+inline void
+GeneratedOperator<T,Derived>::Multiply
+( Orientation orientation,
+  T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GeneratedOperator::Multiply");
+#endif
+    const int m = height_;
+    const int n = width_;
+    const int height = ( orientation == NORMAL ? m : n );
+    const int width = ( orientation == NORMAL ? n : m );
+    if( X.Height() != width )
+        throw std::logic_error("X is the wrong height");
+    if( Y.Height() != height || Y.Width() != X.Width() )
+        throw std::logic_error("Y is the wrong size");
+    Matrix<T> Z;
+    Zeros( Z, height, X.Width() );
+    LocalMultiply( orientation, 0, 1, 0, 1, m, n, X, Z );
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+template<typename T,class Derived>
+template<Distribution U,Distribution V>
+inline void
+GeneratedOperator<T,Derived>::Multiply
+( Orientation orientation,
+  T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GeneratedOperator::Multiply");
+#endif
+    const int m = height_;
+    const int n = width_;
+    const int height = ( orientation == NORMAL ? m : n );
+    const int width = ( orientation == NORMAL ? n : m );
+    if( X.Height() != width )
+        throw std::logic_error("X is the wrong height");
+    if( Y.Height() != height || Y.Width() != X.Width() )
+        throw std::logic_error("Y is the wrong size");
+    const Grid& g = X.Grid();
+    const int r = g.Height();
+    const int c = g.Width();
+    const int colShift = g.Row();
+    const int rowShift = g.Col();
+    const int localHeight = Length( m, colShift, r );
+    const int localWidth = Length( n, rowShift, c );
+
+    // The locally generated panel of A assumes alignments of zero, so the
+    // redistributions of X must not inherit the alignment of X. Z is left
+    // unaligned so that it is formed from an aligned redistribution, and the
+    // final Axpy realigns it with Y if necessary.
+    DistMatrix<T,U,V> Z( g );
+    if( orientation == NORMAL )
+    {
+        // Z[MC,MR] := SumScatter( A[MC,MR] X[MR,* ] )
+        DistMatrix<T,MR,STAR> X_MR_STAR( width, X.Width(), 0, g );
+        DistMatrix<T,MC,STAR> Z_MC_STAR( g );
+        X_MR_STAR = X;
+        Zeros( Z_MC_STAR, m, X.Width() );
+        LocalMultiply
+        ( NORMAL, colShift, r, rowShift, c, localHeight, localWidth,
+          X_MR_STAR.LockedMatrix(), Z_MC_STAR.Matrix() );
+        DistMatrix<T> Z_MC_MR( g );
+        Z_MC_MR.ResizeTo( m, X.Width() );
+        Z_MC_MR.SumScatterFrom( Z_MC_STAR );
+        Z = Z_MC_MR;
+    }
+    else
+    {
+        // Z[MR,MC] := SumScatter( op(A[MC,MR]) X[MC,* ] )
+        DistMatrix<T,MC,STAR> X_MC_STAR( width, X.Width(), 0, g );
+        DistMatrix<T,MR,STAR> Z_MR_STAR( g );
+        X_MC_STAR = X;
+        Zeros( Z_MR_STAR, n, X.Width() );
+        LocalMultiply
+        ( orientation, colShift, r, rowShift, c, localHeight, localWidth,
+          X_MC_STAR.LockedMatrix(), Z_MR_STAR.Matrix() );
+        DistMatrix<T,MR,MC> Z_MR_MC( g );
+        Z_MR_MC.ResizeTo( n, X.Width() );
+        Z_MR_MC.SumScatterFrom( Z_MR_STAR );
+        Z = Z_MR_MC;
+    }
+    Scale( beta, Y );
+    Axpy( alpha, Z, Y );
+}
+
+template<typename T,class Derived>
+inline void
+GeneratedOperator<T,Derived>::Materialize( Matrix<T>& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GeneratedOperator::Materialize");
+#endif
+    const int m = height_;
+    const int n = width_;
+    A.ResizeTo( m, n );
+    for( int j=0; j<n; ++j )
+        for( int i=0; i<m; ++i )
+            A.Set( i, j, GetEntry(i,j) );
+}
+
+template<typename T,class Derived>
+template<Distribution U,Distribution V>
+inline void
+GeneratedOperator<T,Derived>::Materialize( DistMatrix<T,U,V>& A ) const
+{
+#ifndef RELEASE
+    CallStackEntry entry("GeneratedOperator::Materialize");
+#endif
+    A.ResizeTo( height_, width_ );
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            A.SetLocal( iLocal, jLocal, GetEntry(i,j) );
+        }
+    }
+}
+
+} // namespace elem
+
+#endif // ifndef MATRICES_GENERATEDOPERATOR_HPP
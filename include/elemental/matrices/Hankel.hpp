@@ -10,6 +10,8 @@
 #ifndef MATRICES_HANKEL_HPP
 #define MATRICES_HANKEL_HPP
 
+#include "elemental/matrices/Toeplitz.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -58,6 +60,92 @@ Hankel( DistMatrix<T,U,V>& A, int m, int n, const std::vector<T>& a )
     }
 }
 
+// An implicit representation of the m x n Hankel matrix A(i,j) = a[i+j], 
+// which is applied using the fact that A J is the Toeplitz matrix defined by
+// the same vector, where J is the n x n reversal matrix
+template<typename T>
+class HankelOperator
+{
+public:
+    HankelOperator( int m, int n, const std::vector<T>& a )
+    : a_(a), toeplitz_(m,n,a), work_(n)
+    { }
+
+    int Height() const { return toeplitz_.Height(); }
+    int Width() const { return toeplitz_.Width(); }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    template<Distribution U,Distribution V>
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    // Y := A X
+    template<class MatrixType>
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Multiply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Z := op(A) X, where each column of X is stored locally
+    void ApplyToColumns
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Z ) const
+    {
+#ifndef RELEASE
+        CallStackEntry entry("HankelOperator::ApplyToColumns");
+#endif
+        const int m = Height();
+        const int n = Width();
+        const int inHeight = ( orientation == NORMAL ? n : m );
+        const int outHeight = ( orientation == NORMAL ? m : n );
+        if( X.Height() != inHeight )
+            throw std::logic_error("X is the wrong height");
+        const int width = X.Width();
+        Z.ResizeTo( outHeight, width );
+        if( outHeight == 0 )
+            return;
+        T* w = &work_[0];
+        for( int j=0; j<width; ++j )
+        {
+            const T* x = X.LockedBuffer(0,j);
+            T* z = Z.Buffer(0,j);
+            if( orientation == NORMAL )
+            {
+                // A x = T (J x)
+                for( int i=0; i<n; ++i )
+                    w[i] = x[n-1-i];
+                toeplitz_.ApplyToVector( NORMAL, w, z );
+            }
+            else
+            {
+                // op(A) x = J op(T) x
+                toeplitz_.ApplyToVector( orientation, x, w );
+                for( int i=0; i<n; ++i )
+                    z[i] = w[n-1-i];
+            }
+        }
+    }
+
+    // Explicitly form the matrix
+    void Materialize( Matrix<T>& A ) const 
+    { Hankel( A, Height(), Width(), a_ ); }
+    template<Distribution U,Distribution V>
+    void Materialize( DistMatrix<T,U,V>& A ) const 
+    { Hankel( A, Height(), Width(), a_ ); }
+
+private:
+    std::vector<T> a_;
+    ToeplitzOperator<T> toeplitz_;
+    mutable std::vector<T> work_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_HANKEL_HPP
@@ -68,8 +68,9 @@ MakeHermitianUniformSpectrum( Matrix<F>& A, BASE(F) lower=0, BASE(F) upper=1 )
     // Form d and D
     const int n = A.Height();
     std::vector<F> d( n );
+    const RandomStream stream = NextLocalRandomStream();
     for( int j=0; j<n; ++j )
-        d[j] = lower + (upper-lower)*Uniform();
+        d[j] = lower + (upper-lower)*stream.Uniform(j,0);
     Diagonal( A, d );
 
     // Form u 
@@ -124,10 +125,9 @@ MakeHermitianUniformSpectrum
     // Form d and D
     const int n = A.Height();
     std::vector<F> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = lower + (upper-lower)*Uniform();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
+    const RandomStream stream = NextRandomStream();
+    for( int j=0; j<n; ++j )
+        d[j] = lower + (upper-lower)*stream.Uniform(j,0);
     DistMatrix<F> ABackup( grid );
     if( standardDist )
         Diagonal( A, d );
@@ -10,6 +10,8 @@
 #ifndef MATRICES_HILBERT_HPP
 #define MATRICES_HILBERT_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename F>
@@ -82,6 +84,18 @@ MakeHilbert( DistMatrix<F,U,V>& A )
     }
 }
 
+// The Hilbert matrix as a matrix-free operator
+template<typename F>
+class HilbertOperator : public GeneratedOperator<F,HilbertOperator<F> >
+{
+public:
+    HilbertOperator( int n )
+    : GeneratedOperator<F,HilbertOperator<F> >( n, n )
+    { }
+
+    F Get( int i, int j ) const { return F(1)/F(i+j+1); }
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_HILBERT_HPP
@@ -10,6 +10,8 @@
 #ifndef MATRICES_KMS_HPP
 #define MATRICES_KMS_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -55,6 +57,28 @@ KMS( DistMatrix<T,U,V>& K, int n, T rho )
     }
 }
 
+// The KMS matrix as a matrix-free operator
+template<typename T>
+class KMSOperator : public GeneratedOperator<T,KMSOperator<T> >
+{
+public:
+    KMSOperator( int n, T rho )
+    : GeneratedOperator<T,KMSOperator<T> >( n, n )
+    {
+        rhoPows_.resize( n );
+        if( n > 0 )
+            rhoPows_[0] = 1;
+        for( int k=1; k<n; ++k )
+            rhoPows_[k] = rhoPows_[k-1]*rho;
+    }
+
+    T Get( int i, int j ) const
+    { return ( i < j ? rhoPows_[j-i] : Conj(rhoPows_[i-j]) ); }
+
+private:
+    std::vector<T> rhoPows_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_KMS_HPP
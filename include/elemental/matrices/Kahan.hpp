@@ -10,6 +10,8 @@
 #ifndef MATRICES_KAHAN_HPP
 #define MATRICES_KAHAN_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 // I haven't decided on the appropriate generalization to complex cosine/sine
 // pairs. For now, given phi, we will compute the corresponding partner as the
 // real value sqrt(1-|phi|^2)
@@ -61,7 +63,7 @@ MakeKahan( Matrix<F>& A, F phi )
     {
         const F zetaPow = Pow( zeta, R(i) );
         A.Set( i, i, zetaPow );
-        for( int j=1; j<n; ++j )
+        for( int j=i+1; j<n; ++j )
             A.Set( i, j, -phi*zetaPow );
     }
 }
@@ -107,6 +109,38 @@ MakeKahan( DistMatrix<F,U,V>& A, F phi )
     }
 }
 
+// The Kahan matrix as a matrix-free operator
+template<typename F>
+class KahanOperator : public GeneratedOperator<F,KahanOperator<F> >
+{
+public:
+    KahanOperator( int n, F phi )
+    : GeneratedOperator<F,KahanOperator<F> >( n, n ), phi_(phi)
+    {
+        typedef BASE(F) R;
+        if( Abs(phi) >= R(1) || Abs(phi) == R(0) )
+            throw std::logic_error("|phi| must be in (0,1)");
+        const F zeta = Sqrt(1-phi*Conj(phi));
+        zetaPows_.resize( n );
+        for( int i=0; i<n; ++i )
+            zetaPows_[i] = Pow( zeta, R(i) );
+    }
+
+    F Get( int i, int j ) const
+    {
+        if( i > j )
+            return F(0);
+        else if( i == j )
+            return zetaPows_[i];
+        else
+            return -phi_*zetaPows_[i];
+    }
+
+private:
+    F phi_;
+    std::vector<F> zetaPows_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_KAHAN_HPP
@@ -10,6 +10,8 @@
 #ifndef MATRICES_LEHMER_HPP
 #define MATRICES_LEHMER_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename F> 
@@ -57,6 +59,19 @@ Lehmer( DistMatrix<F,U,V>& L, int n )
     }
 }
 
+// The Lehmer matrix as a matrix-free operator
+template<typename F>
+class LehmerOperator : public GeneratedOperator<F,LehmerOperator<F> >
+{
+public:
+    LehmerOperator( int n )
+    : GeneratedOperator<F,LehmerOperator<F> >( n, n )
+    { }
+
+    F Get( int i, int j ) const
+    { return ( i < j ? F(i+1)/F(j+1) : F(j+1)/F(i+1) ); }
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_LEHMER_HPP
@@ -10,6 +10,8 @@
 #ifndef MATRICES_MINIJ_HPP
 #define MATRICES_MINIJ_HPP
 
+#include "elemental/matrices/GeneratedOperator.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -50,6 +52,18 @@ MinIJ( DistMatrix<T,U,V>& M, int n )
     }
 }
 
+// The MinIJ matrix as a matrix-free operator
+template<typename T>
+class MinIJOperator : public GeneratedOperator<T,MinIJOperator<T> >
+{
+public:
+    MinIJOperator( int n )
+    : GeneratedOperator<T,MinIJOperator<T> >( n, n )
+    { }
+
+    T Get( int i, int j ) const { return T(std::min(i+1,j+1)); }
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_MINIJ_HPP
@@ -68,8 +68,9 @@ MakeNormalUniformSpectrum
     // Form d and D
     const int n = A.Height();
     std::vector<C> d( n );
+    const RandomStream stream = NextLocalRandomStream();
     for( int j=0; j<n; ++j )
-        d[j] = center + radius*SampleUnitBall<C>();
+        d[j] = center + radius*stream.SampleUnitBall<C>(j,0);
     Diagonal( A, d );
 
     // Form u 
@@ -123,10 +124,9 @@ MakeNormalUniformSpectrum
     // Form d and D
     const int n = A.Height();
     std::vector<C> d( n );
-    if( grid.Rank() == 0 )
-        for( int j=0; j<n; ++j )
-            d[j] = center + radius*SampleUnitBall<C>();
-    mpi::Broadcast( &d[0], n, 0, grid.Comm() );
+    const RandomStream stream = NextRandomStream();
+    for( int j=0; j<n; ++j )
+        d[j] = center + radius*stream.SampleUnitBall<C>(j,0);
     DistMatrix<C> ABackup( grid );
     if( standardDist )
         Diagonal( A, d );
@@ -0,0 +1,104 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef MATRICES_RADEMACHER_HPP
+#define MATRICES_RADEMACHER_HPP
+
+namespace elem {
+
+// Draw each entry independently from {-1,+1} with equal probability.
+//
+// As with Uniform, the entries come from a counter-based stream, so that
+// the result is independent of the process grid and distribution.
+template<typename T>
+inline void
+MakeRademacher( Matrix<T>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeRademacher");
+#endif
+    const int m = A.Height();
+    const int n = A.Width();
+    const RandomStream stream = NextLocalRandomStream();
+    T* buffer = A.Buffer();
+    const int ldim = A.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int j=0; j<n; ++j )
+    {
+        for( int i=0; i<m; ++i )
+        {
+            unsigned words[4];
+            stream.Sample( i, j, words );
+            buffer[i+j*ldim] = ( words[0] & 1u ? T(1) : T(-1) );
+        }
+    }
+}
+
+template<typename T>
+inline void
+Rademacher( Matrix<T>& A, int m, int n )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Rademacher");
+#endif
+    A.ResizeTo( m, n );
+    MakeRademacher( A );
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+MakeRademacher( DistMatrix<T,U,V>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("MakeRademacher");
+#endif
+    const RandomStream stream = NextRandomStream();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    T* buffer = A.Buffer();
+    const int ldim = A.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = rowShift + jLocal*rowStride;
+        T* col = &buffer[jLocal*ldim];
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = colShift + iLocal*colStride;
+            unsigned words[4];
+            stream.Sample( i, j, words );
+            col[iLocal] = ( words[0] & 1u ? T(1) : T(-1) );
+        }
+    }
+}
+
+template<typename T,Distribution U,Distribution V>
+inline void
+Rademacher( DistMatrix<T,U,V>& A, int m, int n )
+{
+#ifndef RELEASE
+    CallStackEntry entry("Rademacher");
+#endif
+    A.ResizeTo( m, n );
+    MakeRademacher( A );
+}
+
+} // namespace elem
+
+#endif // ifndef MATRICES_RADEMACHER_HPP
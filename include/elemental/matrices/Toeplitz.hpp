@@ -10,6 +10,8 @@
 #ifndef MATRICES_TOEPLITZ_HPP
 #define MATRICES_TOEPLITZ_HPP
 
+#include "elemental/matrices/Circulant.hpp"
+
 namespace elem {
 
 template<typename T> 
@@ -58,6 +60,106 @@ Toeplitz( DistMatrix<T,U,V>& A, int m, int n, const std::vector<T>& a )
     }
 }
 
+namespace toeplitz {
+
+// The first column of the smallest power-of-two circulant matrix which
+// contains the m x n Toeplitz matrix defined by 'a' in its top-left corner
+template<typename T>
+inline std::vector<T>
+CirculantEmbedding( int m, int n, const std::vector<T>& a )
+{
+    const int length = m+n-1;
+    if( a.size() != (unsigned)length )
+        throw std::logic_error("a was the wrong size");
+    int L = 1;
+    while( L < length )
+        L *= 2;
+    std::vector<T> c( L, T(0) );
+    for( int k=0; k<m; ++k )
+        c[k] = a[k+(n-1)];
+    for( int k=1; k<n; ++k )
+        c[L-k] = a[(n-1)-k];
+    return c;
+}
+
+} // namespace toeplitz
+
+// An implicit representation of the m x n Toeplitz matrix 
+// A(i,j) = a[i-j+(n-1)], which is applied in O((m+n) log(m+n)) work per
+// vector by embedding it within a circulant matrix
+template<typename T>
+class ToeplitzOperator
+{
+public:
+    ToeplitzOperator( int m, int n, const std::vector<T>& a )
+    : m_(m), n_(n), a_(a), circulant_(toeplitz::CirculantEmbedding(m,n,a))
+    { }
+
+    int Height() const { return m_; }
+    int Width() const { return n_; }
+
+    // Y := alpha op(A) X + beta Y
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const Matrix<T>& X, T beta, Matrix<T>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    template<Distribution U,Distribution V>
+    void Multiply
+    ( Orientation orientation,
+      T alpha, const DistMatrix<T,U,V>& X, T beta, DistMatrix<T,U,V>& Y ) const
+    { fft::MultiplyColumns( *this, orientation, alpha, X, beta, Y ); }
+
+    // Y := A X
+    template<class MatrixType>
+    void operator()( const MatrixType& X, MatrixType& Y ) const
+    {
+        Zeros( Y, Height(), X.Width() );
+        Multiply( NORMAL, T(1), X, T(0), Y );
+    }
+
+    // Z := op(A) X, where each column of X is stored locally
+    void ApplyToColumns
+    ( Orientation orientation, const Matrix<T>& X, Matrix<T>& Z ) const
+    {
+#ifndef RELEASE
+        CallStackEntry entry("ToeplitzOperator::ApplyToColumns");
+#endif
+        const int inHeight = ( orientation == NORMAL ? n_ : m_ );
+        const int outHeight = ( orientation == NORMAL ? m_ : n_ );
+        if( X.Height() != inHeight )
+            throw std::logic_error("X is the wrong height");
+        const int width = X.Width();
+        Z.ResizeTo( outHeight, width );
+        if( outHeight == 0 )
+            return;
+        for( int j=0; j<width; ++j )
+            ApplyToVector
+            ( orientation, X.LockedBuffer(0,j), Z.Buffer(0,j) );
+    }
+
+    // y := op(A) x
+    void ApplyToVector( Orientation orientation, const T* x, T* y ) const
+    {
+        // Since A is the top-left corner of the circulant matrix C, op(A)
+        // is the top-left corner of op(C)
+        const int inHeight = ( orientation == NORMAL ? n_ : m_ );
+        const int outHeight = ( orientation == NORMAL ? m_ : n_ );
+        circulant_.ApplyToVector( orientation, x, inHeight, y, outHeight );
+    }
+
+    // Explicitly form the matrix
+    void Materialize( Matrix<T>& A ) const { Toeplitz( A, m_, n_, a_ ); }
+    template<Distribution U,Distribution V>
+    void Materialize( DistMatrix<T,U,V>& A ) const 
+    { Toeplitz( A, m_, n_, a_ ); }
+
+private:
+    int m_, n_;
+    std::vector<T> a_;
+    CirculantOperator<T> circulant_;
+};
+
 } // namespace elem
 
 #endif // ifndef MATRICES_TOEPLITZ_HPP
@@ -2,8 +2,8 @@
    Copyright (c) 2009-2013, Jack Poulson
    All rights reserved.
 
-   This file is part of Elemental and is under the BSD 2-Clause License, 
-   which can be found in the LICENSE file in the root directory, or at 
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
    http://opensource.org/licenses/BSD-2-Clause
 */
 #pragma once
@@ -13,6 +13,10 @@
 namespace elem {
 
 // Draw each entry from a uniform PDF over the closed unit ball.
+//
+// The entries are generated by a counter-based stream, so that entry (i,j)
+// only depends upon the seed and the number of random matrices previously
+// generated (see RandomStream).
 template<typename T>
 inline void
 MakeUniform( Matrix<T>& A, T center=0, BASE(T) radius=1 )
@@ -22,9 +26,15 @@ MakeUniform( Matrix<T>& A, T center=0, BASE(T) radius=1 )
 #endif
     const int m = A.Height();
     const int n = A.Width();
+    const RandomStream stream = NextLocalRandomStream();
+    T* buffer = A.Buffer();
+    const int ldim = A.LDim();
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
     for( int j=0; j<n; ++j )
         for( int i=0; i<m; ++i )
-            A.Set( i, j, center+radius*SampleUnitBall<T>() );
+            buffer[i+j*ldim] = center + radius*stream.SampleUnitBall<T>(i,j);
 }
 
 template<typename T>
@@ -39,313 +49,40 @@ Uniform
     MakeUniform( A, center, radius );
 }
 
-namespace internal {
-
+// Since each process can independently generate any entry, no communication
+// is required for any distribution, and replicated entries agree. The result
+// is identical for every process grid and distribution.
 template<typename T,Distribution U,Distribution V>
-struct MakeUniformHelper
-{
-    static void Func( DistMatrix<T,U,V>& A, T center, BASE(T) radius );  
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MC,MR>
-{
-    static void Func( DistMatrix<T,MC,MR>& A, T center, BASE(T) radius )
-    {
-        const int localHeight = A.LocalHeight(); 
-        const int localWidth = A.LocalWidth();
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-            for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                A.SetLocal( iLocal, jLocal, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MC,STAR>
+inline void
+MakeUniform( DistMatrix<T,U,V>& A, T center=0, BASE(T) radius=1 )
 {
-    static void Func( DistMatrix<T,MC,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        if( grid.InGrid() )
-        {
-            const int n = A.Width();
-            const int localHeight = A.LocalHeight();
-            const int bufSize = localHeight*n;
-            std::vector<T> buffer( bufSize );
-
-            // Create random matrix on process column 0, then broadcast
-            if( grid.Col() == 0 )
-            {
-                for( int j=0; j<n; ++j )
-                    for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                        buffer[iLocal+j*localHeight] = 
-                            center + radius*SampleUnitBall<T>();
-            }
-            mpi::Broadcast( &buffer[0], bufSize, 0, grid.RowComm() );
-
-            // Unpack
-            T* localBuffer = A.Buffer();
-            const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
+#ifndef RELEASE
+    CallStackEntry entry("MakeUniform");
 #endif
-            for( int j=0; j<n; ++j )
-            {
-                const T* bufferCol = &buffer[j*localHeight];
-                T* col = &localBuffer[j*ldim];
-                MemCopy( col, bufferCol, localHeight );
-            }
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MD,STAR>
-{
-    static void Func( DistMatrix<T,MD,STAR>& A, T center, BASE(T) radius )
-    {
-        if( A.Participating() )
-        {
-            const int n = A.Width();
-            const int localHeight = A.LocalHeight();
-            for( int j=0; j<n; ++j )
-                for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                    A.SetLocal( iLocal, j, center+radius*SampleUnitBall<T>() );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MR,MC>
-{
-    static void Func( DistMatrix<T,MR,MC>& A, T center, BASE(T) radius )
-    {
-        const int localHeight = A.LocalHeight(); 
-        const int localWidth = A.LocalWidth();
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-            for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                A.SetLocal( iLocal, jLocal, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,MR,STAR>
-{
-    static void Func( DistMatrix<T,MR,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        const int bufSize = localHeight*n;
-        std::vector<T> buffer( bufSize );
-
-        // Create random matrix on process row 0, then broadcast
-        if( grid.Row() == 0 )
-        {
-            for( int j=0; j<n; ++j )
-                for( int i=0; i<localHeight; ++i )
-                    buffer[i+j*localHeight] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.ColComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
+    const RandomStream stream = NextRandomStream();
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    if( localHeight == 0 || localWidth == 0 )
+        return;
+    const int colShift = A.ColShift();
+    const int rowShift = A.RowShift();
+    const int colStride = A.ColStride();
+    const int rowStride = A.RowStride();
+    T* buffer = A.Buffer();
+    const int ldim = A.LDim();
 #ifdef HAVE_OPENMP
-        #pragma omp parallel for COLLAPSE(2)
+    #pragma omp parallel for
 #endif
-        for( int j=0; j<n; ++j )
-            for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                localBuffer[iLocal+j*ldim] = buffer[iLocal+j*localHeight];
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MC>
-{
-    static void Func( DistMatrix<T,STAR,MC>& A, T center, BASE(T) radius )
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
     {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        const int bufSize = m*localWidth;
-        std::vector<T> buffer( bufSize );
-
-        // Create a random matrix on process column 0, then broadcast
-        if( grid.Col() == 0 )
-        {
-            for( int jLocal=0; jLocal<localWidth; ++jLocal )
-                for( int i=0; i<m; ++i )
-                    buffer[i+jLocal*m] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.RowComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
+        const int j = rowShift + jLocal*rowStride;
+        T* col = &buffer[jLocal*ldim];
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
         {
-            const T* bufferCol = &buffer[jLocal*m];
-            T* col = &localBuffer[jLocal*ldim];
-            MemCopy( col, bufferCol, m );
+            const int i = colShift + iLocal*colStride;
+            col[iLocal] = center + radius*stream.SampleUnitBall<T>(i,j);
         }
     }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MD>
-{
-    static void Func( DistMatrix<T,STAR,MD>& A, T center, BASE(T) radius )
-    {
-        if( A.Participating() )
-        {
-            const int m = A.Height();
-            const int localWidth = A.LocalWidth();
-            for( int jLocal=0; jLocal<localWidth; ++jLocal )
-                for( int i=0; i<m; ++i )
-                    A.SetLocal( i, jLocal, center+radius*SampleUnitBall<T>() );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,MR>
-{
-    static void Func( DistMatrix<T,STAR,MR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        const int bufSize = m*localWidth;
-        std::vector<T> buffer( bufSize );
-
-        // Create random matrix on process row 0, then broadcast
-        if( grid.Row() == 0 )
-        {
-            for( int j=0; j<localWidth; ++j )
-                for( int i=0; i<m; ++i )
-                    buffer[i+j*m] = center+radius*SampleUnitBall<T>();
-        }
-        mpi::Broadcast( &buffer[0], bufSize, 0, grid.ColComm() );
-
-        // Unpack
-        T* localBuffer = A.Buffer();
-        const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-        #pragma omp parallel for
-#endif
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-        {
-            const T* bufferCol = &buffer[jLocal*m];
-            T* col = &localBuffer[jLocal*ldim];
-            MemCopy( col, bufferCol, m );
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,STAR>
-{
-    static void Func( DistMatrix<T,STAR,STAR>& A, T center, BASE(T) radius )
-    {
-        const Grid& grid = A.Grid();
-        const int m = A.Height();
-        const int n = A.Width();
-        const int bufSize = m*n;
-
-        if( grid.InGrid() )
-        {
-            std::vector<T> buffer( bufSize );
-
-            if( grid.Rank() == 0 )
-            {
-                for( int j=0; j<n; ++j )
-                    for( int i=0; i<m; ++i )
-                        buffer[i+j*m] = center+radius*SampleUnitBall<T>();
-            }
-            mpi::Broadcast( &buffer[0], bufSize, 0, grid.Comm() );
-
-            // Unpack
-            T* localBuffer = A.Buffer();
-            const int ldim = A.LDim();
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( int j=0; j<n; ++j )
-            {
-                const T* bufferCol = &buffer[j*m];
-                T* col = &localBuffer[j*ldim];
-                MemCopy( col, bufferCol, m );
-            }
-        }
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,VC>
-{
-    static void Func( DistMatrix<T,STAR,VC>& A, T center, BASE(T) radius )
-    {
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-            for( int i=0; i<m; ++i )
-                A.SetLocal( i, jLocal, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,STAR,VR>
-{
-    static void Func( DistMatrix<T,STAR,VR>& A, T center, BASE(T) radius )
-    {
-        const int m = A.Height();
-        const int localWidth = A.LocalWidth();
-        for( int jLocal=0; jLocal<localWidth; ++jLocal )
-            for( int i=0; i<m; ++i )
-                A.SetLocal( i, jLocal, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,VC,STAR>
-{
-    static void Func( DistMatrix<T,VC,STAR>& A, T center, BASE(T) radius )
-    {
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        for( int j=0; j<n; ++j )
-            for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                A.SetLocal( iLocal, j, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-template<typename T>
-struct MakeUniformHelper<T,VR,STAR>
-{
-    static void Func( DistMatrix<T,VR,STAR>& A, T center, BASE(T) radius )
-    {
-        const int n = A.Width();
-        const int localHeight = A.LocalHeight();
-        for( int j=0; j<n; ++j )
-            for( int iLocal=0; iLocal<localHeight; ++iLocal )
-                A.SetLocal( iLocal, j, center+radius*SampleUnitBall<T>() );
-    }
-};
-
-} // namespace internal
-
-template<typename T,Distribution U,Distribution V>
-inline void
-MakeUniform( DistMatrix<T,U,V>& A, T center=0, BASE(T) radius=1 )
-{
-#ifndef RELEASE
-    CallStackEntry entry("Uniform");
-#endif
-    internal::MakeUniformHelper<T,U,V>::Func( A, center, radius );
 }
 
 template<typename T,Distribution U,Distribution V>
@@ -55,6 +55,7 @@
 //
 
 #include "./matrices/Uniform.hpp"
+#include "./matrices/Rademacher.hpp"
 #include "./matrices/HermitianUniformSpectrum.hpp"
 #include "./matrices/NormalUniformSpectrum.hpp"
 
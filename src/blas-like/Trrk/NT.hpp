@@ -46,6 +46,7 @@ void TrrkNT
     B1_VR_STAR.AlignWith( C );
     B1AdjOrTrans_STAR_MR.AlignWith( C );
 
+    ScaleTrapezoid( beta, LEFT, uplo, 0, C );
     LockedPartitionRight( A, AL, AR, 0 );
     LockedPartitionRight( B, BL, BR, 0 );
     while( AL.Width() < A.Width() )
@@ -64,7 +65,7 @@ void TrrkNT
             B1AdjOrTrans_STAR_MR.AdjointFrom( B1_VR_STAR );
         else
             B1AdjOrTrans_STAR_MR.TransposeFrom( B1_VR_STAR );
-        LocalTrrk( uplo, alpha, A1_MC_STAR, B1AdjOrTrans_STAR_MR, beta, C );
+        LocalTrrk( uplo, alpha, A1_MC_STAR, B1AdjOrTrans_STAR_MR, T(1), C );
         //--------------------------------------------------------------------//
 
         SlideLockedPartitionRight
@@ -599,6 +599,57 @@ AbstractDistMatrix<T,Int>::SetGrid( const elem::Grid& grid )
     SetShifts();
 }
 
+template<typename T,typename Int>
+bool
+AbstractDistMatrix<T,Int>::CopyIfCoincident
+( const AbstractDistMatrix<T,Int>& A )
+{
+#ifndef RELEASE
+    CallStackEntry entry("AbstractDistMatrix::CopyIfCoincident");
+#endif
+    const elem::DistData<Int> AData = A.DistData();
+    elem::DistData<Int> thisData = DistData();
+    if( !viewing_ )
+    {
+        if( !constrainedColAlignment_ )
+            thisData.colAlignment = AData.colAlignment;
+        if( !constrainedRowAlignment_ )
+            thisData.rowAlignment = AData.rowAlignment;
+    }
+    if( !DistributionsCoincide( thisData, AData ) )
+        return false;
+
+    if( !viewing_ )
+    {
+        colAlignment_ = thisData.colAlignment;
+        rowAlignment_ = thisData.rowAlignment;
+        SetShifts();
+        ResizeTo( A.Height(), A.Width() );
+    }
+    if( !Participating() )
+        return true;
+#ifndef RELEASE
+    if( LocalHeight() != A.LocalHeight() || LocalWidth() != A.LocalWidth() )
+        throw std::logic_error("Coinciding distributions had different sizes");
+#endif
+
+    const Int localHeight = LocalHeight();
+    const Int localWidth = LocalWidth();
+    const T* ABuffer = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* thisBuffer = Buffer();
+    const Int thisLDim = LDim();
+    if( thisBuffer == ABuffer && thisLDim == ALDim )
+        return true;
+#ifdef HAVE_OPENMP
+    #pragma omp parallel for
+#endif
+    for( Int jLocal=0; jLocal<localWidth; ++jLocal )
+        MemCopy
+        ( &thisBuffer[jLocal*thisLDim], &ABuffer[jLocal*ALDim], localHeight );
+    return true;
+}
+
 template class AbstractDistMatrix<int,int>;
 #ifndef DISABLE_FLOAT
 template class AbstractDistMatrix<float,int>;
@@ -336,8 +336,7 @@ DistMatrix<T,MC,MR,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+(rowShift+jLocal*c)*height];
         const T* sourceCol = &thisBuffer[jLocal*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*r] = sourceCol[iLocal];
+        StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -823,32 +822,10 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         const Int ALDim = A.LDim();
         T* buffer = this->Buffer();
         const Int ldim = this->LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &buffer[jLocal*ldim];
-                const T* sourceCol = &ABuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &buffer[jLocal*ldim];
-                const T* sourceCol = &ABuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( localHeight, localWidth,
+          &ABuffer[rowShift], ALDim, rowStride,
+          buffer, 1, ldim, conjugate );
     }
     else
     {
@@ -879,32 +856,10 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*localWidth];
-                const T* sourceCol = &ABuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localWidthA; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*localWidth];
-                const T* sourceCol = &ABuffer[rowShift+jLocal*rowStride];
-                for( Int iLocal=0; iLocal<localWidthA; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( localWidthA, localWidth,
+          &ABuffer[rowShift], ALDim, rowStride,
+          sendBuffer, 1, localWidthA, conjugate );
 
         // Communicate
         mpi::SendRecv
@@ -972,32 +927,10 @@ DistMatrix<T,MC,MR,Int>::TransposeFrom
         const Int ALDim = A.LDim();
         T* buffer = this->Buffer();
         const Int ldim = this->LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &buffer[jLocal*ldim];
-                const T* sourceCol = &ABuffer[jLocal+colShift*ALDim];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*colStride*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &buffer[jLocal*ldim];
-                const T* sourceCol = &ABuffer[jLocal+colShift*ALDim];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*colStride*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( localHeight, localWidth,
+          &ABuffer[colShift*ALDim], colStride*ALDim, 1,
+          buffer, 1, ldim, conjugate );
     }
 }
 
@@ -1075,6 +1008,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
     {
         if( this->Grid() == A.Grid() )
@@ -1357,6 +1292,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1467,6 +1404,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1499,8 +1438,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
         {
             T* destCol = &thisBuffer[jLocal*thisLDim];
             const T* sourceCol = &ABuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
         }
     }
     else
@@ -1542,8 +1480,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
         {
             T* destCol = &sendBuffer[jLocal*localHeight];
             const T* sourceCol = &ABuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*r];
+            StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
         }
 
         // Communicate
@@ -1609,6 +1546,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
@@ -1839,6 +1778,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 
     std::auto_ptr<DistMatrix<T,VR,STAR,Int> > A_VR_STAR
@@ -1865,6 +1806,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 
     std::auto_ptr<DistMatrix<T,STAR,VC,Int> > A_STAR_VC
@@ -1891,6 +1834,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 
     if( !this->Viewing() )
@@ -1924,11 +1869,25 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
         const Int maxWidth = MaxLength(width,c);
         const Int portionSize = std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
 
-        this->auxMemory_.Require( 2*c*portionSize );
-
-        T* buffer = this->auxMemory_.Buffer();
-        T* sendBuffer = &buffer[0];
-        T* recvBuffer = &buffer[c*portionSize];
+        // If requested, pack directly into a window which is shared with the
+        // on-node members of our process row so that they may unpack from it
+        T *sendBuffer, *recvBuffer;
+        const bool sharedWindows = g.SharedWindows();
+        if( sharedWindows )
+        {
+            mpi::SharedWindowRequire
+            ( g.MRSharedWindow(), c*portionSize*sizeof(T) );
+            this->auxMemory_.Require( c*portionSize );
+            sendBuffer = reinterpret_cast<T*>(g.MRSharedWindow().buffer);
+            recvBuffer = this->auxMemory_.Buffer();
+        }
+        else
+        {
+            this->auxMemory_.Require( 2*c*portionSize );
+            T* buffer = this->auxMemory_.Buffer();
+            sendBuffer = &buffer[0];
+            recvBuffer = &buffer[c*portionSize];
+        }
 
         // Pack
         const T* ABuffer = A.LockedBuffer();
@@ -1955,9 +1914,21 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
         }
 
         // Communicate
-        mpi::AllToAll
-        ( sendBuffer, portionSize,
-          recvBuffer, portionSize, g.RowComm() );
+        std::vector<const T*> portions( c );
+        if( sharedWindows )
+        {
+            mpi::SharedAllToAll
+            ( portionSize, recvBuffer, portionSize, 
+              g.MRTwoLevelComm(), g.MRSharedWindow(), portions );
+        }
+        else
+        {
+            mpi::AllToAll
+            ( sendBuffer, portionSize,
+              recvBuffer, portionSize, g.RowComm() );
+            for( Int k=0; k<c; ++k )
+                portions[k] = &recvBuffer[k*portionSize];
+        }
 
         // Unpack
         T* thisBuffer = this->Buffer();
@@ -1967,7 +1938,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
 #endif
         for( Int k=0; k<c; ++k )
         {
-            const T* data = &recvBuffer[k*portionSize];
+            const T* data = portions[k];
 
             const Int thisRank = row+k*r;
             const Int thisColShift = Shift_(thisRank,colAlignmentA,p);
@@ -1981,10 +1952,11 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
+        if( sharedWindows )
+            mpi::SharedWindowSync( g.MRSharedWindow() );
         this->auxMemory_.Release();
     }
     else
@@ -2077,8 +2049,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -2097,6 +2068,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VR,Int> A_STAR_VR(true,this->RowAlignment(),g);
 
@@ -2116,6 +2089,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VC,STAR,Int> A_VC_STAR(true,this->ColAlignment(),g);
 
@@ -2135,6 +2110,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -2193,8 +2170,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -2283,8 +2259,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -2340,6 +2315,8 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
 
@@ -2362,8 +2339,7 @@ DistMatrix<T,MC,MR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisBuffer[jLocal*thisLDim];
         const T* sourceCol = &ABuffer[colShift+(rowShift+jLocal*c)*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*r];
+        StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
     }
     return *this;
 }
@@ -2700,8 +2676,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -2777,8 +2752,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -2870,8 +2844,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterFrom( const DistMatrix<T,STAR,STAR,Int>& A )
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ABuffer[thisColShift+(thisRowShift+jLocal*c)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
     }
@@ -3218,8 +3191,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -3298,8 +3270,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
 
@@ -3394,8 +3365,7 @@ DistMatrix<T,MC,MR,Int>::SumScatterUpdate
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ABuffer[thisColShift+(thisRowShift+jLocal*c)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*r];
+                StridedMemCopy( destCol, 1, sourceCol, r, thisLocalHeight );
             }
         }
     }
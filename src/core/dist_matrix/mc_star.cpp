@@ -296,8 +296,7 @@ DistMatrix<T,MC,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+jLocal*height];
             const T* sourceCol = &thisBuffer[jLocal*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*r] = sourceCol[iLocal];
+            StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
         }
 
         // If we are the root, allocate a receive buffer
@@ -768,6 +767,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -825,9 +826,14 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             }
 
             // Communicate
-            mpi::AllGather
-            ( originalData, portionSize,
-              gatheredData, portionSize, g.RowComm() );
+            if( g.NodeAware() )
+                mpi::AllGather
+                ( originalData, portionSize,
+                  gatheredData, portionSize, g.MRTwoLevelComm() );
+            else
+                mpi::AllGather
+                ( originalData, portionSize,
+                  gatheredData, portionSize, g.RowComm() );
 
             // Unpack
             const Int rowAlignmentOfA = A.RowAlignment();
@@ -940,9 +946,14 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
               g.ColComm() );
 
             // Use the output of the SendRecv as the input to the AllGather
-            mpi::AllGather
-            ( firstBuffer,  portionSize, 
-              secondBuffer, portionSize, g.RowComm() );
+            if( g.NodeAware() )
+                mpi::AllGather
+                ( firstBuffer,  portionSize, 
+                  secondBuffer, portionSize, g.MRTwoLevelComm() );
+            else
+                mpi::AllGather
+                ( firstBuffer,  portionSize, 
+                  secondBuffer, portionSize, g.RowComm() );
 
             // Unpack the contents of each member of the process row
             const Int rowAlignmentOfA = A.RowAlignment();
@@ -984,6 +995,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1076,6 +1089,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(true,false,this->ColAlignment(),0,g);
 
@@ -1125,6 +1140,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VR,STAR,Int> > A_VR_STAR
     ( new DistMatrix<T,VR,STAR,Int>(g) );
@@ -1150,6 +1167,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VR,STAR,Int> > A_VR_STAR
     ( new DistMatrix<T,VR,STAR,Int>(g) );
@@ -1175,6 +1194,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MR,MC,Int> > 
         A_MR_MC( new DistMatrix<T,MR,MC,Int>(g) );
@@ -1205,6 +1226,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 #ifdef VECTOR_WARNINGS
     if( A.Width() == 1 && g.Rank() == 0 )
@@ -1299,8 +1322,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1383,8 +1405,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1403,6 +1424,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VR,Int> > 
         A_STAR_VR( new DistMatrix<T,STAR,VR,Int>(g) );
@@ -1429,6 +1452,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VC,STAR,Int> A_VC_STAR(true,this->ColAlignment(),g);
 
@@ -1448,6 +1473,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(true,false,this->ColAlignment(),0,g);
 
@@ -1467,6 +1494,8 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
 
@@ -1487,8 +1516,7 @@ DistMatrix<T,MC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisBuffer[j*thisLDim];
         const T* sourceCol = &ABuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*r];
+        StridedMemCopy( destCol, 1, sourceCol, r, localHeight );
     }
     return *this;
 }
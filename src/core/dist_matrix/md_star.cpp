@@ -388,8 +388,7 @@ DistMatrix<T,MD,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+j*height];
             const T* sourceCol = &thisBuffer[j*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*lcm] = sourceCol[iLocal];
+            StridedMemCopy( destCol, lcm, sourceCol, 1, localHeight );
         }
     }
 
@@ -793,8 +792,7 @@ DistMatrix<T,MD,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
         {
             T* destCol = &thisBuffer[j*thisLDim];
             const T* sourceCol = &ABuffer[colShift+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*lcm];
+            StridedMemCopy( destCol, 1, sourceCol, lcm, localHeight );
         }
     }
     return *this;
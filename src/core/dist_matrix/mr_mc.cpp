@@ -330,8 +330,7 @@ DistMatrix<T,MR,MC,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+(rowShift+jLocal*r)*height];
         const T* sourceCol = &thisBuffer[jLocal*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*c] = sourceCol[iLocal];
+        StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -780,6 +779,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
         ResizeTo( A.Height(), A.Width() );
@@ -1009,6 +1010,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VC,STAR,Int> > A_VC_STAR
     ( new DistMatrix<T,VC,STAR,Int>(g) );
@@ -1034,6 +1037,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VR,Int> > A_STAR_VR
     ( new DistMatrix<T,STAR,VR,Int>(g) );
@@ -1089,6 +1094,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1197,6 +1204,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1308,6 +1317,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1340,8 +1351,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
         {
             T* destCol = &thisBuffer[jLocal*thisLDim];
             const T* sourceCol = &ABuffer[colShift+jLocal*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
     }
     else
@@ -1383,8 +1393,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
         {
             T* destCol = &sendBuffer[jLocal*localHeight];
             const T* sourceCol = &ABuffer[colShift+jLocal];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
 
         // Communicate
@@ -1420,6 +1429,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VR,STAR,Int> A_VR_STAR(g);
 
@@ -1439,6 +1450,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1498,8 +1511,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1589,8 +1601,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1645,6 +1656,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1735,8 +1748,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1831,8 +1843,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColOffset+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1851,6 +1862,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VC,Int> A_STAR_VC(g);
 
@@ -1870,6 +1883,8 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
 
@@ -1893,8 +1908,7 @@ DistMatrix<T,MR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisBuffer[jLocal*thisLDim];
         const T* sourceCol = &ABuffer[colShift+(rowShift+jLocal*r)*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*c];
+        StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
     }
     return *this;
 }
@@ -2230,8 +2244,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2307,8 +2320,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,MC,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2401,8 +2413,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterFrom( const DistMatrix<T,STAR,STAR,Int>& A )
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ABuffer[thisColShift+(thisRowShift+jLocal*r)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
     }
@@ -2746,8 +2757,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2824,8 +2834,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColShift+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -2920,8 +2929,7 @@ DistMatrix<T,MR,MC,Int>::SumScatterUpdate
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = 
                     &ABuffer[thisColShift+(thisRowShift+jLocal*r)*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
     }
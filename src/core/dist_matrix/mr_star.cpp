@@ -215,8 +215,7 @@ DistMatrix<T,MR,STAR,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+j*height];
             const T* sourceCol = &thisBuffer[j*thisLDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal*c] = sourceCol[iLocal];
+            StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
         }
 
         // If we are the root, allocate a receive buffer
@@ -481,32 +480,10 @@ DistMatrix<T,MR,STAR,Int>::TransposeFrom
         // Pack 
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*localHeight];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*localHeight];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( localHeight, localHeightOfA,
+          ABuffer, ALDim, 1,
+          originalData, 1, localHeight, conjugate );
 
         // Communicate
         mpi::AllGather
@@ -574,32 +551,10 @@ DistMatrix<T,MR,STAR,Int>::TransposeFrom
         // Pack the currently owned local data of A into the second buffer
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*localWidthOfA];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int iLocal=0; iLocal<localWidthOfA; ++iLocal )
-                    destCol[iLocal] = Conj( sourceCol[iLocal*ALDim] );
-            }
-        }
-        else
-        {
- #ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*localWidthOfA];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int iLocal=0; iLocal<localWidthOfA; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( localWidthOfA, localHeightOfA,
+          ABuffer, ALDim, 1,
+          secondBuffer, 1, localWidthOfA, conjugate );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -649,6 +604,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VC,STAR,Int> > A_VC_STAR
     ( new DistMatrix<T,VC,STAR,Int>(g) );
@@ -674,6 +631,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !g.InGrid() )
     {
@@ -782,6 +741,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MC,MR,Int> > A_MC_MR
     ( new DistMatrix<T,MC,MR,Int>(g) );
@@ -842,6 +803,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1011,6 +974,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1104,6 +1069,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MR,MC,Int> A_MR_MC(g);
 
@@ -1123,6 +1090,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VR,STAR,Int> A_VR_STAR(true,this->ColAlignment(),g);
 
@@ -1142,6 +1111,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MR,MC,Int> A_MR_MC(g);
 
@@ -1161,6 +1132,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 #ifdef CACHE_WARNINGS
     if( A.Width() != 1 && g.Rank() == 0 )
@@ -1246,8 +1219,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1330,8 +1302,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
             {
                 T* destCol = &thisBuffer[colOffset+j*thisLDim];
                 const T* sourceCol = &data[j*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1350,6 +1321,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VC,Int> > A_STAR_VC
     ( new DistMatrix<T,STAR,VC,Int>(g) );
@@ -1375,6 +1348,8 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
@@ -1396,8 +1371,7 @@ DistMatrix<T,MR,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisBuffer[j*thisLDim];
         const T* sourceCol = &ABuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*c];
+        StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
     }
     return *this;
 }
@@ -566,32 +566,10 @@ DistMatrix<T,STAR,MC,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
- #ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localHeightOfA,
+          ABuffer, ALDim, 1,
+          originalData, 1, height, conjugate );
 
         // Communicate
         mpi::AllGather
@@ -663,32 +641,10 @@ DistMatrix<T,STAR,MC,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for 
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localHeightOfA,
+          ABuffer, ALDim, 1,
+          secondBuffer, 1, height, conjugate );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -739,6 +695,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VR,Int> > A_STAR_VR
     ( new DistMatrix<T,STAR,VR,Int>(g) );
@@ -764,6 +722,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MC,MR,Int> > A_MC_MR
     ( new DistMatrix<T,MC,MR,Int>(g) );
@@ -794,6 +754,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( A.Height() == 1 )
     {
@@ -929,6 +891,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 #ifdef VECTOR_WARNINGS
     if( A.Height() == 1 && g.Rank() == 0 )
@@ -1017,8 +981,7 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &thisBuffer[colShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1098,8 +1061,7 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
             {
                 T* destCol = &thisBuffer[colShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*localHeight];
-                for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                    destCol[iLocal*c] = sourceCol[iLocal];
+                StridedMemCopy( destCol, c, sourceCol, 1, localHeight );
             }
         }
         this->auxMemory_.Release();
@@ -1118,6 +1080,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MR,MC,Int> A_MR_MC(g);
 
@@ -1137,6 +1101,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1229,6 +1195,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VR,STAR,Int> > A_VR_STAR
     ( new DistMatrix<T,VR,STAR,Int>(g) );
@@ -1254,6 +1222,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1431,6 +1401,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MR,MC,Int> A_MR_MC(g);
 
@@ -1450,6 +1422,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VC,Int> A_STAR_VC(true,this->RowAlignment(),g);
     *this = A_STAR_VC = A;
@@ -1467,6 +1441,8 @@ DistMatrix<T,STAR,MC,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
     if( !this->Participating() )
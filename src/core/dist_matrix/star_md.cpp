@@ -396,8 +396,7 @@ DistMatrix<T,STAR,MD,Int>::PrintBase
         {
             T* destCol = &sendBuf[colShift+jLocal*lcm*height];
             const T* sourceCol = &thisBuffer[jLocal*thisLDim];
-            for( Int i=0; i<height; ++i )
-                destCol[i] = sourceCol[i];
+            MemCopy( destCol, sourceCol, height );
         }
     }
 
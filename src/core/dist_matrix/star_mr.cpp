@@ -486,32 +486,10 @@ DistMatrix<T,STAR,MR,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &originalData[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localHeightOfA,
+          ABuffer, ALDim, 1,
+          originalData, 1, height, conjugate );
 
         // Communicate
         mpi::AllGather
@@ -583,32 +561,10 @@ DistMatrix<T,STAR,MR,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localHeightOfA; ++jLocal )
-            {
-                T* destCol = &secondBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[jLocal];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localHeightOfA,
+          ABuffer, ALDim, 1,
+          secondBuffer, 1, height, conjugate );
 
         // Perform the SendRecv: puts the new data into the first buffer
         mpi::SendRecv
@@ -659,6 +615,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
 #ifdef CACHE_WARNINGS
     if( A.Height() != 1 && g.Rank() == 0 )
@@ -751,9 +709,14 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             }
 
             // Communicate
-            mpi::AllGather
-            ( originalData, portionSize,
-              gatheredData, portionSize, g.ColComm() );
+            if( g.NodeAware() )
+                mpi::AllGather
+                ( originalData, portionSize,
+                  gatheredData, portionSize, g.MCTwoLevelComm() );
+            else
+                mpi::AllGather
+                ( originalData, portionSize,
+                  gatheredData, portionSize, g.ColComm() );
 
             // Unpack
             const Int colAlignmentOfA = A.ColAlignment();
@@ -776,8 +739,7 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 {
                     T* destCol = &thisBuffer[colShift+jLocal*thisLDim];
                     const T* sourceCol = &data[jLocal*localHeight];
-                    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                        destCol[iLocal*r] = sourceCol[iLocal];
+                    StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
                 }
             }
             this->auxMemory_.Release();
@@ -883,9 +845,14 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
               firstBuffer,  portionSize, recvCol, mpi::ANY_TAG, g.RowComm() );
 
             // Use the output of the SendRecv as input to the AllGather
-            mpi::AllGather
-            ( firstBuffer,  portionSize,
-              secondBuffer, portionSize, g.ColComm() );
+            if( g.NodeAware() )
+                mpi::AllGather
+                ( firstBuffer,  portionSize,
+                  secondBuffer, portionSize, g.MCTwoLevelComm() );
+            else
+                mpi::AllGather
+                ( firstBuffer,  portionSize,
+                  secondBuffer, portionSize, g.ColComm() );
 
             // Unpack the contents of each member of the process col
             const Int colAlignmentOfA = A.ColAlignment();
@@ -907,8 +874,7 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 {
                     T* destCol = &thisBuffer[colShift+jLocal*thisLDim];
                     const T* sourceCol = &data[jLocal*localHeight];
-                    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                        destCol[iLocal*r] = sourceCol[iLocal];
+                    StridedMemCopy( destCol, r, sourceCol, 1, localHeight );
                 }
             }
             this->auxMemory_.Release();
@@ -928,6 +894,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(false,true,0,this->RowAlignment(),g);
 
@@ -947,6 +915,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1069,6 +1039,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VC,Int> > A_STAR_VC
     ( new DistMatrix<T,STAR,VC,Int>(g) );
@@ -1094,6 +1066,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VR,STAR,Int> > A_VR_STAR
     ( new DistMatrix<T,VR,STAR,Int>(g) );
@@ -1124,6 +1098,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,STAR,VC,Int> > A_STAR_VC
     ( new DistMatrix<T,STAR,VC,Int>(g) );
@@ -1154,6 +1130,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(false,true,0,this->RowAlignment(),g);
 
@@ -1173,6 +1151,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VR,Int> A_STAR_VR(true,this->RowAlignment(),g);
 
@@ -1192,6 +1172,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,VC,STAR,Int> > A_VC_STAR
     ( new DistMatrix<T,VC,STAR,Int>(g) );
@@ -1217,6 +1199,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1394,6 +1378,8 @@ DistMatrix<T,STAR,MR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -421,32 +421,10 @@ DistMatrix<T,STAR,VR,Int>::TransposeFrom
         const Int thisLDim = this->LDim();
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &thisBuffer[jLocal*thisLDim];
-                const T* sourceCol = &ABuffer[rowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidth; ++jLocal )
-            {
-                T* destCol = &thisBuffer[jLocal*thisLDim];
-                const T* sourceCol = &ABuffer[rowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localWidth,
+          &ABuffer[rowOffset], ALDim, r,
+          thisBuffer, 1, thisLDim, conjugate );
     }
     else
     {
@@ -488,32 +466,10 @@ DistMatrix<T,STAR,VR,Int>::TransposeFrom
         // Pack
         const T* ABuffer = A.LockedBuffer();
         const Int ALDim = A.LDim();
-        if( conjugate )
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidthOfSend; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[sendRowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = Conj( sourceCol[i*ALDim] );
-            }
-        }
-        else
-        {
-#ifdef HAVE_OPENMP
-            #pragma omp parallel for
-#endif
-            for( Int jLocal=0; jLocal<localWidthOfSend; ++jLocal )
-            {
-                T* destCol = &sendBuffer[jLocal*height];
-                const T* sourceCol = &ABuffer[sendRowOffset+jLocal*r];
-                for( Int i=0; i<height; ++i )
-                    destCol[i] = sourceCol[i*ALDim];
-            }
-        }
+        InterleaveMatrix
+        ( height, localWidthOfSend,
+          &ABuffer[sendRowOffset], ALDim, r,
+          sendBuffer, 1, height, conjugate );
 
         // Communicate
         mpi::SendRecv
@@ -547,6 +503,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -636,8 +594,7 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -708,8 +665,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
 
         // SendRecv: properly align the [*,VR] via a trade in the column
         mpi::SendRecv
-        ( firstBuffer,  portionSize, sendCol, 0,
-          secondBuffer, portionSize, recvCol, mpi::ANY_TAG, g.RowComm() );
+        ( firstBuffer,  r*portionSize, sendCol, 0,
+          secondBuffer, r*portionSize, recvCol, mpi::ANY_TAG, g.RowComm() );
 
         // Unpack
         T* thisBuffer = this->Buffer();
@@ -731,8 +688,7 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &thisBuffer[thisColShift+jLocal*thisLDim];
                 const T* sourceCol = &data[jLocal*thisLocalHeight];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal*r] = sourceCol[iLocal];
+                StridedMemCopy( destCol, r, sourceCol, 1, thisLocalHeight );
             }
         }
         this->auxMemory_.Release();
@@ -751,6 +707,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(g);
 
@@ -770,6 +728,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -925,6 +885,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VC,Int> A_STAR_VC(g);
 
@@ -944,6 +906,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MR,MC,Int> > A_MR_MC
     ( new DistMatrix<T,MR,MC,Int>(g) );
@@ -969,6 +933,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,STAR,VC,Int> A_STAR_VC(g);
 
@@ -988,6 +954,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(g);
 
@@ -1007,6 +975,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
@@ -1087,6 +1057,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MR,MC,Int> > A_MR_MC
     ( new DistMatrix<T,MR,MC,Int>(g) );
@@ -1112,6 +1084,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1204,6 +1178,8 @@ DistMatrix<T,STAR,VR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
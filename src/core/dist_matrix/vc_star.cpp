@@ -288,8 +288,7 @@ DistMatrix<T,VC,STAR,Int>::PrintBase
     {
         T* destCol = &sendBuf[colShift+j*height];
         const T* sourceCol = &thisBuffer[j*thisLDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal*p] = sourceCol[iLocal];
+        StridedMemCopy( destCol, p, sourceCol, 1, localHeight );
     }
 
     // If we are the root, allocate a receive buffer
@@ -712,6 +711,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -744,11 +745,25 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
         const Int maxWidth = MaxLength(width,c);
         const Int portionSize = std::max(maxHeight*maxWidth,mpi::MIN_COLL_MSG);
 
-        this->auxMemory_.Require( 2*c*portionSize );
-
-        T* buffer = this->auxMemory_.Buffer();
-        T* sendBuffer = &buffer[0];
-        T* recvBuffer = &buffer[c*portionSize];
+        // If requested, pack directly into a window which is shared with the
+        // on-node members of our process row so that they may unpack from it
+        T *sendBuffer, *recvBuffer;
+        const bool sharedWindows = g.SharedWindows();
+        if( sharedWindows )
+        {
+            mpi::SharedWindowRequire
+            ( g.MRSharedWindow(), c*portionSize*sizeof(T) );
+            this->auxMemory_.Require( c*portionSize );
+            sendBuffer = reinterpret_cast<T*>(g.MRSharedWindow().buffer);
+            recvBuffer = this->auxMemory_.Buffer();
+        }
+        else
+        {
+            this->auxMemory_.Require( 2*c*portionSize );
+            T* buffer = this->auxMemory_.Buffer();
+            sendBuffer = &buffer[0];
+            recvBuffer = &buffer[c*portionSize];
+        }
 
         // Pack
         const T* ABuffer = A.LockedBuffer();
@@ -772,15 +787,26 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
         // Communicate
-        mpi::AllToAll
-        ( sendBuffer, portionSize,
-          recvBuffer, portionSize, g.RowComm() );
+        std::vector<const T*> portions( c );
+        if( sharedWindows )
+        {
+            mpi::SharedAllToAll
+            ( portionSize, recvBuffer, portionSize, 
+              g.MRTwoLevelComm(), g.MRSharedWindow(), portions );
+        }
+        else
+        {
+            mpi::AllToAll
+            ( sendBuffer, portionSize,
+              recvBuffer, portionSize, g.RowComm() );
+            for( Int k=0; k<c; ++k )
+                portions[k] = &recvBuffer[k*portionSize];
+        }
 
         // Unpack
         T* thisBuffer = this->Buffer();
@@ -790,7 +816,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
 #endif
         for( Int k=0; k<c; ++k )
         {
-            const T* data = &recvBuffer[k*portionSize];
+            const T* data = portions[k];
 
             const Int thisRowShift = Shift_(k,rowAlignmentOfA,c);
             const Int thisLocalWidth = Length_(width,thisRowShift,c);
@@ -805,6 +831,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
                 MemCopy( thisCol, dataCol, localHeight );
             }
         }
+        if( sharedWindows )
+            mpi::SharedWindowSync( g.MRSharedWindow() );
         this->auxMemory_.Release();
     }
     else
@@ -862,8 +890,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
             {
                 T* destCol = &data[jLocal*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColOffset+jLocal*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -874,8 +901,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,MR,Int>& A )
 
         // SendRecv: properly align the [VC,*] via a trade in the column
         mpi::SendRecv
-        ( firstBuffer,  portionSize, sendRow, 0,
-          secondBuffer, portionSize, recvRow, mpi::ANY_TAG, g.ColComm() );
+        ( firstBuffer,  c*portionSize, sendRow, 0,
+          secondBuffer, c*portionSize, recvRow, mpi::ANY_TAG, g.ColComm() );
 
         // Unpack
         T* thisBuffer = this->Buffer();
@@ -916,6 +943,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -951,8 +980,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         {
             T* destCol = &thisBuffer[j*thisLDim];
             const T* sourceCol = &ABuffer[colOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeight );
         }
     }
     else
@@ -1002,8 +1030,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MC,STAR,Int>& A )
         {
             T* destCol = &sendBuffer[j*localHeightOfSend];
             const T* sourceCol = &ABuffer[sendColOffset+j*ALDim];
-            for( Int iLocal=0; iLocal<localHeightOfSend; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*c];
+            StridedMemCopy( destCol, 1, sourceCol, c, localHeightOfSend );
         }
 
         // Communicate
@@ -1039,6 +1066,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,MR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(g);
 
@@ -1092,6 +1121,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VR,STAR,Int> A_VR_STAR(g);
 
@@ -1111,6 +1142,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,MR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,VR,STAR,Int> A_VR_STAR(g);
 
@@ -1130,6 +1163,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,MC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MR,MC,Int> > A_MR_MC
     ( new DistMatrix<T,MR,MC,Int>(g) );
@@ -1155,6 +1190,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,VC,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const Grid& g = this->Grid();
     if( !this->Viewing() )
     {
@@ -1247,6 +1284,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,VC,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     std::auto_ptr<DistMatrix<T,MR,MC,Int> > A_MR_MC
     ( new DistMatrix<T,MR,MC,Int>(g) );
@@ -1272,6 +1311,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,VR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
@@ -1353,6 +1394,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,VR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const elem::Grid& g = this->Grid();
     DistMatrix<T,MC,MR,Int> A_MC_MR(g);
 
@@ -1372,6 +1415,8 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     if( this->Viewing() )
         this->AssertSameSize( A.Height(), A.Width() );
 #endif
+    if( this->CopyIfCoincident( A ) )
+        return *this;
     const Grid& g = this->Grid();
     if( !this->Viewing() )
         this->ResizeTo( A.Height(), A.Width() );
@@ -1395,8 +1440,7 @@ DistMatrix<T,VC,STAR,Int>::operator=( const DistMatrix<T,STAR,STAR,Int>& A )
     {
         T* destCol = &thisBuffer[j*thisLDim];
         const T* sourceCol = &ABuffer[colShift+j*ALDim];
-        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
-            destCol[iLocal] = sourceCol[iLocal*p];
+        StridedMemCopy( destCol, 1, sourceCol, p, localHeight );
     }
     return *this;
 }
@@ -1477,8 +1521,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterFrom
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1558,8 +1601,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterFrom
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ABuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
@@ -1647,8 +1689,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterUpdate
             {
                 T* destCol = &data[j*thisLocalHeight];
                 const T* sourceCol = &ABuffer[thisColOffset+j*ALDim];
-                for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                    destCol[iLocal] = sourceCol[iLocal*c];
+                StridedMemCopy( destCol, 1, sourceCol, c, thisLocalHeight );
             }
         }
 
@@ -1726,8 +1767,7 @@ DistMatrix<T,VC,STAR,Int>::SumScatterUpdate
         {
             T* destCol = &data[j*thisLocalHeight];
             const T* sourceCol = &ABuffer[thisColShift+j*ALDim];
-            for( Int iLocal=0; iLocal<thisLocalHeight; ++iLocal )
-                destCol[iLocal] = sourceCol[iLocal*p];
+            StridedMemCopy( destCol, 1, sourceCol, p, thisLocalHeight );
         }
     }
 
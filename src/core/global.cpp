@@ -26,6 +26,13 @@ double minRealWindowVal, maxRealWindowVal,
        minImagWindowVal, maxImagWindowVal;
 #endif
 std::stack<int> blocksizeStack;
+int tileSize = 64;
+bool sharedMemoryRedistributions = false;
+bool parallelFirstTouch = false;
+elem::HugePagePolicy hugePagePolicy = elem::NO_HUGE_PAGES;
+unsigned long randomSeed = 0;
+unsigned long randomStream = 0;
+unsigned long localRandomStream = 0;
 elem::Grid* defaultGrid = 0;
 elem::MpiArgs* args = 0;
 
@@ -213,6 +220,11 @@ void Initialize( int& argc, char**& argv )
 #else
     srand48( seed );
 #endif
+
+    // The counter-based generator must instead agree on a single seed
+    int counterSeed = seed;
+    mpi::Broadcast( &counterSeed, 1, 0, mpi::COMM_WORLD );
+    SetRandomSeed( counterSeed );
 }
 
 void Finalize()
@@ -234,6 +246,11 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+#ifdef HAVE_PMRRR
+        // Join the worker threads which PMRRR keeps between calls
+        pmrrr::FreeThreadPool();
+#endif
+
         if( ::elemInitializedMpi )
         {
             // Destroy the pivot ops needed by the distributed LU
@@ -289,6 +306,55 @@ void PushBlocksizeStack( int blocksize )
 void PopBlocksizeStack()
 { ::blocksizeStack.pop(); }
 
+int TileSize()
+{ return ::tileSize; }
+
+void SetTileSize( int tileSize )
+{ ::tileSize = tileSize; }
+
+bool SharedMemoryRedistributions()
+{ return ::sharedMemoryRedistributions; }
+
+void SetSharedMemoryRedistributions( bool enable )
+{ ::sharedMemoryRedistributions = enable; }
+
+bool ParallelFirstTouch()
+{ return ::parallelFirstTouch; }
+
+void SetParallelFirstTouch( bool enable )
+{ ::parallelFirstTouch = enable; }
+
+HugePagePolicy GetHugePagePolicy()
+{ return ::hugePagePolicy; }
+
+void SetHugePagePolicy( HugePagePolicy policy )
+{ ::hugePagePolicy = policy; }
+
+void SetRandomSeed( unsigned long seed )
+{ 
+    ::randomSeed = seed; 
+    ::randomStream = 0;
+    ::localRandomStream = 0;
+}
+
+unsigned long RandomSeed()
+{ return ::randomSeed; }
+
+RandomStream NextRandomStream()
+{ return RandomStream( ::randomSeed, ::randomStream++ ); }
+
+// Local streams count down from the top of the range so that they do not 
+// coincide with the distributed streams, and the rank within 
+// mpi::COMM_WORLD occupies the upper half of the (complemented) index so that
+// the local streams of different processes are disjoint
+RandomStream NextLocalRandomStream()
+{ 
+    const unsigned long rank = mpi::WorldRank();
+    const unsigned long halfBits = 4*sizeof(unsigned long);
+    const unsigned long index = (rank << halfBits) | ::localRandomStream++;
+    return RandomStream( ::randomSeed, ~index ); 
+}
+
 const Grid& DefaultGrid()
 {
 #ifndef RELEASE
@@ -174,6 +174,22 @@ void CommSplit( Comm comm, int color, int key, Comm& newComm )
     SafeMpi( MPI_Comm_split( comm, color, key, &newComm ) );
 }
 
+void CommSplitShared( Comm comm, int key, Comm& nodeComm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::CommSplitShared");
+#endif
+#ifdef HAVE_MPI_COMM_SPLIT_TYPE
+    SafeMpi( 
+        MPI_Comm_split_type
+        ( comm, MPI_COMM_TYPE_SHARED, key, MPI_INFO_NULL, &nodeComm ) 
+    );
+#else
+    // Fall back to treating each process as its own node
+    SafeMpi( MPI_Comm_split( comm, CommRank(comm), key, &nodeComm ) );
+#endif
+}
+
 void CommFree( Comm& comm )
 {
 #ifndef RELEASE
@@ -204,6 +220,171 @@ void ErrorHandlerSet( Comm comm, ErrorHandler errorHandler )
 #endif
 }
 
+//----------------------------------------------//
+// Two-level (node-aware) communicator routines //
+//----------------------------------------------//
+
+void TwoLevelCommCreate( Comm comm, TwoLevelComm& twoLevelComm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::TwoLevelCommCreate");
+#endif
+    const int commRank = CommRank( comm );
+    const int commSize = CommSize( comm );
+    twoLevelComm.comm = comm;
+
+    // Split into nodes (ordered by our rank in 'comm') and then form a 
+    // communicator from the first process in each node
+    CommSplitShared( comm, commRank, twoLevelComm.nodeComm );
+    twoLevelComm.nodeRank = CommRank( twoLevelComm.nodeComm );
+    twoLevelComm.nodeSize = CommSize( twoLevelComm.nodeComm );
+    const bool leader = ( twoLevelComm.nodeRank == 0 );
+    CommSplit
+    ( comm, ( leader ? 0 : UNDEFINED ), commRank, twoLevelComm.leaderComm );
+
+    // Number each node by the rank of its leader, and tell the other members
+    twoLevelComm.node = ( leader ? CommRank(twoLevelComm.leaderComm) : 0 );
+    Broadcast( &twoLevelComm.node, 1, 0, twoLevelComm.nodeComm );
+
+    // Gather the (node,nodeRank) pairs of every process
+    int myPair[2] = { twoLevelComm.node, twoLevelComm.nodeRank };
+    std::vector<int> pairs( 2*commSize );
+    AllGather( myPair, 2, &pairs[0], 2, comm );
+
+    // Count the members of each node and compute the node-major positions
+    twoLevelComm.numNodes = 0;
+    for( int q=0; q<commSize; ++q )
+        twoLevelComm.numNodes = std::max( twoLevelComm.numNodes, pairs[2*q]+1 );
+    twoLevelComm.nodeSizes.resize( twoLevelComm.numNodes );
+    twoLevelComm.nodeOffsets.resize( twoLevelComm.numNodes );
+    for( int k=0; k<twoLevelComm.numNodes; ++k )
+        twoLevelComm.nodeSizes[k] = 0;
+    for( int q=0; q<commSize; ++q )
+        ++twoLevelComm.nodeSizes[pairs[2*q]];
+    int offset = 0;
+    for( int k=0; k<twoLevelComm.numNodes; ++k )
+    {
+        twoLevelComm.nodeOffsets[k] = offset;
+        offset += twoLevelComm.nodeSizes[k];
+    }
+    twoLevelComm.positions.resize( commSize );
+    twoLevelComm.ranks.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        const int position = twoLevelComm.nodeOffsets[pairs[2*q]]+pairs[2*q+1];
+        twoLevelComm.positions[q] = position;
+        twoLevelComm.ranks[position] = q;
+    }
+}
+
+void TwoLevelCommFree( TwoLevelComm& twoLevelComm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::TwoLevelCommFree");
+#endif
+    CommFree( twoLevelComm.nodeComm );
+    if( twoLevelComm.leaderComm != COMM_NULL )
+        CommFree( twoLevelComm.leaderComm );
+    twoLevelComm.comm = COMM_NULL;
+    twoLevelComm.positions.clear();
+    twoLevelComm.ranks.clear();
+    twoLevelComm.nodeSizes.clear();
+    twoLevelComm.nodeOffsets.clear();
+}
+
+//-------------------------------//
+// Shared-memory window routines //
+//-------------------------------//
+
+void SharedWindowCreate( Comm nodeComm, SharedWindow& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::SharedWindowCreate");
+#endif
+    window.comm = nodeComm;
+    window.size = 0;
+    window.buffer = 0;
+    window.segments.clear();
+}
+
+// NOTE: This routine is collective over the node communicator, and the 
+//       window is only reallocated if some member requires more memory
+void SharedWindowRequire( SharedWindow& window, std::size_t size )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::SharedWindowRequire");
+#endif
+    // Round up to a multiple of the cache line size so that each segment is 
+    // suitably aligned for any datatype and no two members share a line
+    const std::size_t lineSize = 64;
+    int numLines = (size+lineSize-1) / lineSize;
+    AllReduce( &numLines, 1, MAX, window.comm );
+    const std::size_t maxSize = numLines*lineSize;
+    if( maxSize <= window.size )
+        return;
+
+    SharedWindowFree( window );
+    const int nodeSize = CommSize( window.comm );
+    window.size = maxSize;
+    window.segments.resize( nodeSize );
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    SafeMpi( 
+        MPI_Win_allocate_shared
+        ( window.size, 1, MPI_INFO_NULL, window.comm, &window.buffer, 
+          &window.win ) 
+    );
+    for( int q=0; q<nodeSize; ++q )
+    {
+        MPI_Aint segmentSize;
+        int dispUnit;
+        SafeMpi( 
+            MPI_Win_shared_query
+            ( window.win, q, &segmentSize, &dispUnit, &window.segments[q] ) 
+        );
+    }
+    // Hold a passive-target epoch open for the lifetime of the window so that
+    // SharedWindowSync may use MPI_Win_sync
+    SafeMpi( MPI_Win_lock_all( MPI_MODE_NOCHECK, window.win ) );
+#else
+    window.buffer = new byte[window.size];
+    for( int q=0; q<nodeSize; ++q )
+        window.segments[q] = 0;
+    window.segments[CommRank(window.comm)] = window.buffer;
+#endif
+}
+
+void SharedWindowSync( SharedWindow& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::SharedWindowSync");
+#endif
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    if( window.size != 0 )
+        SafeMpi( MPI_Win_sync( window.win ) );
+    Barrier( window.comm );
+    if( window.size != 0 )
+        SafeMpi( MPI_Win_sync( window.win ) );
+#endif
+}
+
+void SharedWindowFree( SharedWindow& window )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::SharedWindowFree");
+#endif
+    if( window.size == 0 )
+        return;
+#ifdef HAVE_MPI_WIN_ALLOCATE_SHARED
+    SafeMpi( MPI_Win_unlock_all( window.win ) );
+    SafeMpi( MPI_Win_free( &window.win ) );
+#else
+    delete[] window.buffer;
+#endif
+    window.size = 0;
+    window.buffer = 0;
+    window.segments.clear();
+}
+
 //---------------------------------//
 // Cartesian communicator routines //
 //---------------------------------//
@@ -2001,5 +2182,285 @@ template void ReduceScatter( const double* sbuf, double* rbuf, const int* rcs, O
 template void ReduceScatter( const Complex<float>* sbuf, Complex<float>* rbuf, const int* rcs, Op op, Comm comm );
 template void ReduceScatter( const Complex<double>* sbuf, Complex<double>* rbuf, const int* rcs, Op op, Comm comm );
 
+//------------------------//
+// Two-level collectives  //
+//------------------------//
+
+// NOTE: Buffers which are only needed by the node leaders are left empty on
+//       the remaining processes, and MPI ignores the corresponding pointers.
+template<typename T>
+inline T* 
+BufferOrNull( std::vector<T>& buffer )
+{ return ( buffer.size() ? &buffer[0] : 0 ); }
+
+template<typename T>
+void AllGather
+( const T* sbuf, int sc, 
+        T* rbuf, int rc, const TwoLevelComm& comm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::AllGather");
+    if( sc != rc )
+        throw std::logic_error("Two-level AllGather requires sc == rc");
+#endif
+    const int commSize = comm.positions.size();
+    const bool leader = ( comm.nodeRank == 0 );
+
+    // Gather the contributions from our node onto its leader
+    std::vector<T> nodeBuf( leader ? comm.nodeSize*rc : 0 );
+    Gather( sbuf, sc, BufferOrNull(nodeBuf), rc, 0, comm.nodeComm );
+
+    // Exchange the node contributions between the leaders
+    std::vector<T> orderedBuf( commSize*rc );
+    if( leader )
+    {
+        std::vector<int> rcs( comm.numNodes ), rds( comm.numNodes );
+        for( int k=0; k<comm.numNodes; ++k )
+        {
+            rcs[k] = comm.nodeSizes[k]*rc;
+            rds[k] = comm.nodeOffsets[k]*rc;
+        }
+        AllGather
+        ( BufferOrNull(nodeBuf), comm.nodeSize*rc, 
+          BufferOrNull(orderedBuf), &rcs[0], &rds[0], comm.leaderComm );
+    }
+
+    // Share the result within each node
+    Broadcast( BufferOrNull(orderedBuf), commSize*rc, 0, comm.nodeComm );
+
+    // Return to the rank ordering of the original communicator
+    for( int q=0; q<commSize; ++q )
+        MemCopy( &rbuf[comm.ranks[q]*rc], &orderedBuf[q*rc], rc );
+}
+
+template void AllGather
+( const byte* sbuf, int sc, byte* rbuf, int rc, const TwoLevelComm& comm );
+template void AllGather
+( const int* sbuf, int sc, int* rbuf, int rc, const TwoLevelComm& comm );
+template void AllGather
+( const float* sbuf, int sc, float* rbuf, int rc, const TwoLevelComm& comm );
+template void AllGather
+( const double* sbuf, int sc, double* rbuf, int rc, const TwoLevelComm& comm );
+template void AllGather
+( const Complex<float>* sbuf, int sc, 
+        Complex<float>* rbuf, int rc, const TwoLevelComm& comm );
+template void AllGather
+( const Complex<double>* sbuf, int sc, 
+        Complex<double>* rbuf, int rc, const TwoLevelComm& comm );
+
+template<typename T>
+void ReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, const TwoLevelComm& comm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::ReduceScatter");
+#endif
+    const int commSize = comm.positions.size();
+    const bool leader = ( comm.nodeRank == 0 );
+
+    // Permute the contributions into node-major order and sum within the node
+    std::vector<T> orderedBuf( commSize*rc );
+    for( int q=0; q<commSize; ++q )
+        MemCopy( &orderedBuf[q*rc], &sbuf[comm.ranks[q]*rc], rc );
+    Reduce( BufferOrNull(orderedBuf), commSize*rc, op, 0, comm.nodeComm );
+
+    // Have the leaders reduce-scatter the contiguous node-major blocks
+    std::vector<T> nodeBuf( leader ? comm.nodeSize*rc : 0 );
+    if( leader )
+    {
+        std::vector<int> rcs( comm.numNodes );
+        for( int k=0; k<comm.numNodes; ++k )
+            rcs[k] = comm.nodeSizes[k]*rc;
+        ReduceScatter
+        ( BufferOrNull(orderedBuf), BufferOrNull(nodeBuf), &rcs[0], op, 
+          comm.leaderComm );
+    }
+
+    // Hand each member of the node its block
+    Scatter( BufferOrNull(nodeBuf), rc, rbuf, rc, 0, comm.nodeComm );
+}
+
+template void ReduceScatter
+( const byte* sbuf, byte* rbuf, int rc, Op op, const TwoLevelComm& comm );
+template void ReduceScatter
+( const int* sbuf, int* rbuf, int rc, Op op, const TwoLevelComm& comm );
+template void ReduceScatter
+( const float* sbuf, float* rbuf, int rc, Op op, const TwoLevelComm& comm );
+template void ReduceScatter
+( const double* sbuf, double* rbuf, int rc, Op op, const TwoLevelComm& comm );
+template void ReduceScatter
+( const Complex<float>* sbuf, Complex<float>* rbuf, int rc, Op op, 
+  const TwoLevelComm& comm );
+template void ReduceScatter
+( const Complex<double>* sbuf, Complex<double>* rbuf, int rc, Op op, 
+  const TwoLevelComm& comm );
+
+template<typename T>
+void AllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, const TwoLevelComm& comm )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::AllToAll");
+    if( sc != rc )
+        throw std::logic_error("Two-level AllToAll requires sc == rc");
+#endif
+    const int commSize = comm.positions.size();
+    const int nodeSize = comm.nodeSize;
+    const bool leader = ( comm.nodeRank == 0 );
+
+    // Permute our blocks into node-major destination order and gather them
+    // onto our leader
+    std::vector<T> orderedBuf( commSize*sc );
+    for( int q=0; q<commSize; ++q )
+        MemCopy( &orderedBuf[q*sc], &sbuf[comm.ranks[q]*sc], sc );
+    std::vector<T> gatherBuf( leader ? nodeSize*commSize*sc : 0 );
+    Gather
+    ( &orderedBuf[0], commSize*sc, 
+      BufferOrNull(gatherBuf), commSize*sc, 0, comm.nodeComm );
+
+    std::vector<T> scatterBuf( leader ? nodeSize*commSize*rc : 0 );
+    if( leader )
+    {
+        // Pack the blocks destined for each node contiguously
+        std::vector<int> scs( comm.numNodes ), sds( comm.numNodes ),
+                         rcs( comm.numNodes ), rds( comm.numNodes );
+        for( int k=0; k<comm.numNodes; ++k )
+        {
+            scs[k] = nodeSize*comm.nodeSizes[k]*sc;
+            sds[k] = nodeSize*comm.nodeOffsets[k]*sc;
+            rcs[k] = comm.nodeSizes[k]*nodeSize*rc;
+            rds[k] = comm.nodeOffsets[k]*nodeSize*rc;
+        }
+        std::vector<T> sendBuf( nodeSize*commSize*sc );
+        for( int k=0; k<comm.numNodes; ++k )
+        {
+            int offset = sds[k];
+            for( int s=0; s<nodeSize; ++s )
+            {
+                for( int t=0; t<comm.nodeSizes[k]; ++t )
+                {
+                    const int q = comm.nodeOffsets[k] + t;
+                    MemCopy
+                    ( &sendBuf[offset], &gatherBuf[(s*commSize+q)*sc], sc );
+                    offset += sc;
+                }
+            }
+        }
+
+        // Exchange between the leaders
+        std::vector<T> recvBuf( commSize*nodeSize*rc );
+        AllToAll
+        ( &sendBuf[0], &scs[0], &sds[0], 
+          &recvBuf[0], &rcs[0], &rds[0], comm.leaderComm );
+
+        // Unpack into the rank ordering expected by each member of our node
+        for( int k=0; k<comm.numNodes; ++k )
+        {
+            for( int s=0; s<comm.nodeSizes[k]; ++s )
+            {
+                const int source = comm.ranks[comm.nodeOffsets[k]+s];
+                for( int d=0; d<nodeSize; ++d )
+                    MemCopy
+                    ( &scatterBuf[(d*commSize+source)*rc], 
+                      &recvBuf[rds[k]+(s*nodeSize+d)*rc], rc );
+            }
+        }
+    }
+
+    // Hand each member of the node its blocks
+    Scatter
+    ( BufferOrNull(scatterBuf), commSize*rc, rbuf, commSize*rc, 0, 
+      comm.nodeComm );
+}
+
+template void AllToAll
+( const byte* sbuf, int sc, byte* rbuf, int rc, const TwoLevelComm& comm );
+template void AllToAll
+( const int* sbuf, int sc, int* rbuf, int rc, const TwoLevelComm& comm );
+template void AllToAll
+( const float* sbuf, int sc, float* rbuf, int rc, const TwoLevelComm& comm );
+template void AllToAll
+( const double* sbuf, int sc, double* rbuf, int rc, const TwoLevelComm& comm );
+template void AllToAll
+( const Complex<float>* sbuf, int sc, 
+        Complex<float>* rbuf, int rc, const TwoLevelComm& comm );
+template void AllToAll
+( const Complex<double>* sbuf, int sc, 
+        Complex<double>* rbuf, int rc, const TwoLevelComm& comm );
+
+template<typename T>
+void SharedAllToAll
+( int sc, T* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const T*>& portions )
+{
+#ifndef RELEASE
+    CallStackEntry entry("mpi::SharedAllToAll");
+    if( sc != rc )
+        throw std::logic_error("SharedAllToAll requires sc == rc");
+    if( window.size < comm.positions.size()*sc*sizeof(T) )
+        throw std::logic_error("Shared window is too small");
+#endif
+    const int commSize = comm.positions.size();
+    const int commRank = CommRank( comm.comm );
+    const int nodeOffset = comm.nodeOffsets[comm.node];
+    const T* sbuf = reinterpret_cast<const T*>(window.buffer);
+
+    // Make sure that the members of our node have finished packing
+    SharedWindowSync( window );
+
+    // Read the portions from our node in place and only communicate the rest
+    portions.resize( commSize );
+    std::vector<int> scs( commSize ), sds( commSize ), 
+                     rcs( commSize ), rds( commSize );
+    bool offNode = false;
+    for( int q=0; q<commSize; ++q )
+    {
+        const int nodeRank = comm.positions[q] - nodeOffset;
+        const bool onNode = ( nodeRank >= 0 && nodeRank < comm.nodeSize && 
+                              window.segments[nodeRank] != 0 );
+        if( onNode )
+        {
+            const T* segment = 
+                reinterpret_cast<const T*>(window.segments[nodeRank]);
+            portions[q] = &segment[commRank*sc];
+            scs[q] = rcs[q] = 0;
+        }
+        else
+        {
+            portions[q] = &rbuf[q*rc];
+            scs[q] = sc;
+            rcs[q] = rc;
+            offNode = true;
+        }
+        sds[q] = q*sc;
+        rds[q] = q*rc;
+    }
+    // NOTE: Either every member of comm.comm has an off-node peer or none do,
+    //       so skipping the exchange is safe
+    if( offNode )
+        AllToAll
+        ( sbuf, &scs[0], &sds[0], rbuf, &rcs[0], &rds[0], comm.comm );
+}
+
+template void SharedAllToAll
+( int sc, byte* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const byte*>& portions );
+template void SharedAllToAll
+( int sc, int* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const int*>& portions );
+template void SharedAllToAll
+( int sc, float* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const float*>& portions );
+template void SharedAllToAll
+( int sc, double* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const double*>& portions );
+template void SharedAllToAll
+( int sc, Complex<float>* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const Complex<float>*>& portions );
+template void SharedAllToAll
+( int sc, Complex<double>* rbuf, int rc, const TwoLevelComm& comm, 
+  SharedWindow& window, std::vector<const Complex<double>*>& portions );
+
 } // namespace mpi
 } // namespace elem
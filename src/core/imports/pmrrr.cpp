@@ -32,11 +32,51 @@ int PMRRR
   int* ZSupp      // support of eigenvectors [length 2n]
 );
 
+void PMR_set_num_threads( int nthreads );
+void PMR_free_thread_pool();
+
 } // extern "C"
 
 namespace elem {
 namespace pmrrr {
 
+namespace {
+int numThreads = 0;
+
+// Tell PMRRR how many threads to use for the upcoming call. Unless the 
+// count was explicitly requested, we fall back to PMR_NUM_THREADS and then 
+// to the OpenMP thread count, so that the PMRRR threads occupy the same 
+// cores as the OpenMP threads rather than oversubscribing them.
+void PushNumThreads()
+{
+    PMR_set_num_threads( NumThreads() );
+}
+}
+
+void SetNumThreads( int numThreads_ )
+{ numThreads = numThreads_; }
+
+int NumThreads()
+{
+    if( numThreads > 0 )
+        return numThreads;
+    const char* envThreads = std::getenv("PMR_NUM_THREADS");
+    if( envThreads != 0 )
+        return std::max( std::atoi(envThreads), 1 );
+#ifdef HAVE_OPENMP
+    // Calls from within a parallel region would compete with the other
+    // threads of the region
+    if( omp_in_parallel() )
+        return 1;
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void FreeThreadPool()
+{ PMR_free_thread_pool(); }
+
 // Return upper bounds on the number of (local) eigenvalues in the given range,
 // (lowerBound,upperBound]
 Estimate EigEstimate
@@ -53,6 +93,7 @@ Estimate EigEstimate
     int nz, offset;
     int ldz=1;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
       &highAccuracy, comm, &nz, &offset, w, 0, &ldz, &ZSupport[0] );
@@ -83,6 +124,7 @@ Info Eig( int n, double* d, double* e, double* w, mpi::Comm comm )
     int nz, offset;
     int ldz=1;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &vl, &vu, &il, &iu, &highAccuracy, comm,
       &nz, &offset, w, 0, &ldz, &ZSupport[0] );
@@ -114,6 +156,7 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &vl, &vu, &il, &iu, &highAccuracy, comm,
       &nz, &offset, w, Z, &ldz, &ZSupport[0] );
@@ -146,6 +189,7 @@ Info Eig
     int nz, offset;
     int ldz=1;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
       &highAccuracy, comm, &nz, &offset, w, 0, &ldz, &ZSupport[0] );
@@ -177,6 +221,7 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &lowerBound, &upperBound, &il, &iu, 
       &highAccuracy, comm, &nz, &offset, w, Z, &ldz, &ZSupport[0] );
@@ -211,6 +256,7 @@ Info Eig
     int nz, offset;
     int ldz=1;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &vl, &vu, &lowerBound, &upperBound, 
       &highAccuracy, comm, &nz, &offset, w, 0, &ldz, &ZSupport[0] );
@@ -245,6 +291,7 @@ Info Eig
     int highAccuracy=0; 
     int nz, offset;
     std::vector<int> ZSupport(2*n);
+    PushNumThreads();
     int retval = PMRRR
     ( &jobz, &range, &n, d, e, &vl, &vu, &lowerBound, &upperBound, 
       &highAccuracy, comm, &nz, &offset, w, Z, &ldz, &ZSupport[0] );
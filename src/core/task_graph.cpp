@@ -0,0 +1,300 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "elemental-lite.hpp"
+#include <queue>
+
+namespace elem {
+
+TaskGraph::TaskGraph()
+{ }
+
+TaskGraph::~TaskGraph()
+{ Clear(); }
+
+void
+TaskGraph::Add( Task* task, int priority )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TaskGraph::Add");
+    if( task == 0 )
+        throw std::logic_error("Cannot add a null task");
+#endif
+    tasks_.push_back( task );
+    priorities_.push_back( priority );
+    numDependencies_.push_back( 0 );
+    successors_.push_back( std::vector<int>() );
+}
+
+void
+TaskGraph::Reads( int handle )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TaskGraph::Reads");
+    if( tasks_.empty() )
+        throw std::logic_error("No task has been added yet");
+#endif
+    const int task = tasks_.size()-1;
+    std::map<int,int>::const_iterator it = lastWriter_.find( handle );
+    if( it != lastWriter_.end() )
+        AddDependency( it->second, task );
+    readers_[handle].push_back( task );
+}
+
+void
+TaskGraph::Writes( int handle )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TaskGraph::Writes");
+    if( tasks_.empty() )
+        throw std::logic_error("No task has been added yet");
+#endif
+    const int task = tasks_.size()-1;
+    std::map<int,int>::iterator it = lastWriter_.find( handle );
+    if( it != lastWriter_.end() )
+    {
+        AddDependency( it->second, task );
+        it->second = task;
+    }
+    else
+        lastWriter_[handle] = task;
+
+    std::vector<int>& readers = readers_[handle];
+    for( std::size_t k=0; k<readers.size(); ++k )
+        AddDependency( readers[k], task );
+    readers.clear();
+}
+
+int
+TaskGraph::NumTasks() const
+{ return tasks_.size(); }
+
+int
+TaskGraph::NumThreads()
+{
+#ifdef HAVE_OPENMP
+    if( omp_in_parallel() )
+        return 1;
+    else
+        return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
+void
+TaskGraph::AddDependency( int before, int after )
+{
+    // Since all of the dependencies of a task are added before any other
+    // task is added, a repeated dependency is always the last one
+    std::vector<int>& successors = successors_[before];
+    if( before != after &&
+        (successors.empty() || successors.back() != after) )
+    {
+        successors.push_back( after );
+        ++numDependencies_[after];
+    }
+}
+
+void
+TaskGraph::Clear()
+{
+    for( std::size_t k=0; k<tasks_.size(); ++k )
+        delete tasks_[k];
+    tasks_.clear();
+    priorities_.clear();
+    numDependencies_.clear();
+    successors_.clear();
+    lastWriter_.clear();
+    readers_.clear();
+}
+
+namespace {
+
+enum TaskError
+{ NO_ERROR, NON_HPD_ERROR, SINGULAR_ERROR, LOGIC_ERROR, OTHER_ERROR };
+
+void
+RunTask( Task* task, TaskError& error, std::string& message )
+{
+    try { task->Run(); }
+    catch( NonHPDMatrixException& e )
+    { error = NON_HPD_ERROR; message = e.what(); }
+    catch( SingularMatrixException& e )
+    { error = SINGULAR_ERROR; message = e.what(); }
+    catch( std::logic_error& e )
+    { error = LOGIC_ERROR; message = e.what(); }
+    catch( std::exception& e )
+    { error = OTHER_ERROR; message = e.what(); }
+}
+
+} // anonymous namespace
+
+#ifdef HAVE_OPENMP
+// The state shared by the explicit OpenMP tasks launched by Execute(). Ready
+// tasks are ordered by priority and then by the order in which they were added.
+struct TaskGraph::ExecutionState
+{
+    std::priority_queue<std::pair<int,int> > ready;
+    std::vector<int> numRemaining;
+    TaskError error;
+    std::string message;
+    omp_lock_t lock;
+};
+
+// Exactly one explicit OpenMP task is launched per entry pushed onto the ready
+// queue, and each runs whichever ready task has the highest priority when it
+// starts (which need not be the one that it was launched for). Once a task
+// throws, the remaining launches simply drain the queue.
+void
+TaskGraph::RunNextReadyTask( ExecutionState* state )
+{
+    omp_set_lock( &state->lock );
+    const int task = -state->ready.top().second;
+    state->ready.pop();
+    const bool run = ( state->error == NO_ERROR );
+    omp_unset_lock( &state->lock );
+    if( !run )
+        return;
+
+    TaskError error = NO_ERROR;
+    std::string message;
+    RunTask( tasks_[task], error, message );
+
+    int numReady = 0;
+    omp_set_lock( &state->lock );
+    if( error != NO_ERROR )
+    {
+        if( state->error == NO_ERROR )
+        {
+            state->error = error;
+            state->message = message;
+        }
+    }
+    else
+    {
+        const std::vector<int>& successors = successors_[task];
+        for( std::size_t k=0; k<successors.size(); ++k )
+        {
+            const int next = successors[k];
+            if( --state->numRemaining[next] == 0 )
+            {
+                state->ready.push
+                ( std::pair<int,int>(priorities_[next],-next) );
+                ++numReady;
+            }
+        }
+    }
+    omp_unset_lock( &state->lock );
+
+    for( int k=0; k<numReady; ++k )
+    {
+        #pragma omp task firstprivate(state)
+        RunNextReadyTask( state );
+    }
+}
+#endif // ifdef HAVE_OPENMP
+
+void
+TaskGraph::Execute()
+{
+#ifndef RELEASE
+    CallStackEntry entry("TaskGraph::Execute");
+#endif
+    const int numTasks = tasks_.size();
+    TaskError error = NO_ERROR;
+    std::string message;
+#ifdef HAVE_OPENMP
+    if( NumThreads() > 1 && numTasks > 1 )
+    {
+        ExecutionState state;
+        state.numRemaining = numDependencies_;
+        state.error = NO_ERROR;
+        int numReady = 0;
+        for( int k=0; k<numTasks; ++k )
+        {
+            if( state.numRemaining[k] == 0 )
+            {
+                state.ready.push( std::pair<int,int>(priorities_[k],-k) );
+                ++numReady;
+            }
+        }
+        omp_init_lock( &state.lock );
+
+        // The threads which are not launching tasks wait at the barrier which
+        // closes the single construct, where the runtime hands them the
+        // explicit tasks as they are launched, and all of the tasks are
+        // complete once that barrier is passed
+        ExecutionState* statePtr = &state;
+        #pragma omp parallel
+        {
+            #pragma omp single
+            {
+                for( int k=0; k<numReady; ++k )
+                {
+                    #pragma omp task firstprivate(statePtr)
+                    RunNextReadyTask( statePtr );
+                }
+            }
+        }
+        omp_destroy_lock( &state.lock );
+        error = state.error;
+        message = state.message;
+    }
+    else
+#endif
+    {
+        for( int k=0; k<numTasks && error==NO_ERROR; ++k )
+            RunTask( tasks_[k], error, message );
+    }
+    Clear();
+
+    if( error == NON_HPD_ERROR )
+        throw NonHPDMatrixException( message.c_str() );
+    else if( error == SINGULAR_ERROR )
+        throw SingularMatrixException( message.c_str() );
+    else if( error == LOGIC_ERROR )
+        throw std::logic_error( message );
+    else if( error == OTHER_ERROR )
+        throw std::runtime_error( message );
+}
+
+void
+TileOffsets( int n, int tileSize, std::vector<int>& offsets, int split )
+{
+#ifndef RELEASE
+    CallStackEntry entry("TileOffsets");
+    if( tileSize <= 0 )
+        throw std::logic_error("Tile size must be positive");
+#endif
+    offsets.resize( 0 );
+    offsets.push_back( 0 );
+    if( split <= 0 || split >= n )
+        split = n;
+    for( int offset=tileSize; offset<split; offset+=tileSize )
+        offsets.push_back( offset );
+    if( split > 0 )
+        offsets.push_back( split );
+    for( int offset=split+tileSize; offset<n; offset+=tileSize )
+        offsets.push_back( offset );
+    if( split < n )
+        offsets.push_back( n );
+}
+
+bool
+UseTaskGraph( int n )
+{
+    const int numThreads = TaskGraph::NumThreads();
+    if( numThreads <= 1 )
+        return false;
+    const int tileSize = TileSize();
+    const int numTiles = (n+tileSize-1) / tileSize;
+    return numTiles >= 2*numThreads;
+}
+
+} // namespace elem
@@ -68,6 +68,161 @@ Check( DistMatrix<T,AColDist,ARowDist>& A,
         throw std::logic_error("Redistribution failed");
 }
 
+// Check that A becomes a zero-copy view of B exactly when the two
+// distributions coincide, and that the view represents the same matrix as an
+// ordinary copy of B
+template<typename T, Distribution AColDist, Distribution ARowDist,
+                     Distribution BColDist, Distribution BRowDist>
+void
+CheckAlias
+( DistMatrix<T,AColDist,ARowDist>& A, 
+  const DistMatrix<T,BColDist,BRowDist>& B, bool shouldCoincide )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CheckAlias");
+#endif
+    const Grid& g = B.Grid();
+
+    const int commRank = g.Rank();
+    const int height = B.Height();
+    const int width = B.Width();
+
+    if( commRank == 0 )
+    {
+        std::cout << "Testing [" << DistToString(AColDist) << ","
+                                 << DistToString(ARowDist) << "]"
+                  << " alias of [" << DistToString(BColDist) << ","
+                                   << DistToString(BRowDist) << "] on a "
+                  << g.Height() << " x " << g.Width() << " grid...";
+        std::cout.flush();
+    }
+
+    int myErrorFlag = 0;
+    if( LockedAliasView( A, B ) != shouldCoincide )
+        myErrorFlag = 1;
+    else if( shouldCoincide )
+    {
+        if( A.Height() != height || A.Width() != width ||
+            A.LocalHeight() != B.LocalHeight() || 
+            A.LocalWidth() != B.LocalWidth() ||
+            A.LDim() != B.LDim() )
+            myErrorFlag = 1;
+        else if( B.Participating() && A.LockedBuffer() != B.LockedBuffer() )
+            myErrorFlag = 1;
+
+        DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+        DistMatrix<T,STAR,STAR> B_STAR_STAR(g);
+        A_STAR_STAR = A;
+        B_STAR_STAR = B;
+        for( int j=0; j<width; ++j )
+            for( int i=0; i<height; ++i )
+                if( A_STAR_STAR.GetLocal(i,j) != B_STAR_STAR.GetLocal(i,j) )
+                    myErrorFlag = 1;
+        A.Empty();
+    }
+    else if( A.Viewing() )
+        myErrorFlag = 1;
+
+    int summedErrorFlag;
+    mpi::AllReduce( &myErrorFlag, &summedErrorFlag, 1, mpi::SUM, g.Comm() );
+
+    if( summedErrorFlag == 0 )
+    {
+        if( commRank == 0 )
+            std::cout << "PASSED" << std::endl;
+    }
+    else
+        throw std::logic_error("Aliasing check failed");
+}
+
+// Redistribute B into A, whose alignments were constrained to differ from 
+// those of B (unless there is only one process), and ensure that the 
+// constraints were respected
+template<typename T, Distribution AColDist, Distribution ARowDist,
+                     Distribution BColDist, Distribution BRowDist>
+void
+CheckMisaligned
+( DistMatrix<T,AColDist,ARowDist>& A, 
+  DistMatrix<T,BColDist,BRowDist>& B )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CheckMisaligned");
+#endif
+    const int colAlignment = A.ColAlignment();
+    const int rowAlignment = A.RowAlignment();
+    if( DistributionsCoincide( A.DistData(), B.DistData() ) != 
+        (B.Grid().Size() == 1) )
+        throw std::logic_error("Misaligned distributions coincided");
+    Check( A, B );
+    if( A.ColAlignment() != colAlignment || A.RowAlignment() != rowAlignment )
+        throw std::logic_error("Constrained alignment was overwritten");
+}
+
+template<typename T>
+void
+CoincidenceTest( int m, int n, const Grid& g )
+{
+#ifndef RELEASE
+    CallStackEntry entry("CoincidenceTest");
+#endif
+    const int r = g.Height();
+    const int c = g.Width();
+    const int p = g.Size();
+
+    DistMatrix<T,MC,  MR  > A_MC_MR(g);
+    DistMatrix<T,MC,  STAR> A_MC_STAR(g);
+    DistMatrix<T,STAR,MR  > A_STAR_MR(g);
+    DistMatrix<T,MR,  MC  > A_MR_MC(g);
+    DistMatrix<T,VC,  STAR> A_VC_STAR(g);
+    DistMatrix<T,STAR,VR  > A_STAR_VR(g);
+    DistMatrix<T,STAR,STAR> A_STAR_STAR(g);
+
+    // Use nonzero alignments where the grid allows them so that the views
+    // must inherit them
+    DistMatrix<T,MC,MR> B_MC_MR(g);
+    B_MC_MR.Align( 1 % r, 1 % c );
+    Uniform( B_MC_MR, m, n );
+    CheckAlias( A_MC_MR,     B_MC_MR, true   );
+    CheckAlias( A_VC_STAR,   B_MC_MR, c == 1 );
+    CheckAlias( A_STAR_VR,   B_MC_MR, r == 1 );
+    CheckAlias( A_MC_STAR,   B_MC_MR, c == 1 );
+    CheckAlias( A_STAR_MR,   B_MC_MR, r == 1 );
+    CheckAlias( A_MR_MC,     B_MC_MR, p == 1 );
+    CheckAlias( A_STAR_STAR, B_MC_MR, p == 1 );
+
+    DistMatrix<T,MC,STAR> B_MC_STAR(g);
+    B_MC_STAR.AlignCols( 1 % r );
+    Uniform( B_MC_STAR, m, n );
+    CheckAlias( A_VC_STAR,   B_MC_STAR, c == 1 );
+    CheckAlias( A_MC_MR,     B_MC_STAR, c == 1 );
+    CheckAlias( A_STAR_STAR, B_MC_STAR, r == 1 );
+
+    DistMatrix<T,VC,STAR> B_VC_STAR(g);
+    B_VC_STAR.AlignCols( 1 % p );
+    Uniform( B_VC_STAR, m, n );
+    CheckAlias( A_MC_MR,   B_VC_STAR, c == 1 );
+    CheckAlias( A_MC_STAR, B_VC_STAR, c == 1 );
+    CheckAlias( A_STAR_VR, B_VC_STAR, p == 1 );
+
+    // Constrained alignments which differ from those of the source must
+    // disable the shortcut so that the ordinary redistribution is used
+    DistMatrix<T,MR,MC> B_MR_MC(g);
+    B_MR_MC.Align( 1 % c, 1 % r );
+    Uniform( B_MR_MC, m, n );
+    DistMatrix<T,VC,  STAR> C_VC_STAR(g);
+    DistMatrix<T,STAR,VC  > C_STAR_VC(g);
+    DistMatrix<T,VR,  STAR> C_VR_STAR(g);
+    DistMatrix<T,STAR,VR  > C_STAR_VR(g);
+    C_VC_STAR.AlignCols( 0 );
+    C_STAR_VC.AlignRows( 0 );
+    C_VR_STAR.AlignCols( 0 );
+    C_STAR_VR.AlignRows( 0 );
+    CheckMisaligned( C_VC_STAR, B_MC_MR );
+    CheckMisaligned( C_STAR_VR, B_MC_MR );
+    CheckMisaligned( C_STAR_VC, B_MR_MC );
+    CheckMisaligned( C_VR_STAR, B_MR_MC );
+}
+
 template<typename T>
 void
 DistMatrixTest( int m, int n, const Grid& g )
@@ -229,6 +384,14 @@ DistMatrixTest( int m, int n, const Grid& g )
     Check( A_STAR_VC, A_STAR_STAR );
     Check( A_VR_STAR, A_STAR_STAR );
     Check( A_STAR_VR, A_STAR_STAR );
+
+    // Check the shortcuts for coinciding distributions on the given grid and
+    // on the p x 1 and 1 x p grids, where many more pairs coincide
+    CoincidenceTest<T>( m, n, g );
+    const Grid colGrid( g.Comm(), g.Size(), 1 );
+    const Grid rowGrid( g.Comm(), 1, g.Size() );
+    CoincidenceTest<T>( m, n, colGrid );
+    CoincidenceTest<T>( m, n, rowGrid );
 }
 
 int 
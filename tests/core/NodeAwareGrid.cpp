@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+template<typename T>
+void TestCollectives( const mpi::TwoLevelComm& twoLevelComm, int blocksize )
+{
+    mpi::Comm comm = twoLevelComm.comm;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    std::vector<T> sendBuf( commSize*blocksize ),
+                   flatBuf( commSize*blocksize ),
+                   twoLevelBuf( commSize*blocksize );
+    for( int i=0; i<commSize*blocksize; ++i )
+        sendBuf[i] = SampleUnitBall<T>();
+
+    // AllGather
+    mpi::AllGather( &sendBuf[0], blocksize, &flatBuf[0], blocksize, comm );
+    mpi::AllGather
+    ( &sendBuf[0], blocksize, &twoLevelBuf[0], blocksize, twoLevelComm );
+    int allGatherErrors = 0;
+    for( int i=0; i<commSize*blocksize; ++i )
+        if( flatBuf[i] != twoLevelBuf[i] )
+            ++allGatherErrors;
+
+    // ReduceScatter (the two-level sums are performed in a different order)
+    std::vector<T> copyBuf( sendBuf );
+    mpi::ReduceScatter( &copyBuf[0], &flatBuf[0], blocksize, mpi::SUM, comm );
+    mpi::ReduceScatter
+    ( &sendBuf[0], &twoLevelBuf[0], blocksize, mpi::SUM, twoLevelComm );
+    BASE(T) reduceScatterError = 0;
+    for( int i=0; i<blocksize; ++i )
+        reduceScatterError =
+            std::max( reduceScatterError, Abs(flatBuf[i]-twoLevelBuf[i]) );
+
+    // AllToAll
+    mpi::AllToAll( &sendBuf[0], blocksize, &flatBuf[0], blocksize, comm );
+    mpi::AllToAll
+    ( &sendBuf[0], blocksize, &twoLevelBuf[0], blocksize, twoLevelComm );
+    int allToAllErrors = 0;
+    for( int i=0; i<commSize*blocksize; ++i )
+        if( flatBuf[i] != twoLevelBuf[i] )
+            ++allToAllErrors;
+
+    mpi::AllReduce( &allGatherErrors, 1, mpi::SUM, comm );
+    mpi::AllReduce( &reduceScatterError, 1, mpi::MAX, comm );
+    mpi::AllReduce( &allToAllErrors, 1, mpi::SUM, comm );
+    if( commRank == 0 )
+    {
+        cout << "    AllGather mismatches:     " << allGatherErrors << "\n"
+             << "    ReduceScatter max error:  " << reduceScatterError << "\n"
+             << "    AllToAll mismatches:      " << allToAllErrors << endl;
+    }
+}
+
+void TestGrid
+( const Grid& g, const Grid& flatGrid, int m, int n, int blocksize,
+  bool print )
+{
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    if( commRank == 0 )
+        cout << "  Grid is " << g.Height() << " x " << g.Width() << endl;
+    if( print )
+    {
+        ostringstream os;
+        os << "  Process " << commRank << " -> (" << g.Row() << "," << g.Col()
+           << "), MC node size=" << g.MCTwoLevelComm().nodeSize
+           << ", MR node size=" << g.MRTwoLevelComm().nodeSize << endl;
+        cout << os.str();
+    }
+
+    if( commRank == 0 )
+        cout << "  Testing two-level collectives over [MC] comm..." << endl;
+    TestCollectives<double>( g.MCTwoLevelComm(), blocksize );
+    if( commRank == 0 )
+        cout << "  Testing two-level collectives over [MR] comm..." << endl;
+    TestCollectives<Complex<double> >( g.MRTwoLevelComm(), blocksize );
+    if( commRank == 0 )
+        cout << "  Testing two-level collectives over [VC] comm..." << endl;
+    TestCollectives<double>( g.VCTwoLevelComm(), blocksize );
+
+    // Redistribute a matrix from a standard grid onto the topology-aware
+    // grid, form the [MC,* ] and [* ,MR] panels, and then check the result
+    if( commRank == 0 )
+        cout << "  Testing [MC,* ] and [* ,MR] panel formation..." << endl;
+    DistMatrix<double> AFlat( flatGrid );
+    Uniform( AFlat, m, n );
+    DistMatrix<double> A( g );
+    A = AFlat;
+    DistMatrix<double,MC,STAR> A_MC_STAR( g );
+    DistMatrix<double,STAR,MR> A_STAR_MR( g );
+    A_MC_STAR = A;
+    A_STAR_MR = A;
+    DistMatrix<double> B( g ), C( g );
+    B = A_MC_STAR;
+    C = A_STAR_MR;
+    Axpy( -1., A, B );
+    Axpy( -1., A, C );
+    const double errorMCStar = FrobeniusNorm( B );
+    const double errorStarMR = FrobeniusNorm( C );
+    if( commRank == 0 )
+    {
+        cout << "    ||A - [MC,* ]||_F = " << errorMCStar << "\n"
+             << "    ||A - [* ,MR]||_F = " << errorStarMR << endl;
+    }
+
+    // Round-trip through [VC,* ] with and without shared-memory windows
+    for( int shared=0; shared<2; ++shared )
+    {
+        if( commRank == 0 )
+            cout << "  Testing [MC,MR] <-> [VC,* ]" 
+                 << ( shared ? " with shared windows..." : "..." ) << endl;
+        SetSharedMemoryRedistributions( shared );
+        DistMatrix<double,VC,STAR> A_VC_STAR( g );
+        A_VC_STAR = A;
+        DistMatrix<double> D( g );
+        D = A_VC_STAR;
+        Axpy( -1., A, D );
+        const double errorVCStar = FrobeniusNorm( D );
+        if( commRank == 0 )
+            cout << "    ||A - [VC,* ]||_F = " << errorVCStar << endl;
+    }
+    SetSharedMemoryRedistributions( false );
+    if( commRank == 0 )
+        cout << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        const int blocksize = Input("--blocksize","collective block size",10);
+        const bool print = Input("--print","print process placement?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid flatGrid( comm );
+        if( commRank == 0 )
+            cout << "Column-major topology-aware grid:" << endl;
+        const Grid colGrid( comm, COLUMN_MAJOR );
+        TestGrid( colGrid, flatGrid, m, n, blocksize, print );
+
+        if( commRank == 0 )
+            cout << "Row-major topology-aware grid:" << endl;
+        const Grid rowGrid( comm, ROW_MAJOR );
+        TestGrid( rowGrid, flatGrid, m, n, blocksize, print );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,166 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Compare against the known-answer tests distributed with Random123
+bool
+TestKnownAnswers()
+{
+    unsigned words[4];
+    RandomStream zeroStream( 0UL, 0UL );
+    zeroStream.Sample( 0, 0, words );
+    const bool zeroPassed =
+        words[0] == 0x6627e8d5U && words[1] == 0xe169c58dU &&
+        words[2] == 0xbc57ac4cU && words[3] == 0x9b00dbd8U;
+
+    bool onesPassed = true;
+    if( sizeof(unsigned long) >= 8 )
+    {
+        RandomStream onesStream( ~0UL, ~0UL );
+        onesStream.Sample( -1, -1, words );
+        onesPassed =
+            words[0] == 0x408f276dU && words[1] == 0x41c83b0eU &&
+            words[2] == 0xa20bc7c6U && words[3] == 0x6d5451fdU;
+    }
+    return zeroPassed && onesPassed;
+}
+
+// Ensure that every local entry matches the first stream of the given seed
+template<typename T,Distribution U,Distribution V>
+int
+CountMismatches( const Grid& g, int m, int n, unsigned long seed )
+{
+    SetRandomSeed( seed );
+    DistMatrix<T,U,V> A( g );
+    Uniform( A, m, n );
+
+    const RandomStream stream( seed, 0 );
+    int mismatches = 0;
+    const int localHeight = A.LocalHeight();
+    const int localWidth = A.LocalWidth();
+    for( int jLocal=0; jLocal<localWidth; ++jLocal )
+    {
+        const int j = A.RowShift() + jLocal*A.RowStride();
+        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const int i = A.ColShift() + iLocal*A.ColStride();
+            if( A.GetLocal(iLocal,jLocal) != stream.SampleUnitBall<T>(i,j) )
+                ++mismatches;
+        }
+    }
+    mpi::AllReduce( &mismatches, 1, mpi::SUM, g.ViewingComm() );
+    return mismatches;
+}
+
+// Ensure that the local random matrices of different processes differ by 
+// counting the entries which match those of another process
+int
+CountLocalCollisions( int m, int n, unsigned long seed )
+{
+    SetRandomSeed( seed );
+    Matrix<double> A;
+    Uniform( A, m, n );
+
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commSize = mpi::CommSize( comm );
+    const int size = m*n;
+    std::vector<double> entries( size*commSize );
+    mpi::AllGather( A.LockedBuffer(), size, &entries[0], size, comm );
+    int collisions = 0;
+    for( int k=0; k<size; ++k )
+        for( int q=0; q<commSize; ++q )
+            for( int r=q+1; r<commSize; ++r )
+                if( entries[k+q*size] == entries[k+r*size] )
+                    ++collisions;
+    return collisions;
+}
+
+template<typename T>
+void
+TestGrid( const Grid& g, int m, int n, unsigned long seed )
+{
+    const int commRank = mpi::CommRank( mpi::COMM_WORLD );
+    int mismatches = 0;
+    mismatches += CountMismatches<T,MC,  MR  >( g, m, n, seed );
+    mismatches += CountMismatches<T,MC,  STAR>( g, m, n, seed );
+    mismatches += CountMismatches<T,STAR,MR  >( g, m, n, seed );
+    mismatches += CountMismatches<T,MR,  MC  >( g, m, n, seed );
+    mismatches += CountMismatches<T,MD,  STAR>( g, m, n, seed );
+    mismatches += CountMismatches<T,STAR,MD  >( g, m, n, seed );
+    mismatches += CountMismatches<T,VC,  STAR>( g, m, n, seed );
+    mismatches += CountMismatches<T,STAR,VR  >( g, m, n, seed );
+    mismatches += CountMismatches<T,STAR,STAR>( g, m, n, seed );
+    if( commRank == 0 )
+        cout << "  " << g.Height() << " x " << g.Width() << " grid: "
+             << mismatches << " mismatched entries" << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        const int m = Input("--height","height of matrix",100);
+        const int n = Input("--width","width of matrix",100);
+        const int seed = Input("--seed","random seed",17);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            if( TestKnownAnswers() )
+                cout << "Philox-4x32-10 known-answer tests passed" << endl;
+            else
+                cout << "Philox-4x32-10 known-answer tests FAILED" << endl;
+        }
+
+        const int collisions = CountLocalCollisions( m, n, seed );
+        if( commRank == 0 )
+            cout << "Local random matrices: " << collisions 
+                 << " entries shared between processes" << endl;
+
+        const Grid squareGrid( comm );
+        const Grid rowGrid( comm, 1, commSize );
+        const Grid colGrid( comm, commSize, 1 );
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestGrid<double>( squareGrid, m, n, seed );
+        TestGrid<double>( rowGrid, m, n, seed );
+        TestGrid<double>( colGrid, m, n, seed );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestGrid<Complex<double> >( squareGrid, m, n, seed );
+        TestGrid<Complex<double> >( rowGrid, m, n, seed );
+        TestGrid<Complex<double> >( colGrid, m, n, seed );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+    Finalize();
+    return 0;
+}
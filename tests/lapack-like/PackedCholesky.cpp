@@ -0,0 +1,154 @@
+/*
+   Copyright (c) 2009-2013, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+// NOTE: It is possible to simply include "elemental.hpp" instead
+#include "elemental-lite.hpp"
+#include "elemental/blas-like/level1/Axpy.hpp"
+#include "elemental/blas-like/level1/MakeTriangular.hpp"
+#include "elemental/blas-like/level3/Herk.hpp"
+#include "elemental/lapack-like/Cholesky.hpp"
+#include "elemental/lapack-like/Norm/Frobenius.hpp"
+#include "elemental/matrices/HermitianUniformSpectrum.hpp"
+#include "elemental/matrices/Uniform.hpp"
+using namespace std;
+using namespace elem;
+
+// Return || tri(A) - tri(B) ||_F / || tri(B) ||_F, where A is packed
+template<typename F>
+BASE(F) RelativeError
+( const PackedDistMatrix<F>& APacked, const DistMatrix<F>& B )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A( B.Grid() ), BTri( B );
+    APacked.Unpack( A );
+    MakeTriangular( APacked.Uplo(), BTri );
+    const R frobNormOfB = FrobeniusNorm( BTri );
+    Axpy( F(-1), BTri, A );
+    return FrobeniusNorm( A ) / frobNormOfB;
+}
+
+template<typename F>
+void TestPackedCholesky
+( bool printMatrices, UpperOrLower uplo, int m, int k, const Grid& g )
+{
+    typedef BASE(F) R;
+    DistMatrix<F> A(g), B(g);
+    HermitianUniformSpectrum( A, m, 1, 10 );
+    Uniform( B, m, k );
+    if( printMatrices )
+        A.Print("A");
+
+    // Compare a packed Hermitian rank-k update against the full one
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting packed Herk...";
+        cout.flush();
+    }
+    DistMatrix<F> CFull( A );
+    PackedDistMatrix<F> CPacked( uplo, A );
+    Herk( uplo, NORMAL, F(-1)/F(m), B, F(2), CFull );
+    Herk( NORMAL, F(-1)/F(m), B, F(2), CPacked );
+    const R herkError = RelativeError( CPacked, CFull );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "  || C_packed - C ||_F / || C ||_F = " << herkError << endl;
+
+    // Compare the packed Cholesky factor of the updated matrix, which is
+    // still HPD, against the full one
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting packed Cholesky factorization...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    Cholesky( CPacked );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    Cholesky( uplo, CFull );
+    const R cholError = RelativeError( CPacked, CFull );
+    if( g.Rank() == 0 )
+        cout << "DONE.\n"
+             << "  Time = " << runTime << " seconds.\n"
+             << "  || L_packed - L ||_F / || L ||_F = " << cholError << endl;
+    if( printMatrices )
+    {
+        DistMatrix<F> L(g);
+        CPacked.Unpack( L );
+        L.Print("Packed factor");
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::CommRank( comm );
+    const int commSize = mpi::CommSize( comm );
+
+    try
+    {
+        int r = Input("--gridHeight","process grid height",0);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const int m = Input("--height","height of matrix",300);
+        const int k = Input("--rank","rank of Herk update",50);
+        const int nb = Input("--nb","algorithmic blocksize",64);
+        const bool printMatrices = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const int c = commSize / r;
+        const Grid g( comm, r, c );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+#ifndef RELEASE
+        if( commRank == 0 )
+        {
+            cout << "==========================================\n"
+                 << " In debug mode! Performance will be poor! \n"
+                 << "==========================================" << endl;
+        }
+#endif
+        if( commRank == 0 )
+            cout << "Will test packed Cholesky" << uploChar << " with "
+                 << (m+nb-1)/nb << " panels" << endl;
+
+        if( commRank == 0 )
+        {
+            cout << "---------------------\n"
+                 << "Testing with doubles:\n"
+                 << "---------------------" << endl;
+        }
+        TestPackedCholesky<double>( printMatrices, uplo, m, k, g );
+
+        if( commRank == 0 )
+        {
+            cout << "--------------------------------------\n"
+                 << "Testing with double-precision complex:\n"
+                 << "--------------------------------------" << endl;
+        }
+        TestPackedCholesky<Complex<double> >( printMatrices, uplo, m, k, g );
+    }
+    catch( ArgException& e ) { }
+    catch( exception& e )
+    {
+        ostringstream os;
+        os << "Process " << commRank << " caught error message:\n" << e.what()
+           << endl;
+        cerr << os.str();
+#ifndef RELEASE
+        DumpCallStack();
+#endif
+    }
+
+    Finalize();
+    return 0;
+}